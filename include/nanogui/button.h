@@ -58,7 +58,7 @@ public:
     const std::string &caption() const { return mCaption; }
 
     /// Sets the caption of this Button.
-    void setCaption(const std::string &caption) { mCaption = caption; }
+    void setCaption(const std::string &caption) { mCaption = caption; invalidateLayout(); }
 
     /// Returns the background color of this Button.
     const Color &backgroundColor() const { return mBackgroundColor; }
@@ -76,7 +76,7 @@ public:
     int icon() const { return mIcon; }
 
     /// Sets the icon of this Button.  See \ref nanogui::Button::mIcon.
-    void setIcon(int icon) { mIcon = icon; }
+    void setIcon(int icon) { mIcon = icon; invalidateLayout(); }
 
     /// The current flags of this Button (see \ref nanogui::Button::Flags for options).
     int flags() const { return mFlags; }
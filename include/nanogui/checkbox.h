@@ -52,7 +52,7 @@ public:
     const std::string &caption() const { return mCaption; }
 
     /// Sets the caption of this CheckBox.
-    void setCaption(const std::string &caption) { mCaption = caption; }
+    void setCaption(const std::string &caption) { mCaption = caption; invalidateLayout(); }
 
     /// Whether or not this CheckBox is currently checked.
     const bool &checked() const { return mChecked; }
@@ -371,29 +371,44 @@ class CheckBox;
 class ColorWheel;
 class ColorPicker;
 class ComboBox;
+class ConstraintLayout;
+class FlexLayout;
 class GLFramebuffer;
 class GLShader;
+class GlyphCache;
 class GridLayout;
 class GroupLayout;
+class ImageLoader;
 class ImagePanel;
 class ImageView;
 class Label;
 class Layout;
+class ListView;
+class LogView;
 class MessageDialog;
 class Object;
 class Popup;
 class PopupButton;
 class ProgressBar;
+class ResourcePack;
 class Screen;
 class Serializer;
 class Slider;
 class StackedWidget;
 class TabHeader;
 class TabWidget;
+class TableModel;
+class TableView;
+class TextArea;
 class TextBox;
+class TextBuffer;
+class TextMetrics;
+class TiledImage;
 class GLCanvas;
 class Theme;
 class ToolButton;
+class TreeModel;
+class TreeView;
 class VScrollPanel;
 class Widget;
 class Window;
@@ -517,10 +532,26 @@ extern NANOGUI_EXPORT void chdir_to_bundle_parent();
  */
 extern NANOGUI_EXPORT std::array<char, 8> utf8(int c);
 
-/// Load a directory of PNG images and upload them to the GPU (suitable for use with ImagePanel)
+/**
+ * \brief Load a directory of PNG images and upload them to the GPU (suitable
+ * for use with ImagePanel).
+ *
+ * The files are decoded in parallel, and the images are sorted by name. See
+ * \ref ImageLoader for a variant that returns right away.
+ */
 extern NANOGUI_EXPORT std::vector<std::pair<int, std::string>>
     loadImageDirectory(NVGcontext *ctx, const std::string &path);
 
+/**
+ * \brief Return the image that is stored under the given name in the
+ * registered resource packs (see \ref ResourcePack).
+ *
+ * The image is decoded and uploaded on the first request and cached per
+ * NanoVG context. Throws \c std::runtime_error if the resource is unknown
+ * or cannot be decoded.
+ */
+extern NANOGUI_EXPORT int loadImageResource(NVGcontext *ctx, const std::string &name);
+
 /// Convenience function for instanting a PNG icon from the application's data segment (via bin2c)
 #define nvgImageIcon(ctx, name) nanogui::__nanogui_get_image(ctx, #name, name##_png, name##_png_size)
 
@@ -0,0 +1,289 @@
+/*
+    nanogui/constraintlayout.h -- Layout that places widgets by solving a
+    system of linear constraints with an incremental simplex solver
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/layout.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class ConstraintLayout constraintlayout.h nanogui/constraintlayout.h
+ *
+ * \brief Layout which places widgets by solving linear equalities and
+ * inequalities between their edges.
+ *
+ * Every widget that is referenced by a constraint receives the variables
+ * \ref left(), \ref top(), \ref width() and \ref height(), measured relative
+ * to the content area of the container (i.e. inside of the margin and the
+ * window title). The widgets ask for their preferred size with strength
+ * \ref sizeStrength(), so stronger constraints may stretch or shrink them.
+ * Widgets with a fixed size ask for it with strength \c Strong instead.
+ * Constraints that cannot all be satisfied are resolved according to their
+ * \ref Strength. Children that are not referenced by any constraint are
+ * left untouched.
+ *
+ * The system is solved with the Cassowary algorithm. Adding or removing a
+ * constraint only pivots the affected rows of the simplex tableau, and
+ * changes of the container size or of the preferred size of a widget are
+ * handled as edits of existing variables which are re-optimized
+ * incrementally. Resizing a window therefore does not rebuild the system.
+ *
+ * \rst
+ * .. code-block:: cpp
+ *
+ *    ConstraintLayout *layout = new ConstraintLayout(10);
+ *    window->setLayout(layout);
+ *    Label *label = new Label(window, "Name");
+ *    TextBox *textBox = new TextBox(window);
+ *    layout->addConstraint(layout->left(label) == 0);
+ *    layout->addConstraint(layout->left(textBox) == layout->right(label) + 8);
+ *    layout->addConstraint(layout->right(textBox) == layout->containerWidth());
+ *    layout->addConstraint(layout->centerY(label) == layout->centerY(textBox));
+ *    layout->addConstraint(layout->top(textBox) == 0);
+ *    layout->addConstraint(layout->bottom(textBox) <= layout->containerHeight());
+ *
+ * \endrst
+ */
+class NANOGUI_EXPORT ConstraintLayout : public Layout {
+public:
+    /// Strength of a constraint. Stronger constraints take precedence when constraints conflict.
+    enum class Strength {
+        Weak = 0,
+        Medium,
+        Strong,
+        Required
+    };
+
+    /// Relation between the expression of a constraint and zero
+    enum class Relation {
+        LessEqual = 0,
+        Equal,
+        GreaterEqual
+    };
+
+    /**
+     * \struct Expression constraintlayout.h nanogui/constraintlayout.h
+     *
+     * \brief Linear combination of layout variables plus a constant.
+     */
+    struct Expression {
+        /// Pairs of variable identifier and coefficient
+        std::vector<std::pair<int, double>> terms;
+        /// Constant offset
+        double constant;
+
+        /// Create a constant expression
+        Expression(double constant = 0.0) : constant(constant) { }
+
+        /// Create an expression that consists of the given variable
+        static Expression variable(int id) {
+            Expression expr;
+            expr.terms.emplace_back(id, 1.0);
+            return expr;
+        }
+    };
+
+    /**
+     * \struct Constraint constraintlayout.h nanogui/constraintlayout.h
+     *
+     * \brief Relation between an expression and zero, together with its
+     * strength. Usually created with the comparison operators of
+     * \ref Expression.
+     */
+    struct Constraint {
+        Expression expression;
+        Relation relation;
+        Strength strength;
+    };
+
+    /// Create a constraint layout with the given margin around its content area
+    ConstraintLayout(int margin = 0);
+
+    /// The margin of this ConstraintLayout.
+    int margin() const { return mMargin; }
+
+    /// Sets the margin of this ConstraintLayout.
+    void setMargin(int margin) { mMargin = margin; invalidate(); }
+
+    /// The strength with which the widgets ask for their preferred size.
+    Strength sizeStrength() const { return mSizeStrength; }
+
+    /// Sets the strength with which the widgets ask for their preferred size (\c Required is treated as \c Strong).
+    void setSizeStrength(Strength strength);
+
+    /// Create an additional variable (e.g. a guide line shared by several widgets)
+    Expression newVariable();
+
+    /// Left edge of the given widget
+    Expression left(const Widget *widget) { return Expression::variable(variable(widget, 0)); }
+    /// Top edge of the given widget
+    Expression top(const Widget *widget) { return Expression::variable(variable(widget, 1)); }
+    /// Width of the given widget
+    Expression width(const Widget *widget) { return Expression::variable(variable(widget, 2)); }
+    /// Height of the given widget
+    Expression height(const Widget *widget) { return Expression::variable(variable(widget, 3)); }
+    /// Right edge of the given widget
+    Expression right(const Widget *widget);
+    /// Bottom edge of the given widget
+    Expression bottom(const Widget *widget);
+    /// Horizontal center of the given widget
+    Expression centerX(const Widget *widget);
+    /// Vertical center of the given widget
+    Expression centerY(const Widget *widget);
+
+    /// Width of the content area of the container
+    Expression containerWidth() const { return Expression::variable(mContainer[0]); }
+    /// Height of the content area of the container
+    Expression containerHeight() const { return Expression::variable(mContainer[1]); }
+
+    /**
+     * \brief Add a constraint and return an identifier for \ref removeConstraint().
+     *
+     * Throws \c std::runtime_error if a required constraint conflicts with
+     * the existing required constraints.
+     */
+    int addConstraint(const Constraint &constraint);
+
+    /// Remove a constraint that was added with \ref addConstraint()
+    void removeConstraint(int id);
+
+    /**
+     * \brief Forget the variables of a widget along with every constraint
+     * that refers to them.
+     *
+     * Call this before a child is removed from (or replaced in) the
+     * container. Otherwise its variables and constraints stay in the solver,
+     * and a new widget that is allocated at the same address inherits them.
+     * The identifiers of the removed constraints and expressions that refer
+     * to the widget become invalid.
+     */
+    void removeWidget(const Widget *widget);
+
+    /// Return the value of an expression in the most recent solution
+    double value(const Expression &expression) const;
+
+    /* Implementation of the layout interface */
+    /// See \ref Layout::preferredSize.
+    virtual Vector2i preferredSize(NVGcontext *ctx, const Widget *widget) const override;
+
+    /// See \ref Layout::performLayout.
+    virtual void performLayout(NVGcontext *ctx, Widget *widget) const override;
+
+protected:
+    struct Solver;
+
+    /// Variables and size edits of a widget
+    struct WidgetVariables {
+        /// Left, top, width and height
+        int vars[4];
+        /// Size that was last suggested to the solver
+        Vector2i suggested;
+        /// Strength of the width and height edits
+        Strength strength[2];
+    };
+
+    virtual ~ConstraintLayout();
+
+    /// Return the given variable (0: left, 1: top, 2: width, 3: height) of \c widget, creating them if needed
+    int variable(const Widget *widget, int index);
+
+    /// Suggest the preferred sizes of the visible children of \c widget to the solver
+    void updateSizes(NVGcontext *ctx, const Widget *widget) const;
+
+    /// The space that \c widget reserves above its children (e.g. the window title).
+    int headerHeight(const Widget *widget) const;
+
+protected:
+    /// The incremental simplex solver.
+    std::unique_ptr<Solver> mSolver;
+
+    /// The variables of the widgets.
+    mutable std::unordered_map<const Widget *, WidgetVariables> mWidgets;
+
+    /// The width and height of the content area.
+    int mContainer[2];
+
+    /// Whether the container size is currently an edit of the solver.
+    mutable bool mContainerFixed;
+
+    /// The margin around the content area.
+    int mMargin;
+
+    /// The strength with which the widgets ask for their preferred size.
+    Strength mSizeStrength;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Sum of two expressions
+inline ConstraintLayout::Expression operator+(ConstraintLayout::Expression a,
+                                              const ConstraintLayout::Expression &b) {
+    a.terms.insert(a.terms.end(), b.terms.begin(), b.terms.end());
+    a.constant += b.constant;
+    return a;
+}
+
+/// Product of an expression and a scalar
+inline ConstraintLayout::Expression operator*(ConstraintLayout::Expression a, double s) {
+    for (auto &term : a.terms)
+        term.second *= s;
+    a.constant *= s;
+    return a;
+}
+
+/// Product of a scalar and an expression
+inline ConstraintLayout::Expression operator*(double s, ConstraintLayout::Expression a) {
+    return std::move(a) * s;
+}
+
+/// Negated expression
+inline ConstraintLayout::Expression operator-(ConstraintLayout::Expression a) {
+    return std::move(a) * -1.0;
+}
+
+/// Difference of two expressions
+inline ConstraintLayout::Expression operator-(ConstraintLayout::Expression a,
+                                              const ConstraintLayout::Expression &b) {
+    return std::move(a) + b * -1.0;
+}
+
+/// Required constraint <tt>a == b</tt>
+inline ConstraintLayout::Constraint operator==(const ConstraintLayout::Expression &a,
+                                               const ConstraintLayout::Expression &b) {
+    return { a - b, ConstraintLayout::Relation::Equal, ConstraintLayout::Strength::Required };
+}
+
+/// Required constraint <tt>a <= b</tt>
+inline ConstraintLayout::Constraint operator<=(const ConstraintLayout::Expression &a,
+                                               const ConstraintLayout::Expression &b) {
+    return { a - b, ConstraintLayout::Relation::LessEqual, ConstraintLayout::Strength::Required };
+}
+
+/// Required constraint <tt>a >= b</tt>
+inline ConstraintLayout::Constraint operator>=(const ConstraintLayout::Expression &a,
+                                               const ConstraintLayout::Expression &b) {
+    return { a - b, ConstraintLayout::Relation::GreaterEqual, ConstraintLayout::Strength::Required };
+}
+
+/// Change the strength of a constraint, e.g. <tt>layout->width(w) == 100 | Strength::Weak</tt>
+inline ConstraintLayout::Constraint operator|(ConstraintLayout::Constraint c,
+                                              ConstraintLayout::Strength strength) {
+    c.strength = strength;
+    return c;
+}
+
+NAMESPACE_END(nanogui)
@@ -0,0 +1,93 @@
+/*
+    nanogui/glyphcache.h -- Persistent record of the glyphs that an
+    application draws, used to fill the font atlas ahead of time
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/common.h>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class GlyphCache glyphcache.h nanogui/glyphcache.h
+ *
+ * \brief Records which glyphs are used at which sizes, persists the record
+ * and rasterizes it into the NanoVG font atlas of new screens.
+ *
+ * NanoVG rasterizes glyphs lazily while drawing, so the first frames of a
+ * window stall while the glyphs of all its captions are rendered and
+ * uploaded one batch at a time. The glyph cache collects the code points
+ * of every string that \ref TextMetrics measures for the first time
+ * (grouped by face, font size and pixel ratio) while recording is enabled.
+ * Each \ref Screen then draws the recorded glyphs of its pixel ratio into
+ * its atlas before its first frame, in a single pass.
+ *
+ * The record can be saved to a file and loaded by later runs, so that
+ * short-lived windows start with a warm atlas. Faces are identified by
+ * their name and a hash of the font data; entries of faces whose data
+ * changed are dropped when the file is loaded.
+ *
+ * All functions are thread-safe.
+ */
+class NANOGUI_EXPORT GlyphCache {
+public:
+    /// Return whether measured strings are recorded
+    static bool recording();
+
+    /// Set whether measured strings are recorded (default: \c false)
+    static void setRecording(bool recording);
+
+    /**
+     * \brief Add the glyphs of a string in the given face and size at the
+     * given pixel ratio (0: the default ratio of \ref TextMetrics).
+     *
+     * Faces that are not known to \ref TextMetrics are ignored.
+     */
+    static void addGlyphs(const std::string &face, float size, const std::string &text,
+                          float pixelRatio = 0.f);
+
+    /// Add the glyphs of a string (\c end may be \c nullptr if the string is null-terminated)
+    static void addGlyphs(int font, float size, const char *string, const char *end = nullptr,
+                          float pixelRatio = 0.f);
+
+    /// Return the number of recorded glyphs (summed over all faces, sizes and pixel ratios)
+    static size_t glyphCount();
+
+    /// Remove all recorded glyphs
+    static void clear();
+
+    /**
+     * \brief Merge the glyphs recorded in a file into the cache.
+     *
+     * Returns \c false if the file does not exist or is not a glyph cache.
+     */
+    static bool load(const std::string &filename);
+
+    /**
+     * \brief Write the recorded glyphs to a file.
+     *
+     * The file is replaced atomically, so several processes may share it.
+     * Throws \c std::runtime_error if it cannot be written.
+     */
+    static void save(const std::string &filename);
+
+    /**
+     * \brief Rasterize the recorded glyphs of the given pixel ratio into
+     * the font atlas of a NanoVG context.
+     *
+     * Starts and cancels its own frame, so it must not be called while a
+     * frame is being drawn. \ref Screen calls this before its first frame.
+     */
+    static void prewarm(NVGcontext *ctx, float pixelRatio);
+};
+
+NAMESPACE_END(nanogui)
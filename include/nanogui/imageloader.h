@@ -0,0 +1,95 @@
+/*
+    nanogui/imageloader.h -- Loads the images of a directory on worker
+    threads
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/object.h>
+#include <memory>
+#include <vector>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class ImageLoader imageloader.h nanogui/imageloader.h
+ *
+ * \brief Asynchronous variant of \ref loadImageDirectory().
+ *
+ * The constructor lists the PNG files of a directory and returns right
+ * away, while worker threads decode the files. NanoVG is not thread-safe,
+ * so the decoded images are turned into NanoVG images by \ref update() on
+ * the UI thread, a few at a time, so that no single frame stalls. An
+ * \ref ImagePanel that is given a loader calls \ref update() while it is
+ * drawn and shows the images as they arrive; other users call it once per
+ * frame, e.g. from \ref Screen::drawContents().
+ *
+ * The workers stay at most a few images ahead of \ref update(), which
+ * bounds the memory held by decoded images. Calling \ref cancel() stops
+ * them after their current file, and destroying the loader also waits for
+ * them to exit.
+ */
+class NANOGUI_EXPORT ImageLoader : public Object {
+public:
+    /**
+     * \brief Start loading the PNG images of a directory.
+     *
+     * Throws \c std::runtime_error if the directory cannot be opened.
+     *
+     * \param threads
+     *     Number of worker threads (0: one per processor core)
+     */
+    ImageLoader(NVGcontext *ctx, const std::string &path, int threads = 0);
+
+    /// Cancels the workers and waits until they have finished their current file
+    ~ImageLoader();
+
+    /**
+     * \brief Create NanoVG images for up to \c maxImages decoded files.
+     *
+     * Returns the new images along with the file names without extension,
+     * in the format of \ref loadImageDirectory(). The caller owns the images.
+     * Must be called on the thread that owns the NanoVG context.
+     */
+    std::vector<std::pair<int, std::string>> update(int maxImages = 8);
+
+    /// Block until \ref update() has work to do or all files are decoded
+    void wait();
+
+    /// Stop decoding and discard the images that were not created yet
+    void cancel();
+
+    /// Return whether \ref cancel() was called
+    bool cancelled() const;
+
+    /// Return the number of image files in the directory
+    size_t fileCount() const;
+
+    /// Return the number of images that were created by \ref update()
+    size_t loadedCount() const;
+
+    /// Return the number of files that could not be decoded or uploaded
+    size_t failedCount() const;
+
+    /// Return the fraction of files that were loaded or failed, between 0 and 1
+    float progress() const;
+
+    /// Return whether every file was loaded or failed, or loading was cancelled
+    bool done() const;
+
+protected:
+    struct State;
+
+    NVGcontext *mContext;
+    std::shared_ptr<State> mState;
+};
+
+NAMESPACE_END(nanogui)
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <nanogui/widget.h>
+#include <nanogui/imageloader.h>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -28,9 +29,14 @@ public:
 public:
     ImagePanel(Widget *parent);
 
-    void setImages(const Images &data) { mImages = data; }
+    void setImages(const Images &data) { mImages = data; invalidateLayout(); }
     const Images& images() const { return mImages; }
 
+    /// Append the images of \c loader as they arrive (the panel calls \ref ImageLoader::update() while it is drawn)
+    void setImageLoader(ImageLoader *loader) { mImageLoader = loader; }
+    ImageLoader *imageLoader() { return mImageLoader; }
+    const ImageLoader *imageLoader() const { return mImageLoader.get(); }
+
     std::function<void(int)> callback() const { return mCallback; }
     void setCallback(const std::function<void(int)> &callback) { mCallback = callback; }
 
@@ -43,6 +49,7 @@ protected:
     int indexForPosition(const Vector2i &p) const;
 protected:
     Images mImages;
+    ref<ImageLoader> mImageLoader;
     std::function<void(int)> mCallback;
     int mThumbSize;
     int mSpacing;
@@ -16,7 +16,9 @@
 
 #include <nanogui/widget.h>
 #include <nanogui/glutil.h>
+#include <nanogui/tiledimage.h>
 #include <functional>
+#include <memory>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -28,10 +30,30 @@ NAMESPACE_BEGIN(nanogui)
 class NANOGUI_EXPORT ImageView : public Widget {
 public:
     ImageView(Widget* parent, GLuint imageID);
+    ImageView(Widget* parent, TiledImage* image);
     ~ImageView();
 
     void bindImage(GLuint imageId);
 
+    /**
+     * Displays an image that is split into a pyramid of tiles, which can be larger than the
+     * maximum texture size. Only the tiles of the level that matches the zoom factor and that
+     * intersect the visible region are loaded, on background threads, and the textures of the
+     * most recently used tiles are kept in a cache. While a tile is loading, the view shows the
+     * closest coarser tile that is available instead.
+     */
+    void bindTiledImage(TiledImage* image);
+    TiledImage* tiledImage() { return mTiledImage; }
+    const TiledImage* tiledImage() const { return mTiledImage.get(); }
+
+    /// The number of tile textures that are kept on the GPU (at least the visible tiles are kept).
+    int tileCacheSize() const { return mTileCacheSize; }
+    void setTileCacheSize(int tileCacheSize) { mTileCacheSize = tileCacheSize; }
+
+    /// The maximum number of tiles that are uploaded to the GPU per frame.
+    int tileUploadsPerFrame() const { return mTileUploadsPerFrame; }
+    void setTileUploadsPerFrame(int tileUploadsPerFrame) { mTileUploadsPerFrame = tileUploadsPerFrame; }
+
     GLShader& imageShader() { return mShader; }
 
     Vector2f positionF() const { return mPos.cast<float>(); }
@@ -64,12 +86,38 @@ public:
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     void setPixelInfoCallback(const std::function<std::pair<std::string, Color>(const Vector2i&)>& callback) {
         mPixelInfoCallback = callback;
+        mPixelInfoValid = false;
     }
     const std::function<std::pair<std::string, Color>(const Vector2i&)>& pixelInfoCallback() const {
         return mPixelInfoCallback;
     }
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
+    /**
+     * Sets a callback that provides the values of all visible pixels at once, which takes
+     * precedence over the per-pixel information callback. The callback receives the image
+     * coordinates of the upper left pixel and the size of a rectangle, and fills \c values with
+     * \c channels values per pixel in row-major order. \c colors holds one text color per pixel,
+     * initialized to the theme's text color, which the callback may replace. Each value is shown
+     * on its own line.
+     */
+    void setPixelRegionCallback(const std::function<void(const Vector2i&, const Vector2i&,
+                                                         float*, Color*)>& callback, int channels) {
+        mPixelRegionCallback = callback;
+        mPixelRegionChannels = channels;
+        mPixelInfoValid = false;
+    }
+    const std::function<void(const Vector2i&, const Vector2i&, float*, Color*)>& pixelRegionCallback() const {
+        return mPixelRegionCallback;
+    }
+    int pixelRegionChannels() const { return mPixelRegionChannels; }
+
+    /**
+     * The pixel information is formatted once and reused for as long as the same pixels are
+     * visible. Call this function when the pixel values changed without a call to \ref bindImage().
+     */
+    void invalidatePixelInfo() { mPixelInfoValid = false; }
+
     void setFontScaleFactor(float fontScaleFactor) { mFontScaleFactor = fontScaleFactor; }
     float fontScaleFactor() const { return mFontScaleFactor; }
 
@@ -133,24 +181,37 @@ public:
     void draw(NVGcontext* ctx) override;
 
 private:
+    struct TileLoader;
+    struct TileCache;
+
     // Helper image methods.
     void updateImageParameters();
+    void releaseTiles();
 
     // Helper drawing methods.
     void drawWidgetBorder(NVGcontext* ctx) const;
     void drawImageBorder(NVGcontext* ctx) const;
+    void drawTiles(const Vector2f& screenSize, float pixelRatio);
     void drawHelpers(NVGcontext* ctx) const;
     static void drawPixelGrid(NVGcontext* ctx, const Vector2f& upperLeftCorner,
                               const Vector2f& lowerRightCorner, float stride);
     void drawPixelInfo(NVGcontext* ctx, float stride) const;
+    void updatePixelInfo(const Vector2i& origin, const Vector2i& size) const;
     void writePixelInfo(NVGcontext* ctx, const Vector2f& cellPosition,
-                        const Vector2i& pixel, float stride, float fontSize) const;
+                        size_t cell, float stride, float fontSize) const;
 
     // Image parameters.
     GLShader mShader;
     GLuint mImageID;
     Vector2i mImageSize;
 
+    // Tiled image parameters.
+    ref<TiledImage> mTiledImage;
+    std::unique_ptr<TileLoader> mTileLoader;
+    std::unique_ptr<TileCache> mTileCache;
+    int mTileCacheSize = 256;
+    int mTileUploadsPerFrame = 8;
+
     // Image display parameters.
     float mScale;
     Vector2f mOffset;
@@ -166,7 +227,18 @@ private:
 
     // Image pixel data display members.
     std::function<std::pair<std::string, Color>(const Vector2i&)> mPixelInfoCallback;
+    std::function<void(const Vector2i&, const Vector2i&, float*, Color*)> mPixelRegionCallback;
+    int mPixelRegionChannels = 0;
     float mFontScaleFactor = 0.2f;
+
+    // Pixel information of the visible region, formatted once while the view is static.
+    mutable bool mPixelInfoValid = false;
+    mutable Vector2i mPixelInfoOrigin = Vector2i::Zero();
+    mutable Vector2i mPixelInfoSize = Vector2i::Zero();
+    mutable std::vector<float> mPixelValues;
+    mutable std::vector<std::string> mPixelInfoText;
+    mutable std::vector<int> mPixelInfoLines;
+    mutable std::vector<Color, Eigen::aligned_allocator<Color>> mPixelInfoColors;
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
@@ -22,7 +22,9 @@ NAMESPACE_BEGIN(nanogui)
  * \brief Text label widget.
  *
  * The font and color can be customized. When \ref Widget::setFixedWidth()
- * is used, the text is wrapped when it surpasses the specified width.
+ * is used, the text is wrapped when it surpasses the specified width. The
+ * line breaks are computed once and reused by \ref preferredSize() and
+ * \ref draw() until the caption, font or width changes.
  */
 class NANOGUI_EXPORT Label : public Widget {
 public:
@@ -32,10 +34,10 @@ public:
     /// Get the label's text caption
     const std::string &caption() const { return mCaption; }
     /// Set the label's text caption
-    void setCaption(const std::string &caption) { mCaption = caption; }
+    void setCaption(const std::string &caption) { mCaption = caption; invalidateLayout(); }
 
     /// Set the currently active font (2 are available by default: 'sans' and 'sans-bold')
-    void setFont(const std::string &font) { mFont = font; }
+    void setFont(const std::string &font) { mFont = font; invalidateLayout(); }
     /// Get the currently active font
     const std::string &font() const { return mFont; }
 
@@ -55,10 +57,29 @@ public:
 
     virtual void save(Serializer &s) const override;
     virtual bool load(Serializer &s) override;
+protected:
+    /// Rows of a wrapped caption, together with the parameters they were computed for
+    struct LineBreaks {
+        std::string caption;
+        std::string font;
+        float fontSize = 0.f;
+        int width = 0;
+        float pixelRatio = 0.f;
+        /// Distance between the tops of consecutive rows
+        float lineHeight = 0.f;
+        /// Byte ranges of the rows within \c caption
+        std::vector<std::pair<size_t, size_t>> rows;
+    };
+
+    /// Return the rows of the caption wrapped at the fixed width, breaking it again only if needed
+    const LineBreaks &lineBreaks(NVGcontext *ctx) const;
+
 protected:
     std::string mCaption;
     std::string mFont;
     Color mColor;
+    /// Cached line breaks of a wrapped caption
+    mutable LineBreaks mLineBreaks;
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
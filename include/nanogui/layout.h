@@ -18,6 +18,7 @@
 #include <nanogui/object.h>
 #include <cstdio>
 #include <unordered_map>
+#include <vector>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -68,9 +69,24 @@ public:
      */
     virtual Vector2i preferredSize(NVGcontext *ctx, const Widget *widget) const = 0;
 
+    /**
+     * \brief Invalidate the layout of every widget that uses this layout
+     * (see \ref Widget::invalidateLayout()).
+     *
+     * The setters of parameters that affect the preferred size or the
+     * arrangement call this function. Subclasses which cache measurements
+     * override it to discard them as well.
+     */
+    virtual void invalidate();
+
 protected:
+    friend class Widget;
+
     /// Default destructor (exists for inheritance).
     virtual ~Layout() { }
+
+    /// The widgets that use this layout (maintained by \ref Widget::setLayout()).
+    std::vector<Widget *> mOwners;
 };
 
 /**
@@ -106,25 +122,25 @@ public:
     Orientation orientation() const { return mOrientation; }
 
     /// Sets the Orientation of this BoxLayout.
-    void setOrientation(Orientation orientation) { mOrientation = orientation; }
+    void setOrientation(Orientation orientation) { mOrientation = orientation; invalidate(); }
 
     /// The Alignment of this BoxLayout.
     Alignment alignment() const { return mAlignment; }
 
     /// Sets the Alignment of this BoxLayout.
-    void setAlignment(Alignment alignment) { mAlignment = alignment; }
+    void setAlignment(Alignment alignment) { mAlignment = alignment; invalidate(); }
 
     /// The margin of this BoxLayout.
     int margin() const { return mMargin; }
 
     /// Sets the margin of this BoxLayout.
-    void setMargin(int margin) { mMargin = margin; }
+    void setMargin(int margin) { mMargin = margin; invalidate(); }
 
     /// The spacing this BoxLayout is using to pad in between widgets.
     int spacing() const { return mSpacing; }
 
     /// Sets the spacing of this BoxLayout.
-    void setSpacing(int spacing) { mSpacing = spacing; }
+    void setSpacing(int spacing) { mSpacing = spacing; invalidate(); }
 
     /* Implementation of the layout interface */
     /// See \ref Layout::preferredSize.
@@ -185,25 +201,25 @@ public:
     int margin() const { return mMargin; }
 
     /// Sets the margin of this GroupLayout.
-    void setMargin(int margin) { mMargin = margin; }
+    void setMargin(int margin) { mMargin = margin; invalidate(); }
 
     /// The spacing between widgets of this GroupLayout.
     int spacing() const { return mSpacing; }
 
     /// Sets the spacing between widgets of this GroupLayout.
-    void setSpacing(int spacing) { mSpacing = spacing; }
+    void setSpacing(int spacing) { mSpacing = spacing; invalidate(); }
 
     /// The indent of widgets in a group (underneath a Label) of this GroupLayout.
     int groupIndent() const { return mGroupIndent; }
 
     /// Sets the indent of widgets in a group (underneath a Label) of this GroupLayout.
-    void setGroupIndent(int groupIndent) { mGroupIndent = groupIndent; }
+    void setGroupIndent(int groupIndent) { mGroupIndent = groupIndent; invalidate(); }
 
     /// The spacing between groups of this GroupLayout.
     int groupSpacing() const { return mGroupSpacing; }
 
     /// Sets the spacing between groups of this GroupLayout.
-    void setGroupSpacing(int groupSpacing) { mGroupSpacing = groupSpacing; }
+    void setGroupSpacing(int groupSpacing) { mGroupSpacing = groupSpacing; invalidate(); }
 
     /* Implementation of the layout interface */
     /// See \ref Layout::preferredSize.
@@ -260,7 +276,8 @@ public:
     GridLayout(Orientation orientation = Orientation::Horizontal, int resolution = 2,
                Alignment alignment = Alignment::Middle,
                int margin = 0, int spacing = 0)
-        : mOrientation(orientation), mResolution(resolution), mMargin(margin) {
+        : mOrientation(orientation), mResolution(resolution), mMargin(margin),
+          mMeasuredWidget(nullptr) {
         mDefaultAlignment[0] = mDefaultAlignment[1] = alignment;
         mSpacing = Vector2i::Constant(spacing);
     }
@@ -269,30 +286,28 @@ public:
     Orientation orientation() const { return mOrientation; }
 
     /// Sets the Orientation of this GridLayout.
-    void setOrientation(Orientation orientation) {
-        mOrientation = orientation;
-    }
+    void setOrientation(Orientation orientation) { mOrientation = orientation; invalidate(); }
 
     /// The number of rows or columns (depending on the Orientation) of this GridLayout.
     int resolution() const { return mResolution; }
 
     /// Sets the number of rows or columns (depending on the Orientation) of this GridLayout.
-    void setResolution(int resolution) { mResolution = resolution; }
+    void setResolution(int resolution) { mResolution = resolution; invalidate(); }
 
     /// The spacing at the specified axis (row or column number, depending on the Orientation).
     int spacing(int axis) const { return mSpacing[axis]; }
 
     /// Sets the spacing for a specific axis.
-    void setSpacing(int axis, int spacing) { mSpacing[axis] = spacing; }
+    void setSpacing(int axis, int spacing) { mSpacing[axis] = spacing; invalidate(); }
 
     /// Sets the spacing for all axes.
-    void setSpacing(int spacing) { mSpacing[0] = mSpacing[1] = spacing; }
+    void setSpacing(int spacing) { mSpacing[0] = mSpacing[1] = spacing; invalidate(); }
 
     /// The margin around this GridLayout.
     int margin() const { return mMargin; }
 
     /// Sets the margin of this GridLayout.
-    void setMargin(int margin) { mMargin = margin; }
+    void setMargin(int margin) { mMargin = margin; invalidate(); }
 
     /**
      * The Alignment of the specified axis (row or column number, depending on
@@ -306,16 +321,16 @@ public:
     }
 
     /// Sets the Alignment of the columns.
-    void setColAlignment(Alignment value) { mDefaultAlignment[0] = value; }
+    void setColAlignment(Alignment value) { mDefaultAlignment[0] = value; invalidate(); }
 
     /// Sets the Alignment of the rows.
-    void setRowAlignment(Alignment value) { mDefaultAlignment[1] = value; }
+    void setRowAlignment(Alignment value) { mDefaultAlignment[1] = value; invalidate(); }
 
     /// Use this to set variable Alignment for columns.
-    void setColAlignment(const std::vector<Alignment> &value) { mAlignment[0] = value; }
+    void setColAlignment(const std::vector<Alignment> &value) { mAlignment[0] = value; invalidate(); }
 
     /// Use this to set variable Alignment for rows.
-    void setRowAlignment(const std::vector<Alignment> &value) { mAlignment[1] = value; }
+    void setRowAlignment(const std::vector<Alignment> &value) { mAlignment[1] = value; invalidate(); }
 
     /* Implementation of the layout interface */
     /// See \ref Layout::preferredSize.
@@ -324,10 +339,20 @@ public:
     /// See \ref Layout::performLayout.
     virtual void performLayout(NVGcontext *ctx, Widget *widget) const override;
 
+    /// See \ref Layout::invalidate.
+    virtual void invalidate() override;
+
 protected:
-    /// Compute the maximum row and column sizes
-    void computeLayout(NVGcontext *ctx, const Widget *widget,
-                       std::vector<int> *grid) const;
+    /**
+     * \brief Measure the visible children and compute the maximum row and
+     * column sizes.
+     *
+     * The results are stored in \ref mGrid and \ref mCells. They are reused
+     * as long as the preferred size of \c widget stays valid, so that the
+     * measurement done by the parent's layout also serves
+     * \ref performLayout().
+     */
+    void computeLayout(NVGcontext *ctx, const Widget *widget) const;
 
 protected:
     /// The Orientation defining this GridLayout.
@@ -347,6 +372,15 @@ protected:
 
     /// The margin around this GridLayout.
     int mMargin;
+
+    /// The widget that \ref mGrid and \ref mCells were computed for.
+    mutable const Widget *mMeasuredWidget;
+
+    /// The row and column sizes computed by \ref computeLayout().
+    mutable std::vector<int> mGrid[2];
+
+    /// The visible children and their sizes (preferred size with the fixed size applied).
+    mutable std::vector<std::pair<Widget *, Vector2i>> mCells;
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
@@ -393,8 +427,8 @@ public:
      * \brief Helper struct to coordinate anchor points for the layout.
      */
     struct Anchor {
-        uint8_t pos[2];    ///< The ``(x, y)`` position.
-        uint8_t size[2];   ///< The ``(x, y)`` size.
+        uint16_t pos[2];   ///< The ``(x, y)`` position.
+        uint16_t size[2];  ///< The ``(x, y)`` size.
         Alignment align[2];///< The ``(x, y)`` Alignment.
 
         /// Creates a ``0`` Anchor.
@@ -403,7 +437,7 @@ public:
         /// Create an Anchor at position ``(x, y)`` with specified Alignment.
         Anchor(int x, int y, Alignment horiz = Alignment::Fill,
               Alignment vert = Alignment::Fill) {
-            pos[0] = (uint8_t) x; pos[1] = (uint8_t) y;
+            pos[0] = (uint16_t) x; pos[1] = (uint16_t) y;
             size[0] = size[1] = 1;
             align[0] = horiz; align[1] = vert;
         }
@@ -412,8 +446,8 @@ public:
         Anchor(int x, int y, int w, int h,
               Alignment horiz = Alignment::Fill,
               Alignment vert = Alignment::Fill) {
-            pos[0] = (uint8_t) x; pos[1] = (uint8_t) y;
-            size[0] = (uint8_t) w; size[1] = (uint8_t) h;
+            pos[0] = (uint16_t) x; pos[1] = (uint16_t) y;
+            size[0] = (uint16_t) w; size[1] = (uint16_t) h;
             align[0] = horiz; align[1] = vert;
         }
 
@@ -433,7 +467,7 @@ public:
     int margin() const { return mMargin; }
 
     /// Sets the margin of this AdvancedGridLayout.
-    void setMargin(int margin) { mMargin = margin; }
+    void setMargin(int margin) { mMargin = margin; invalidate(); }
 
     /// Return the number of cols
     int colCount() const { return (int) mCols.size(); }
@@ -442,19 +476,29 @@ public:
     int rowCount() const { return (int) mRows.size(); }
 
     /// Append a row of the given size (and stretch factor)
-    void appendRow(int size, float stretch = 0.f) { mRows.push_back(size); mRowStretch.push_back(stretch); };
+    void appendRow(int size, float stretch = 0.f) {
+        mRows.push_back(size); mRowStretch.push_back(stretch);
+        invalidate();
+    }
 
     /// Append a column of the given size (and stretch factor)
-    void appendCol(int size, float stretch = 0.f) { mCols.push_back(size); mColStretch.push_back(stretch); };
+    void appendCol(int size, float stretch = 0.f) {
+        mCols.push_back(size); mColStretch.push_back(stretch);
+        invalidate();
+    }
 
     /// Set the stretch factor of a given row
-    void setRowStretch(int index, float stretch) { mRowStretch.at(index) = stretch; }
+    void setRowStretch(int index, float stretch) { mRowStretch.at(index) = stretch; invalidate(); }
 
     /// Set the stretch factor of a given column
-    void setColStretch(int index, float stretch) { mColStretch.at(index) = stretch; }
+    void setColStretch(int index, float stretch) { mColStretch.at(index) = stretch; invalidate(); }
 
     /// Specify the anchor data structure for a given widget
-    void setAnchor(const Widget *widget, const Anchor &anchor) { mAnchor[widget] = anchor; }
+    void setAnchor(const Widget *widget, const Anchor &anchor) {
+        mAnchor[widget] = anchor;
+        mAnchorsSorted = false;
+        invalidate();
+    }
 
     /// Retrieve the anchor data structure for a given widget
     Anchor anchor(const Widget *widget) const {
@@ -471,7 +515,24 @@ public:
     /// See \ref Layout::performLayout.
     virtual void performLayout(NVGcontext *ctx, Widget *widget) const override;
 
+    /// See \ref Layout::invalidate.
+    virtual void invalidate() override;
+
 protected:
+    /// Rebuild \ref mAnchors and \ref mAnchorOrder after \ref setAnchor() was called
+    void sortAnchors() const;
+
+    /**
+     * \brief Measure the anchored children of \c widget and compute the
+     * minimum row and column sizes.
+     *
+     * Each axis is handled by a single sweep over the anchors in the order
+     * of increasing span. The results are stored in \ref mGrid and
+     * \ref mAnchorSizes, and are reused as long as the preferred size of
+     * \c widget stays valid.
+     */
+    void measure(NVGcontext *ctx, const Widget *widget) const;
+
     /// Computes the layout
     void computeLayout(NVGcontext *ctx, const Widget *widget,
                        std::vector<int> *grid) const;
@@ -492,8 +553,214 @@ protected:
     /// The mapping of widgets to their specified anchor points.
     std::unordered_map<const Widget *, Anchor> mAnchor;
 
+    /// The contents of \ref mAnchor as a flat array.
+    mutable std::vector<std::pair<const Widget *, Anchor>> mAnchors;
+
+    /// Indices into \ref mAnchors, ordered by increasing span along each axis.
+    mutable std::vector<uint32_t> mAnchorOrder[2];
+
+    /// Whether \ref mAnchors and \ref mAnchorOrder reflect \ref mAnchor.
+    mutable bool mAnchorsSorted;
+
+    /// The widget that \ref mGrid and \ref mAnchorSizes were computed for.
+    mutable const Widget *mMeasuredWidget;
+
+    /// The minimum row and column sizes computed by \ref measure().
+    mutable std::vector<int> mGrid[2];
+
+    /// The size of each entry of \ref mAnchors (-1 if it is not laid out).
+    mutable std::vector<Vector2i> mAnchorSizes;
+
     /// The margin around this AdvancedGridLayout.
     int mMargin;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/**
+ * \class FlexLayout layout.h nanogui/layout.h
+ *
+ * \brief Flexible box layout, modeled after CSS flexbox.
+ *
+ * Widgets are placed one after the other along the main axis given by the
+ * Orientation. Each widget starts out with its basis size (by default its
+ * preferred size). Any remaining space on a line is distributed among the
+ * widgets according to their grow factors; when the line is too short, the
+ * widgets give up space in proportion to their shrink factors times their
+ * basis. If wrapping is enabled, widgets that do not fit are moved to a new
+ * line. Widgets with a fixed size along the main axis keep it.
+ *
+ * Measurement and placement are linear in the number of children, and each
+ * child is measured once per layout pass. With wrapping, the preferred size
+ * depends on the size of the container along the main axis; when the
+ * container is laid out at a different size than it was measured for, it
+ * is measured again in the next layout pass.
+ *
+ * \rst
+ * .. code-block:: cpp
+ *
+ *    FlexLayout *layout = new FlexLayout(Orientation::Horizontal);
+ *    layout->setSpacing(6);
+ *    panel->setLayout(layout);
+ *    TextBox *textBox = new TextBox(panel);
+ *    // The text box takes all the space that the button leaves
+ *    layout->setItem(textBox, FlexLayout::Item(1.f));
+ *    new Button(panel, "Search");
+ *
+ * \endrst
+ */
+class NANOGUI_EXPORT FlexLayout : public Layout {
+public:
+    /**
+     * \struct Item layout.h nanogui/layout.h
+     *
+     * \brief Flex parameters of a widget.
+     */
+    struct Item {
+        float grow;   ///< Relative share of the free space on the line (0 means the widget does not grow).
+        float shrink; ///< Relative amount (weighted by the basis) the widget gives up when the line overflows.
+        int basis;    ///< Initial size along the main axis (-1 uses the preferred size).
+
+        /// Create an Item with the given parameters.
+        Item(float grow = 0.f, float shrink = 1.f, int basis = -1)
+            : grow(grow), shrink(shrink), basis(basis) { }
+    };
+
+    /**
+     * \brief Construct a flex layout.
+     *
+     * \param orientation
+     *     The main axis along which widgets are placed.
+     *
+     * \param wrap
+     *     Whether widgets which do not fit are moved to a new line.
+     *
+     * \param margin
+     *     Margin around the layout container.
+     *
+     * \param spacing
+     *     Gap between adjacent widgets and lines.
+     */
+    FlexLayout(Orientation orientation = Orientation::Horizontal,
+               bool wrap = false, int margin = 0, int spacing = 0);
+
+    /// The main axis of this FlexLayout.
+    Orientation orientation() const { return mOrientation; }
+
+    /// Sets the main axis of this FlexLayout.
+    void setOrientation(Orientation orientation) { mOrientation = orientation; invalidate(); }
+
+    /// Whether widgets which do not fit are moved to a new line.
+    bool wrap() const { return mWrap; }
+
+    /// Sets whether widgets which do not fit are moved to a new line.
+    void setWrap(bool wrap) { mWrap = wrap; invalidate(); }
+
+    /// The margin around this FlexLayout.
+    int margin() const { return mMargin; }
+
+    /// Sets the margin around this FlexLayout.
+    void setMargin(int margin) { mMargin = margin; invalidate(); }
+
+    /// The gap between widgets along the given axis (0: horizontal, 1: vertical).
+    int spacing(int axis) const { return mSpacing[axis]; }
+
+    /// Sets the gap between widgets along the given axis.
+    void setSpacing(int axis, int spacing) { mSpacing[axis] = spacing; invalidate(); }
+
+    /// Sets the gap between widgets along both axes.
+    void setSpacing(int spacing) { mSpacing = Vector2i::Constant(spacing); invalidate(); }
+
+    /// The placement of the widgets along the main axis when none of them grows.
+    Alignment justification() const { return mJustification; }
+
+    /// Sets the placement of the widgets along the main axis (\c Fill behaves like \c Minimum).
+    void setJustification(Alignment justification) { mJustification = justification; invalidate(); }
+
+    /// The Alignment of the widgets within their line, perpendicular to the main axis.
+    Alignment alignment() const { return mAlignment; }
+
+    /// Sets the Alignment of the widgets within their line, perpendicular to the main axis.
+    void setAlignment(Alignment alignment) { mAlignment = alignment; invalidate(); }
+
+    /// Specify the flex parameters of a given widget.
+    void setItem(const Widget *widget, const Item &item) { mItems[widget] = item; invalidate(); }
+
+    /// Retrieve the flex parameters of a given widget (the defaults if none were specified).
+    Item item(const Widget *widget) const {
+        auto it = mItems.find(widget);
+        return it == mItems.end() ? Item() : it->second;
+    }
+
+    /* Implementation of the layout interface */
+    /// See \ref Layout::preferredSize.
+    virtual Vector2i preferredSize(NVGcontext *ctx, const Widget *widget) const override;
+
+    /// See \ref Layout::performLayout.
+    virtual void performLayout(NVGcontext *ctx, Widget *widget) const override;
+
+    /// See \ref Layout::invalidate.
+    virtual void invalidate() override;
+
+protected:
+    /// A visible child together with its flex parameters.
+    struct Entry {
+        Widget *widget;
+        Item item;
+        /// The preferred size with the fixed size applied.
+        Vector2i size;
+        /// The initial size along the main axis.
+        int basis;
+    };
+
+    /**
+     * \brief Measure the visible children of \c widget and break them into
+     * lines.
+     *
+     * \param mainSize
+     *     The space available along the main axis. Values <= 0 (or a
+     *     disabled \ref wrap()) place all widgets on a single line.
+     *
+     * \param entries
+     *     Receives the visible children in order.
+     *
+     * \param lines
+     *     Receives the index of the first entry of each line, followed by
+     *     the number of entries.
+     */
+    void computeLines(NVGcontext *ctx, const Widget *widget, int mainSize,
+                      std::vector<Entry> &entries,
+                      std::vector<size_t> &lines) const;
+
+    /// The space that \c widget reserves above its children (e.g. the window title).
+    int headerHeight(const Widget *widget) const;
+
+protected:
+    /// The main axis of this FlexLayout.
+    Orientation mOrientation;
+
+    /// Whether widgets which do not fit are moved to a new line.
+    bool mWrap;
+
+    /// The margin around this FlexLayout.
+    int mMargin;
+
+    /// The gap between widgets along each axis.
+    Vector2i mSpacing;
+
+    /// The placement of the widgets along the main axis.
+    Alignment mJustification;
+
+    /// The Alignment of the widgets within their line.
+    Alignment mAlignment;
+
+    /// The flex parameters of the widgets.
+    std::unordered_map<const Widget *, Item> mItems;
+
+    /// The space along the main axis that the cached preferred size of each widget is based on (when wrapping).
+    mutable std::unordered_map<const Widget *, int> mMainSizes;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
 NAMESPACE_END(nanogui)
@@ -0,0 +1,174 @@
+/*
+    nanogui/listview.h -- Virtualized list which only instantiates widgets
+    for the rows that are currently visible
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/widget.h>
+#include <functional>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class ListView listview.h nanogui/listview.h
+ *
+ * \brief Scrollable list of fixed-height rows backed by a data callback.
+ *
+ * In contrast to placing one widget per row into a \ref VScrollPanel, this
+ * widget only creates row widgets for the rows that are currently visible
+ * (plus a small overscan margin above and below). When the list is scrolled,
+ * rows that leave the visible range are recycled and re-bound to the rows
+ * that enter it, so the number of live widgets is independent of
+ * \ref rowCount().
+ *
+ * Row widgets are created by the \ref createCallback() (by default, a
+ * \ref Label) and filled with data by the \ref bindCallback(), which receives
+ * the row widget and the index of the row it now represents:
+ *
+ * \rst
+ * .. code-block:: cpp
+ *
+ *    ListView *list = new ListView(window);
+ *    list->setFixedSize(Vector2i(300, 400));
+ *    list->setRowCount(1000000);
+ *    list->setBindCallback([](Widget *row, int index) {
+ *        ((Label *) row)->setCaption("Row " + std::to_string(index));
+ *    });
+ *
+ * \endrst
+ */
+class NANOGUI_EXPORT ListView : public Widget {
+public:
+    ListView(Widget *parent);
+
+    /// Return the number of rows in the list
+    int rowCount() const { return mRowCount; }
+    /// Set the number of rows in the list
+    void setRowCount(int rowCount);
+
+    /// Return the height of each row in pixels
+    int rowHeight() const { return mRowHeight; }
+    /// Set the height of each row in pixels
+    void setRowHeight(int rowHeight);
+
+    /// Return the number of rows that are kept alive above and below the visible range
+    int overscan() const { return mOverscan; }
+    /// Set the number of rows that are kept alive above and below the visible range
+    void setOverscan(int overscan) { mOverscan = overscan; mUpdateRows = true; }
+
+    /// Return the callback used to instantiate new row widgets
+    std::function<Widget *(ListView *)> createCallback() const { return mCreateCallback; }
+    /**
+     * \brief Set the callback used to instantiate new row widgets.
+     *
+     * The callback must construct the widget as a direct child of the list
+     * view that is passed to it. If no callback is set, a \ref Label is used.
+     */
+    void setCreateCallback(const std::function<Widget *(ListView *)> &callback) {
+        mCreateCallback = callback;
+    }
+
+    /// Return the callback used to fill a row widget with the data of a row
+    std::function<void(Widget *, int)> bindCallback() const { return mBindCallback; }
+    /// Set the callback used to fill a row widget with the data of a row
+    void setBindCallback(const std::function<void(Widget *, int)> &callback) {
+        mBindCallback = callback;
+        refresh();
+    }
+
+    /// Return the index of the selected row (or -1 if there is none)
+    int selectedIndex() const { return mSelectedIndex; }
+    /// Set the index of the selected row (-1 clears the selection)
+    void setSelectedIndex(int index) { mSelectedIndex = index; }
+
+    /// Return the callback that is invoked when the user selects a row
+    std::function<void(int)> callback() const { return mCallback; }
+    /// Set the callback that is invoked when the user selects a row
+    void setCallback(const std::function<void(int)> &callback) { mCallback = callback; }
+
+    /// Return the current scroll amount as a value between 0 and 1. 0 means scrolled to the top and 1 to the bottom.
+    float scroll() const { return (float) mScroll; }
+    /// Set the scroll amount to a value between 0 and 1. 0 means scrolled to the top and 1 to the bottom.
+    void setScroll(float scroll);
+
+    /// Scroll the minimal amount that is needed to make the given row visible
+    void scrollToRow(int row);
+
+    /// Re-bind all rows that are currently alive (e.g. after the underlying data has changed)
+    void refresh();
+
+    /// Return the range of rows ``[first, last)`` that currently have a row widget
+    std::pair<int, int> realizedRange() const {
+        return std::make_pair(mFirstRow, mFirstRow + (int) mRows.size());
+    }
+
+    /// Return the widget that currently represents the given row, or \c nullptr if it is not alive
+    Widget *rowWidget(int row) const {
+        if (row < mFirstRow || row >= mFirstRow + (int) mRows.size())
+            return nullptr;
+        return mRows[row - mFirstRow];
+    }
+
+    /// Return the index of the row at the given position (relative to the parent), or -1
+    int rowAt(const Vector2i &p) const;
+
+    virtual void performLayout(NVGcontext *ctx) override;
+    virtual Vector2i preferredSize(NVGcontext *ctx) const override;
+    virtual bool mouseButtonEvent(const Vector2i &p, int button, bool down, int modifiers) override;
+    virtual bool mouseDragEvent(const Vector2i &p, const Vector2i &rel, int button, int modifiers) override;
+    virtual bool scrollEvent(const Vector2i &p, const Vector2f &rel) override;
+    virtual bool keyboardEvent(int key, int scancode, int action, int modifiers) override;
+    virtual void draw(NVGcontext *ctx) override;
+    virtual void save(Serializer &s) const override;
+    virtual bool load(Serializer &s) override;
+
+protected:
+    /// Total height of all rows in pixels
+    double contentHeight() const { return (double) mRowCount * mRowHeight; }
+
+    /// Distance in pixels between the top of the first row and the top of the view
+    double scrollOffset() const {
+        return mScroll * std::max(0.0, contentHeight() - mSize.y());
+    }
+
+    /// Recycle rows which left the visible range and bind rows that entered it
+    void updateRows(NVGcontext *ctx);
+
+    /// Row recycling and binding do not invalidate the layout of the parents
+    virtual void markLayoutDirty() override;
+
+    /// Take a row widget out of the pool of recycled widgets (or create a new one)
+    Widget *acquireRow();
+
+    /// Move a row widget into the pool of recycled widgets
+    void releaseRow(Widget *row);
+
+protected:
+    int mRowCount;
+    int mRowHeight;
+    int mOverscan;
+    int mSelectedIndex;
+    double mScroll;
+    int mFirstRow;
+    std::vector<Widget *> mRows;
+    std::vector<Widget *> mFreeRows;
+    bool mUpdateRows;
+    bool mRebindRows;
+    bool mUpdatingRows;
+    std::function<Widget *(ListView *)> mCreateCallback;
+    std::function<void(Widget *, int)> mBindCallback;
+    std::function<void(int)> mCallback;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+NAMESPACE_END(nanogui)
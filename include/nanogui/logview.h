@@ -0,0 +1,170 @@
+/*
+    nanogui/logview.h -- Scrolling log console backed by a thread-safe
+    ring buffer of lines
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/widget.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class LogView logview.h nanogui/logview.h
+ *
+ * \brief Read-only console that shows the most recent lines of a log.
+ *
+ * Lines are stored in a ring buffer of fixed capacity; once it is full, each
+ * new line replaces the oldest one, and the storage of the replaced line is
+ * reused. \ref append() may be called from any thread and only holds a lock
+ * while the lines are copied into the buffer, so producers can log hundreds
+ * of thousands of lines per second.
+ *
+ * The widget collects the new lines once per frame, which makes the cost of
+ * an append independent of the number of lines on display. Lines have a
+ * fixed height and are virtualized like the rows of a \ref ListView: only
+ * the visible lines are copied out of the buffer and drawn, and no line is
+ * measured. Lines can be filtered by a substring and a minimum level, and
+ * are colored by their level. While the view is scrolled to the bottom and
+ * \ref autoScroll() is enabled, it follows new lines.
+ */
+class NANOGUI_EXPORT LogView : public Widget {
+public:
+    /// Severity of a line
+    enum class Level {
+        Debug = 0,
+        Info,
+        Warning,
+        Error
+    };
+
+    LogView(Widget *parent, size_t capacity = 10000);
+
+    /**
+     * \brief Append text to the log (thread-safe).
+     *
+     * The text is split into lines at newline characters; a trailing
+     * newline does not start an empty line.
+     */
+    void append(const std::string &text, Level level = Level::Info);
+
+    /// Remove all lines (thread-safe)
+    void clear();
+
+    /// Return the maximum number of lines that are kept (thread-safe)
+    size_t capacity() const;
+    /// Set the maximum number of lines that are kept, dropping the oldest lines if needed (thread-safe)
+    void setCapacity(size_t capacity);
+
+    /// Return the number of lines that were appended since the widget was created (thread-safe)
+    uint64_t totalLines() const;
+
+    /// Return the number of lines that pass the filter (as of the last frame or call to \ref update())
+    size_t lineCount() const { return mRows.size(); }
+    /// Return the text of the given line among the lines that pass the filter (empty if it was dropped since)
+    std::string lineText(size_t index) const;
+    /// Return the level of the given line among the lines that pass the filter (\c Info if it was dropped since)
+    Level lineLevel(size_t index) const;
+
+    /// Return the substring that lines must contain to be shown
+    const std::string &filter() const { return mFilter; }
+    /// Set the substring that lines must contain to be shown (an empty string shows all lines)
+    void setFilter(const std::string &filter);
+
+    /// Return the lowest level that is shown
+    Level minimumLevel() const { return mMinimumLevel; }
+    /// Set the lowest level that is shown
+    void setMinimumLevel(Level level);
+
+    /// Return the color of lines with the given level
+    const Color &levelColor(Level level) const { return mLevelColors[(int) level]; }
+    /// Set the color of lines with the given level
+    void setLevelColor(Level level, const Color &color) { mLevelColors[(int) level] = color; }
+
+    /// Return whether the view follows new lines while it is scrolled to the bottom
+    bool autoScroll() const { return mAutoScroll; }
+    /// Set whether the view follows new lines while it is scrolled to the bottom
+    void setAutoScroll(bool autoScroll);
+
+    /// Scroll to the last line (and follow new lines if \ref autoScroll() is enabled)
+    void scrollToBottom();
+
+    /// Return the height of a line in pixels
+    int lineHeight() const;
+
+    /// Collect the lines that were appended since the last update (called by \ref draw())
+    void update();
+
+    virtual Vector2i preferredSize(NVGcontext *ctx) const override;
+    virtual bool mouseButtonEvent(const Vector2i &p, int button, bool down, int modifiers) override;
+    virtual bool mouseDragEvent(const Vector2i &p, const Vector2i &rel, int button, int modifiers) override;
+    virtual bool scrollEvent(const Vector2i &p, const Vector2f &rel) override;
+    virtual bool keyboardEvent(int key, int scancode, int action, int modifiers) override;
+    virtual void draw(NVGcontext *ctx) override;
+    virtual void save(Serializer &s) const override;
+    virtual bool load(Serializer &s) override;
+
+protected:
+    struct Entry {
+        std::string text;
+        Level level;
+    };
+
+    /// Return the entry with the given sequence number (the caller must hold the lock)
+    const Entry &entry(uint64_t seq) const { return mEntries[seq % mEntries.size()]; }
+
+    /// Return whether a line passes the filter
+    bool matches(const Entry &entry) const;
+
+    /// Rebuild the list of lines that pass the filter
+    void refilter();
+
+    /// Height of the lines that pass the filter in pixels
+    double contentHeight() const { return (double) mRows.size() * lineHeight(); }
+
+    /// Move the view, keeping it within the content
+    void setScrollOffset(double offset);
+
+protected:
+    /* Shared with appending threads, guarded by mMutex */
+    mutable std::mutex mMutex;
+    std::vector<Entry> mEntries;
+    /// Sequence number of the next line
+    uint64_t mTotal;
+    /// Number of lines in the buffer (the oldest has sequence number mTotal - mCount)
+    size_t mCount;
+    /// Whether lines were appended since the last update
+    std::atomic<bool> mPending;
+
+    /* Accessed by the UI thread only */
+    /// Sequence numbers of the lines that pass the filter
+    std::deque<uint64_t> mRows;
+    /// Sequence number of the next line that has not been filtered yet
+    uint64_t mScanned;
+    std::string mFilter;
+    Level mMinimumLevel;
+    Color mLevelColors[4];
+    bool mAutoScroll;
+    /// Whether the view is attached to the bottom
+    bool mFollow;
+    /// Distance in pixels between the top of the first line and the top of the view
+    double mScrollY;
+    /// Lines copied out of the buffer for drawing (reused between frames)
+    std::vector<Entry> mVisible;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+NAMESPACE_END(nanogui)
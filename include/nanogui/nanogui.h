@@ -17,6 +17,10 @@
 #include <nanogui/theme.h>
 #include <nanogui/window.h>
 #include <nanogui/layout.h>
+#include <nanogui/textmetrics.h>
+#include <nanogui/glyphcache.h>
+#include <nanogui/resourcepack.h>
+#include <nanogui/constraintlayout.h>
 #include <nanogui/label.h>
 #include <nanogui/checkbox.h>
 #include <nanogui/button.h>
@@ -28,10 +32,17 @@
 #include <nanogui/entypo.h>
 #include <nanogui/messagedialog.h>
 #include <nanogui/textbox.h>
+#include <nanogui/textarea.h>
 #include <nanogui/slider.h>
+#include <nanogui/imageloader.h>
 #include <nanogui/imagepanel.h>
 #include <nanogui/imageview.h>
+#include <nanogui/tiledimage.h>
 #include <nanogui/vscrollpanel.h>
+#include <nanogui/listview.h>
+#include <nanogui/logview.h>
+#include <nanogui/tableview.h>
+#include <nanogui/treeview.h>
 #include <nanogui/colorwheel.h>
 #include <nanogui/graph.h>
 #include <nanogui/formhelper.h>
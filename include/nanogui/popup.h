@@ -42,7 +42,7 @@ public:
     /// Return the anchor height; this determines the vertical shift relative to the anchor position
     int anchorHeight() const { return mAnchorHeight; }
 
-    /// Set the side of the parent window at which popup will appear
+    /// Set the side of the parent window at which popup will appear (on the left side, the popup ends at the anchor position)
     void setSide(Side popupSide) { mSide = popupSide; }
     /// Return the side of the parent window at which popup will appear
     Side side() const { return mSide; }
@@ -0,0 +1,102 @@
+/*
+    nanogui/resourcepack.h -- Memory-mapped archive of fonts, images
+    and other assets
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/common.h>
+#include <vector>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class ResourcePack resourcepack.h nanogui/resourcepack.h
+ *
+ * \brief Read-only archive of named assets that is accessed in place.
+ *
+ * A pack starts with a small index of resource names, offsets and sizes,
+ * sorted by name, followed by the contents of the resources. Packs are
+ * memory-mapped, so opening one only reads the index, and the pages of a
+ * resource are read by the operating system when the resource is first
+ * used. Pointers to resources stay valid for the lifetime of the pack.
+ *
+ * The fonts of NanoGUI are stored in a pack that is built along with the
+ * library (with the \c nanogui-pack tool). It is either embedded into the
+ * library or installed next to it, depending on the CMake option
+ * \c NANOGUI_EMBED_RESOURCES, and can be extended with the application's
+ * own files via the \c NANOGUI_EXTRA_RESOURCES CMake variable. Further
+ * packs can be registered at runtime with \ref addPack(); \ref resource()
+ * searches the most recently added packs first, so they can also replace
+ * built-in resources.
+ */
+class NANOGUI_EXPORT ResourcePack {
+public:
+    /// Contents of a resource (\c data is \c nullptr if it does not exist)
+    struct Resource {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+    };
+
+    /// Memory-map the pack stored in the given file
+    explicit ResourcePack(const std::string &filename);
+
+    /// Access a pack that is stored in memory (the data is not copied and must outlive the pack)
+    ResourcePack(const uint8_t *data, size_t size);
+
+    ~ResourcePack();
+
+    ResourcePack(const ResourcePack &) = delete;
+    ResourcePack &operator=(const ResourcePack &) = delete;
+
+    /// Return the number of resources
+    size_t count() const { return mCount; }
+
+    /// Return the name of the resource with the given index (resources are sorted by name)
+    std::string name(size_t index) const;
+
+    /// Look up a resource by name (binary search over the index)
+    Resource find(const std::string &name) const;
+
+    /**
+     * \brief Write a pack that contains the given files.
+     *
+     * Each entry of \c files is a pair of a resource name and the path of
+     * the file that provides its contents.
+     */
+    static void write(const std::string &filename,
+                      const std::vector<std::pair<std::string, std::string>> &files);
+
+    /// Register a pack that is searched before all previously added packs
+    static void addPack(const std::string &filename);
+
+    /// Return whether any registered pack (including the built-in one) contains a resource
+    static bool hasResource(const std::string &name);
+
+    /// Return a resource from the registered packs, or throw \c std::runtime_error if it is unknown
+    static Resource resource(const std::string &name);
+
+protected:
+    /// Validate the header and the index
+    void parse();
+
+    /// Return the name of an index entry without copying it
+    void entryName(size_t index, const char **name, size_t *length) const;
+
+protected:
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mCount;
+    /// Platform-specific mapping handle (\c nullptr for packs in memory)
+    void *mMapping;
+};
+
+NAMESPACE_END(nanogui)
@@ -146,6 +146,7 @@ public:
     /// Compute the layout of all widgets
     void performLayout() {
         Widget::performLayout(mNVGContext);
+        clearLayoutDirty();
     }
 
 public:
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <nanogui/widget.h>
+#include <nanogui/textmetrics.h>
 #include <vector>
 #include <string>
 #include <functional>
@@ -96,6 +97,7 @@ public:
     virtual void performLayout(NVGcontext* ctx) override;
     virtual Vector2i preferredSize(NVGcontext* ctx) const override;
     virtual bool mouseButtonEvent(const Vector2i &p, int button, bool down, int modifiers) override;
+    virtual bool scrollEvent(const Vector2i &p, const Vector2f &rel) override;
 
     virtual void draw(NVGcontext* ctx) override;
 
@@ -111,12 +113,18 @@ private:
 
         TabButton(TabHeader& header, const std::string& label);
 
-        void setLabel(const std::string& label) { mLabel = label; }
+        void setLabel(const std::string& label) { mLabel = label; mGlyphFont.clear(); }
         const std::string& label() const { return mLabel; }
         void setSize(const Vector2i& size) { mSize = size; }
         const Vector2i& size() const { return mSize; }
 
         Vector2i preferredSize(NVGcontext* ctx) const;
+
+        /**
+         * Determine how much of the label fits into the button. The glyph
+         * positions of the label are cached, so that only a binary search is
+         * needed when the button width changes.
+         */
         void calculateVisibleString(NVGcontext* ctx);
         void drawAtPosition(NVGcontext* ctx, const Vector2i& position, bool active);
         void drawActiveBorderAt(NVGcontext * ctx, const Vector2i& position, float offset, const Color& color);
@@ -127,16 +135,19 @@ private:
         std::string mLabel;
         Vector2i mSize;
 
-        /**
-         * \struct StringView tabheader.h nanogui/tabheader.h
-         *
-         * \brief Helper struct to represent the TabButton.
-         */
-        struct StringView {
-            const char* first = nullptr;
-            const char* last = nullptr;
-        };
-        StringView mVisibleText;
+        /// Glyph positions and advance of the label.
+        std::vector<TextMetrics::GlyphPosition> mGlyphs;
+        float mLabelWidth = 0.f;
+        /// Font, font size and pixel ratio of the glyph positions (an empty font means that they are out of date).
+        std::string mGlyphFont;
+        float mGlyphFontSize = 0.f, mGlyphPixelRatio = 0.f;
+
+        /// The button width for which the visible string was calculated (-1 if it is out of date).
+        int mVisibleFor = -1;
+        /// Number of bytes of the label that are shown.
+        size_t mVisibleLength = 0;
+        /// Whether the shown part of the label is followed by dots.
+        bool mTruncated = false;
         int mVisibleWidth = 0;
     };
 
@@ -0,0 +1,292 @@
+/*
+    nanogui/tableview.h -- Virtualized table which draws its cells directly
+    and only instantiates widgets for the cell that is being edited
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/widget.h>
+#include <functional>
+#include <memory>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class TableModel tableview.h nanogui/tableview.h
+ *
+ * \brief Data source of a \ref TableView.
+ *
+ * The \ref TableView sorts and filters its rows on a worker thread, which
+ * calls \ref rowCount(), \ref text(), \ref lessThan() and \ref accept()
+ * concurrently with the UI thread. Implementations must therefore allow
+ * concurrent reads. The table cancels the worker before it calls
+ * \ref setText(), so edits need no synchronization; other changes to the
+ * data must not race with the worker either. After the data has changed,
+ * call \ref TableView::modelChanged() to recompute the sort/filter index.
+ */
+class NANOGUI_EXPORT TableModel : public Object {
+public:
+    /// Return the number of rows
+    virtual int rowCount() const = 0;
+
+    /// Return the number of columns
+    virtual int columnCount() const = 0;
+
+    /// Return the text of the given cell
+    virtual std::string text(int row, int column) const = 0;
+
+    /// Return the caption of the given column (empty by default)
+    virtual std::string headerText(int column) const;
+
+    /// Return whether the given cell can be edited (\c false by default)
+    virtual bool editable(int row, int column) const;
+
+    /// Store the edited text of a cell. Return \c false to reject the value.
+    virtual bool setText(int row, int column, const std::string &value);
+
+    /**
+     * \brief Ordering used when sorting by \c column.
+     *
+     * The default implementation compares numerically when both cells
+     * contain numbers and lexicographically otherwise.
+     */
+    virtual bool lessThan(int column, int rowA, int rowB) const;
+
+    /**
+     * \brief Return whether \c row should be shown for the given filter.
+     *
+     * The default implementation accepts rows where any cell contains
+     * \c filter as a substring.
+     */
+    virtual bool accept(int row, const std::string &filter) const;
+
+protected:
+    virtual ~TableModel() { }
+};
+
+/**
+ * \class TableView tableview.h nanogui/tableview.h
+ *
+ * \brief Scrollable table with row and column virtualization.
+ *
+ * Only the cells that intersect the visible area are queried from the
+ * \ref TableModel, and their text is drawn directly with NanoVG. A single
+ * \ref TextBox is created on demand when the user double-clicks an editable
+ * cell. The first \ref fixedRowCount() rows and \ref fixedColumnCount()
+ * columns stay in place while the rest of the table scrolls.
+ *
+ * Clicking a column header sorts the table by that column; clicking it again
+ * reverses the order. Sorting and filtering run on a worker thread that is
+ * owned by the table, and the previous ordering remains visible until the
+ * new one is available. A new sort or filter request cancels the one that is
+ * being computed.
+ */
+class NANOGUI_EXPORT TableView : public Widget {
+public:
+    TableView(Widget *parent);
+    virtual ~TableView();
+
+    /// Return the data model
+    TableModel *model() { return mModel; }
+    /// Return the data model
+    const TableModel *model() const { return mModel.get(); }
+    /// Set the data model
+    void setModel(TableModel *model);
+
+    /// Notify the table that the data of the model has changed
+    void modelChanged();
+
+    /// Return the height of each row in pixels
+    int rowHeight() const { return mRowHeight; }
+    /// Set the height of each row in pixels
+    void setRowHeight(int rowHeight) { mRowHeight = std::max(rowHeight, 1); }
+
+    /// Return the height of the column header in pixels (0 hides the header)
+    int headerHeight() const { return mHeaderHeight; }
+    /// Set the height of the column header in pixels (0 hides the header)
+    void setHeaderHeight(int headerHeight) { mHeaderHeight = std::max(headerHeight, 0); }
+
+    /// Return the width of columns which have no explicit width
+    int defaultColumnWidth() const { return mDefaultColumnWidth; }
+    /// Set the width of columns which have no explicit width
+    void setDefaultColumnWidth(int width);
+
+    /// Return the width of the given column
+    int columnWidth(int column) const;
+    /// Set the width of the given column
+    void setColumnWidth(int column, int width);
+
+    /// Return the number of leading rows which do not scroll vertically
+    int fixedRowCount() const { return mFixedRowCount; }
+    /// Set the number of leading rows which do not scroll vertically
+    void setFixedRowCount(int count) { mFixedRowCount = std::max(count, 0); }
+
+    /// Return the number of leading columns which do not scroll horizontally
+    int fixedColumnCount() const { return mFixedColumnCount; }
+    /// Set the number of leading columns which do not scroll horizontally
+    void setFixedColumnCount(int count);
+
+    /// Return the column used for sorting (or -1 if the table is unsorted)
+    int sortColumn() const { return mSortColumn; }
+    /// Return whether the table is sorted in ascending order
+    bool sortAscending() const { return mSortAscending; }
+    /// Sort by the given column (-1 restores the order of the model)
+    void sortByColumn(int column, bool ascending = true);
+
+    /// Return the current filter string
+    const std::string &filter() const { return mFilter; }
+    /// Only show the rows that are accepted by \ref TableModel::accept()
+    void setFilter(const std::string &filter);
+
+    /// Return whether a sort/filter computation is still running
+    bool indexPending() const { return mIndexPending; }
+
+    /// Return the number of rows after filtering
+    int rowCount() const;
+
+    /// Return the model row shown at the given (sorted and filtered) position
+    int modelRow(int viewRow) const;
+
+    /// Return the (sorted and filtered) position of the given model row, or -1 if it is not shown
+    int viewRow(int modelRow) const;
+
+    /// Return the selected model row (or -1 if there is none)
+    int selectedRow() const { return mSelectedRow; }
+    /// Select the given model row (-1 clears the selection)
+    void setSelectedRow(int row) { mSelectedRow = row; }
+
+    /// Return the callback that is invoked with the model row when the user selects a row
+    std::function<void(int)> callback() const { return mCallback; }
+    /// Set the callback that is invoked with the model row when the user selects a row
+    void setCallback(const std::function<void(int)> &callback) { mCallback = callback; }
+
+    /// Return the horizontal scroll amount as a value between 0 and 1
+    float scrollX() const { return (float) mScrollX; }
+    /// Set the horizontal scroll amount to a value between 0 and 1
+    void setScrollX(float scroll) { mScrollX = std::max(0.f, std::min(1.f, scroll)); }
+
+    /// Return the vertical scroll amount as a value between 0 and 1
+    float scrollY() const { return (float) mScrollY; }
+    /// Set the vertical scroll amount to a value between 0 and 1
+    void setScrollY(float scroll) { mScrollY = std::max(0.f, std::min(1.f, scroll)); }
+
+    /// Scroll the minimal amount that is needed to make the given (sorted and filtered) row visible
+    void scrollToRow(int viewRow);
+
+    /**
+     * \brief Return the cell at the given position (relative to the parent).
+     *
+     * The result contains the sorted and filtered row (-1 for the header)
+     * and the column, or (-2, -2) if the position is outside of the cells.
+     */
+    Vector2i cellAt(const Vector2i &p) const;
+
+    /// Open the editor on the given cell if the model allows editing it
+    void editCell(int viewRow, int column);
+
+    virtual void performLayout(NVGcontext *ctx) override;
+    virtual Vector2i preferredSize(NVGcontext *ctx) const override;
+    virtual bool mouseButtonEvent(const Vector2i &p, int button, bool down, int modifiers) override;
+    virtual bool mouseDragEvent(const Vector2i &p, const Vector2i &rel, int button, int modifiers) override;
+    virtual bool scrollEvent(const Vector2i &p, const Vector2f &rel) override;
+    virtual bool keyboardEvent(int key, int scancode, int action, int modifiers) override;
+    virtual void draw(NVGcontext *ctx) override;
+    virtual void save(Serializer &s) const override;
+    virtual bool load(Serializer &s) override;
+
+protected:
+    struct IndexTask;
+
+    /// Start recomputing the sort/filter index on the worker thread
+    void updateIndex();
+
+    /// Adopt the result of the worker thread once it is available
+    void fetchIndex();
+
+    /// Recompute the column offsets if the widths have changed
+    void updateColumns() const;
+
+    /// Horizontal offset of the given column, relative to the first column
+    int columnOffset(int column) const {
+        updateColumns();
+        return mColumnOffsets[column];
+    }
+
+    /// Index of the column that contains the given x offset (relative to the first column)
+    int columnAtOffset(int x) const;
+
+    /// Width of the non-scrolling columns
+    int fixedWidth() const { return columnOffset(fixedColumns()); }
+    /// Height of the header and the non-scrolling rows
+    int fixedHeight() const { return mHeaderHeight + fixedRows() * mRowHeight; }
+
+    /// Number of non-scrolling columns, clamped to the columns of the model
+    int fixedColumns() const;
+    /// Number of non-scrolling rows, clamped to the rows of the model
+    int fixedRows() const { return std::min(mFixedRowCount, rowCount()); }
+
+    /// Size of the area available to the cells (i.e. without the scroll bars)
+    Vector2i viewSize() const;
+
+    /// Width of the scrolling columns
+    double contentWidth() const;
+    /// Height of the scrolling rows
+    double contentHeight() const {
+        return (double) (rowCount() - fixedRows()) * mRowHeight;
+    }
+
+    /// Horizontal distance in pixels that the scrolling columns are scrolled by
+    double scrollOffsetX() const;
+    /// Vertical distance in pixels that the scrolling rows are scrolled by
+    double scrollOffsetY() const;
+
+    /// Draw the header cells of the columns [\c c0, \c c1) whose left edge is at \c x
+    void drawHeader(NVGcontext *ctx, int c0, int c1, float x);
+
+    /// Draw the rows [\c r0, \c r1) of the columns [\c c0, \c c1) with the top left corner at (\c x, \c y)
+    void drawCells(NVGcontext *ctx, int r0, int r1, float y, int c0, int c1, float x);
+
+    /// Draw the scroll bars
+    void drawScrollBars(NVGcontext *ctx);
+
+    /// Write back the value of the editor and hide it
+    void closeEditor(bool commit);
+
+protected:
+    ref<TableModel> mModel;
+    int mRowHeight;
+    int mHeaderHeight;
+    int mDefaultColumnWidth;
+    std::vector<int> mColumnWidths;
+    mutable std::vector<int> mColumnOffsets;
+    mutable bool mColumnsDirty;
+    int mFixedRowCount;
+    int mFixedColumnCount;
+    int mSortColumn;
+    bool mSortAscending;
+    std::string mFilter;
+    std::vector<int> mIndex;
+    std::vector<int> mInverseIndex;
+    bool mIndexed;
+    bool mIndexPending;
+    std::unique_ptr<IndexTask> mIndexTask;
+    int mSelectedRow;
+    double mScrollX, mScrollY;
+    int mDragMode;
+    double mLastClick;
+    TextBox *mEditor;
+    int mEditRow, mEditColumn;
+    std::function<void(int)> mCallback;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+NAMESPACE_END(nanogui)
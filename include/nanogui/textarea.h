@@ -0,0 +1,262 @@
+/*
+    nanogui/textarea.h -- Multi-line text editor for large documents,
+    backed by a piece table with a line index
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/widget.h>
+#include <nanogui/textmetrics.h>
+#include <functional>
+#include <map>
+#include <vector>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class TextBuffer textarea.h nanogui/textarea.h
+ *
+ * \brief Piece table that stores a UTF-8 document and indexes its lines.
+ *
+ * The document is described by a sequence of pieces which refer either to
+ * the original text or to an append-only buffer of inserted text, so edits
+ * never move the bulk of a large document. The positions of the newlines
+ * of both buffers are recorded once, which makes counting the newlines of
+ * a piece a pair of binary searches. Finding the start of a line or the
+ * line of a position therefore takes logarithmic time in the number of
+ * pieces and newlines. Consecutive insertions (e.g. typing) extend the
+ * previous piece instead of adding new ones.
+ *
+ * Positions are byte offsets into the document.
+ */
+class NANOGUI_EXPORT TextBuffer {
+public:
+    /// Create a buffer with the given contents
+    TextBuffer(const std::string &text = "");
+
+    /// Replace the whole document
+    void setText(const std::string &text);
+
+    /// Return the whole document
+    std::string text() const { return text(0, mSize); }
+
+    /// Return \c length bytes starting at \c pos
+    std::string text(size_t pos, size_t length) const;
+
+    /// Return the size of the document in bytes
+    size_t size() const { return mSize; }
+
+    /// Return the number of lines (one more than the number of newlines)
+    size_t lineCount() const { return mNewlines + 1; }
+
+    /// Return the position of the first byte of the given line
+    size_t lineStart(size_t line) const;
+
+    /// Return the position of the newline that ends the given line (or the size of the document)
+    size_t lineEnd(size_t line) const;
+
+    /// Return the contents of the given line without its newline
+    std::string line(size_t line) const;
+
+    /// Return the line that contains the given position
+    size_t lineOf(size_t pos) const;
+
+    /// Insert text at the given position
+    void insert(size_t pos, const std::string &text);
+
+    /// Remove \c length bytes starting at \c pos
+    void erase(size_t pos, size_t length);
+
+    /// Return the number of pieces (for diagnostics)
+    size_t pieceCount() const { return mPieces.size(); }
+
+protected:
+    /// Range of the original or the added buffer
+    struct Piece {
+        bool added;
+        size_t start;
+        size_t length;
+    };
+
+    /// Return the buffer that a piece refers to
+    const std::string &source(const Piece &piece) const {
+        return piece.added ? mAdded : mOriginal;
+    }
+
+    /// Return the newline positions of the buffer that a piece refers to
+    const std::vector<size_t> &newlines(const Piece &piece) const {
+        return piece.added ? mAddedNewlines : mOriginalNewlines;
+    }
+
+    /// Count the newlines within the first \c length bytes of a piece
+    size_t countNewlines(const Piece &piece, size_t length) const;
+
+    /// Return the index of the piece containing \c pos (the last piece if \c pos is the size)
+    size_t findPiece(size_t pos) const;
+
+    /// Recompute the offsets and newline counts of the pieces starting at index \c first
+    void update(size_t first);
+
+protected:
+    std::string mOriginal, mAdded;
+    std::vector<size_t> mOriginalNewlines, mAddedNewlines;
+    std::vector<Piece> mPieces;
+    /// Position of the first byte of each piece
+    std::vector<size_t> mOffsets;
+    /// Number of newlines preceding each piece
+    std::vector<size_t> mLines;
+    size_t mSize;
+    size_t mNewlines;
+};
+
+/**
+ * \class TextArea textarea.h nanogui/textarea.h
+ *
+ * \brief Scrollable, editable multi-line text field for large documents.
+ *
+ * The text is stored in a \ref TextBuffer, so editing a multi-megabyte
+ * document only touches the piece table. Lines have a fixed height and are
+ * virtualized like the rows of a \ref TreeView: only the visible lines are
+ * extracted, measured and drawn. The glyph positions of a line are computed
+ * with \ref TextMetrics when the line first becomes visible and are kept
+ * until the line is edited, and long lines only draw the glyphs that
+ * intersect the view.
+ *
+ * The text uses the embedded \c "sans" face. The preferred size shows ten
+ * lines independently of the contents, so edits never invalidate the layout.
+ */
+class NANOGUI_EXPORT TextArea : public Widget {
+public:
+    TextArea(Widget *parent, const std::string &value = "");
+
+    /// Return the document
+    std::string value() const { return mBuffer.text(); }
+    /// Replace the document (moves the cursor to the start and scrolls to the top)
+    void setValue(const std::string &value);
+
+    /// Return the underlying text buffer
+    const TextBuffer &buffer() const { return mBuffer; }
+
+    /// Return whether the user can edit the text
+    bool editable() const { return mEditable; }
+    /// Set whether the user can edit the text
+    void setEditable(bool editable);
+
+    /// Return the byte offset of the cursor
+    size_t cursorPosition() const { return mCursorPos; }
+    /// Move the cursor (clears the selection)
+    void setCursorPosition(size_t position);
+
+    /// Return the byte offset where the selection starts (\c std::string::npos if nothing is selected)
+    size_t selectionStart() const { return mSelection; }
+    /// Select the text between \c start and \c end (the cursor is placed at \c end)
+    void select(size_t start, size_t end);
+    /// Return the selected text
+    std::string selectedText() const;
+
+    /// Replace the selection (or insert at the cursor) and invoke the callback
+    void insert(const std::string &text);
+    /// Append text at the end of the document without moving the cursor
+    void append(const std::string &text);
+
+    /// Return the height of a line in pixels
+    int lineHeight() const;
+
+    /// Return the callback that is invoked whenever the user changes the text
+    std::function<void()> callback() const { return mCallback; }
+    /// Set the callback that is invoked whenever the user changes the text
+    void setCallback(const std::function<void()> &callback) { mCallback = callback; }
+
+    /// Scroll the minimal amount that is needed to make the cursor visible
+    void scrollToCursor();
+
+    /// Scroll the minimal amount that is needed to make the given line visible
+    void scrollToLine(size_t line);
+
+    /// Return the byte offset closest to the given position (relative to the parent)
+    size_t positionAt(const Vector2i &p) const;
+
+    virtual Vector2i preferredSize(NVGcontext *ctx) const override;
+    virtual bool mouseButtonEvent(const Vector2i &p, int button, bool down, int modifiers) override;
+    virtual bool mouseDragEvent(const Vector2i &p, const Vector2i &rel, int button, int modifiers) override;
+    virtual bool scrollEvent(const Vector2i &p, const Vector2f &rel) override;
+    virtual bool keyboardEvent(int key, int scancode, int action, int modifiers) override;
+    virtual bool keyboardCharacterEvent(unsigned int codepoint) override;
+    virtual void draw(NVGcontext *ctx) override;
+    virtual void save(Serializer &s) const override;
+    virtual bool load(Serializer &s) override;
+
+protected:
+    /// Text and glyph positions of a line
+    struct LineLayout {
+        std::string text;
+        std::vector<TextMetrics::GlyphPosition> glyphs;
+        float width;
+    };
+
+    /// Return the layout of the given line, computing it if needed
+    const LineLayout &lineLayout(size_t line) const;
+
+    /// Drop the cached layout of \c line, and of all following lines if \c following is set
+    void invalidateLines(size_t line, bool following);
+
+    /// Return the horizontal position of a byte offset within a line
+    float offsetToX(const LineLayout &layout, size_t offset) const;
+
+    /// Return the byte offset within a line that is closest to a horizontal position
+    size_t xToOffset(const LineLayout &layout, float x) const;
+
+    /// Return the start of the character preceding \c pos
+    size_t previousCharacter(size_t pos) const;
+
+    /// Return the start of the character following \c pos
+    size_t nextCharacter(size_t pos) const;
+
+    /// Replace the range [begin, end) and invoke the callback
+    void replace(size_t begin, size_t end, const std::string &text);
+
+    /// Move the cursor, extending the selection if \c extend is set
+    void moveCursor(size_t pos, bool extend);
+
+    bool copySelection();
+    void pasteFromClipboard();
+
+    /// Height of the document in pixels
+    double contentHeight() const { return (double) mBuffer.lineCount() * lineHeight(); }
+
+    /// Width of the area in which text is drawn
+    int viewWidth() const;
+
+protected:
+    TextBuffer mBuffer;
+    bool mEditable;
+    size_t mCursorPos;
+    size_t mSelection;
+    /// Horizontal position that vertical cursor movement tries to keep (-1 if unset)
+    float mPreferredX;
+    /// Distance in pixels between the top of the document and the top of the view
+    double mScrollY;
+    /// Distance in pixels between the left of the text and the left of the view
+    float mScrollX;
+    /// Whether the current drag moves the scroll bar (otherwise it selects text)
+    bool mDragScrollbar;
+    double mLastClick;
+    std::function<void()> mCallback;
+
+    /// Layouts of recently visible lines
+    mutable std::map<size_t, LineLayout> mLineLayouts;
+    /// Font size and pixel ratio of the cached layouts
+    mutable float mLayoutFontSize, mLayoutPixelRatio;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+NAMESPACE_END(nanogui)
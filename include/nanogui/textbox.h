@@ -16,8 +16,11 @@
 #pragma once
 
 #include <nanogui/widget.h>
+#include <nanogui/textmetrics.h>
 #include <cstdio>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -46,10 +49,10 @@ public:
     void setEditable(bool editable);
 
     bool spinnable() const { return mSpinnable; }
-    void setSpinnable(bool spinnable) { mSpinnable = spinnable; }
+    void setSpinnable(bool spinnable) { mSpinnable = spinnable; invalidateLayout(); }
 
     const std::string &value() const { return mValue; }
-    void setValue(const std::string &value) { mValue = value; }
+    void setValue(const std::string &value) { mValue = value; invalidateLayout(); }
 
     const std::string &defaultValue() const { return mDefaultValue; }
     void setDefaultValue(const std::string &defaultValue) { mDefaultValue = defaultValue; }
@@ -58,15 +61,21 @@ public:
     void setAlignment(Alignment align) { mAlignment = align; }
 
     const std::string &units() const { return mUnits; }
-    void setUnits(const std::string &units) { mUnits = units; }
+    void setUnits(const std::string &units) { mUnits = units; invalidateLayout(); }
 
     int unitsImage() const { return mUnitsImage; }
-    void setUnitsImage(int image) { mUnitsImage = image; }
+    void setUnitsImage(int image) { mUnitsImage = image; invalidateLayout(); }
 
     /// Return the underlying regular expression specifying valid formats
     const std::string &format() const { return mFormat; }
-    /// Specify a regular expression specifying valid formats
-    void setFormat(const std::string &format) { mFormat = format; }
+    /**
+     * \brief Specify a regular expression specifying valid formats.
+     *
+     * The expression is compiled once and shared between all text boxes
+     * with the same format. The integer and floating point formats of
+     * \ref IntBox and \ref FloatBox are checked without regular expressions.
+     */
+    void setFormat(const std::string &format);
 
     /// Return the placeholder text to be displayed while the text box is empty.
     const std::string &placeholder() const { return mPlaceholder; }
@@ -94,17 +103,33 @@ public:
     virtual void save(Serializer &s) const override;
     virtual bool load(Serializer &s) override;
 protected:
+    /// Compiled form of a format
+    struct Validator;
+
+    /// Return the shared compiled form of a format (\c nullptr if the format is empty)
+    static std::shared_ptr<const Validator> validator(const std::string &format);
+
     bool checkFormat(const std::string& input,const std::string& format);
     bool copySelection();
     void pasteFromClipboard();
     bool deleteSelection();
 
-    void updateCursor(NVGcontext *ctx, float lastx,
-                      const NVGglyphPosition *glyphs, int size);
-    float cursorIndex2Position(int index, float lastx,
-                               const NVGglyphPosition *glyphs, int size);
-    int position2CursorIndex(float posx, float lastx,
-                             const NVGglyphPosition *glyphs, int size);
+    /**
+     * \brief Bring the cached glyph positions up to date with the edited text.
+     *
+     * Only the glyphs between the common prefix and suffix of the previous
+     * and the current text are measured again (together with their
+     * neighbors, which may be kerned against them); the glyphs of the
+     * suffix are shifted.
+     */
+    void updateGlyphPositions();
+
+    /// Apply pending mouse clicks and drags to the cursor (\c originx is the left edge of the text)
+    void updateCursor(float originx);
+    /// Return the horizontal position of the cursor index (\c originx is the left edge of the text)
+    float cursorIndex2Position(int index, float originx) const;
+    /// Return the cursor index that is closest to a horizontal position (\c originx is the left edge of the text)
+    int position2CursorIndex(float posx, float originx) const;
 
     /// The location (if any) for the spin area.
     enum class SpinArea { None, Top, Bottom };
@@ -119,6 +144,7 @@ protected:
     Alignment mAlignment;
     std::string mUnits;
     std::string mFormat;
+    std::shared_ptr<const Validator> mValidator;
     int mUnitsImage;
     std::function<bool(const std::string& str)> mCallback;
     bool mValidFormat;
@@ -132,6 +158,15 @@ protected:
     int mMouseDownModifier;
     float mTextOffset;
     double mLastClick;
+
+    /// Glyph positions of \ref mGlyphText, relative to the start of the text
+    std::vector<TextMetrics::GlyphPosition> mGlyphs;
+    /// The text that is described by \ref mGlyphs
+    std::string mGlyphText;
+    /// The advance of \ref mGlyphText
+    float mGlyphWidth;
+    /// The font size and pixel ratio of \ref mGlyphs
+    float mGlyphFontSize, mGlyphPixelRatio;
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
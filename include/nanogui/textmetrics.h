@@ -0,0 +1,192 @@
+/*
+    nanogui/textmetrics.h -- Measurement of text without an OpenGL or
+    NanoVG context
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/common.h>
+#include <vector>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class TextMetrics textmetrics.h nanogui/textmetrics.h
+ *
+ * \brief Measures text by reading TrueType fonts directly, without a
+ * NanoVG context.
+ *
+ * The faces \c "sans", \c "sans-bold" and \c "icons" are read from the
+ * \ref ResourcePack when they are first used, and further faces can be added
+ * with \ref addFont(). The results reproduce the measurements of NanoVG
+ * (kerning, rounding of glyph advances and the bounds of glyph quads) at
+ * a given pixel ratio, so layouts computed with either agree. Every
+ * \ref Screen registers the ratio of its NanoVG context, which the
+ * functions that take a context use. The other functions take the ratio as
+ * an argument; when it is 0, they use the default ratio of
+ * \ref setPixelRatio(float).
+ *
+ * All functions are thread-safe and work without OpenGL, which makes it
+ * possible to compute layouts headless or on worker threads. Glyph indices
+ * and advances are cached per face; the first 128 code points are resolved
+ * when the face is loaded, so measuring ASCII text does not lock.
+ *
+ * Complete measurements are kept in a shared cache with least recently used
+ * eviction, keyed on the face, size, letter spacing, pixel ratio and the
+ * length and 64 bit hash of the string. Captions, titles and tab labels
+ * that are measured every frame are therefore only laid out once.
+ */
+class NANOGUI_EXPORT TextMetrics {
+public:
+    /**
+     * \struct GlyphPosition textmetrics.h nanogui/textmetrics.h
+     *
+     * \brief Position of a glyph within a string (like \c NVGglyphPosition).
+     */
+    struct GlyphPosition {
+        /// Byte offset of the glyph in the string
+        size_t offset;
+        /// Position of the pen before the glyph is drawn
+        float x;
+        /// Left edge of the glyph quad or the pen position, whichever is smaller
+        float minx;
+        /// Right edge of the glyph quad or the next pen position, whichever is larger
+        float maxx;
+    };
+
+    /**
+     * \brief Register a TrueType font under the given name.
+     *
+     * The data is not copied and must stay valid until the program exits.
+     * Returns a handle to the face, or -1 if the data could not be parsed.
+     */
+    static int addFont(const std::string &name, const unsigned char *data, size_t size);
+
+    /// Return the handle of the face with the given name, or -1 if it is unknown
+    static int findFont(const std::string &name);
+
+    /// Return the name of a face
+    static std::string fontName(int font);
+
+    /// Return a 64 bit hash of the font data of a face (computed on first use)
+    static uint64_t fontHash(int font);
+
+    /// Return the default ratio between framebuffer pixels and logical pixels, which is used for rounding when no ratio is given
+    static float pixelRatio();
+
+    /// Set the default ratio between framebuffer pixels and logical pixels (1 unless changed, e.g. for headless layouts)
+    static void setPixelRatio(float ratio);
+
+    /// Return the pixel ratio registered for a NanoVG context, or the default ratio if there is none
+    static float pixelRatio(NVGcontext *ctx);
+
+    /// Register the pixel ratio of a NanoVG context (each \ref Screen keeps its own up to date); 0 removes it
+    static void setPixelRatio(NVGcontext *ctx, float ratio);
+
+    /// Return the maximum number of cached measurements (default: 4096)
+    static size_t cacheCapacity();
+
+    /// Set the maximum number of cached measurements (0 disables the cache)
+    static void setCacheCapacity(size_t capacity);
+
+    /// Remove all cached measurements
+    static void clearCache();
+
+    /// Return how many measurements were answered from the cache
+    static uint64_t cacheHits();
+
+    /// Return how many measurements were not found in the cache
+    static uint64_t cacheMisses();
+
+    /// Reset the hit and miss counters
+    static void resetCacheStatistics();
+
+    /**
+     * \brief Return the horizontal advance of a string (like the return
+     * value of \c nvgTextBounds).
+     *
+     * \param end
+     *     End of the string, or \c nullptr if the string is null-terminated
+     */
+    static float textWidth(int font, float size, const char *string,
+                           const char *end = nullptr, float letterSpacing = 0.f,
+                           float pixelRatio = 0.f);
+
+    /**
+     * \brief Compute the bounding box of a string drawn at the origin with
+     * left/baseline alignment (like \c nvgTextBounds).
+     *
+     * The box is stored as <tt>[xmin, ymin, xmax, ymax]</tt> in \c bounds;
+     * its height is the line height. Returns the horizontal advance.
+     */
+    static float textBounds(int font, float size, const char *string,
+                            const char *end, float *bounds,
+                            float letterSpacing = 0.f, float pixelRatio = 0.f);
+
+    /**
+     * \brief Compute the positions of all glyphs of a string (like
+     * \c nvgTextGlyphPositions, but without a limit on the count).
+     *
+     * The positions are relative to the start of the string and are not
+     * cached. Returns the horizontal advance.
+     */
+    static float glyphPositions(int font, float size, const char *string,
+                                const char *end, std::vector<GlyphPosition> &positions,
+                                float letterSpacing = 0.f, float pixelRatio = 0.f);
+
+    /**
+     * \brief Snap a font size to a geometric series of sizes in framebuffer
+     * pixels (at the given pixel ratio, or the default one if it is 0).
+     *
+     * NanoVG rasterizes the glyphs of every distinct size (in steps of 0.1
+     * framebuffer pixels) into its atlas. Text whose size follows a zoom
+     * factor should be drawn at a snapped size, so that zooming reuses a
+     * bounded set of rasterized glyphs. Sizes differ by at most half a
+     * step (about 4.4% with the default of 8 steps per octave) plus the
+     * rounding to 0.1 pixels.
+     */
+    static float quantizeFontSize(float size, int stepsPerOctave = 8, float pixelRatio = 0.f);
+
+    /// Return the ascender, descender and line height of a face (like \c nvgTextMetrics)
+    static void verticalMetrics(int font, float size, float *ascender,
+                                float *descender, float *lineHeight,
+                                float pixelRatio = 0.f);
+
+    /**
+     * \brief Return the advance of \c text in the given face.
+     *
+     * Falls back to NanoVG (which changes the font state of \c ctx) if the
+     * face is not known to TextMetrics. The fallback holds a \ref LayoutLock.
+     */
+    static float textWidth(NVGcontext *ctx, const std::string &face,
+                           float size, const std::string &text);
+
+    /**
+     * \brief Compute the bounds of \c text in the given face.
+     *
+     * Falls back to NanoVG (which changes the font state of \c ctx) if the
+     * face is not known to TextMetrics. The fallback holds a \ref LayoutLock.
+     */
+    static float textBounds(NVGcontext *ctx, const std::string &face,
+                            float size, const std::string &text, float *bounds);
+
+    /**
+     * \brief Compute the glyph positions of \c text in the given face.
+     *
+     * Falls back to NanoVG (which changes the font state of \c ctx) if the
+     * face is not known to TextMetrics. The fallback holds a \ref LayoutLock.
+     */
+    static float glyphPositions(NVGcontext *ctx, const std::string &face, float size,
+                                const std::string &text,
+                                std::vector<GlyphPosition> &positions);
+};
+
+NAMESPACE_END(nanogui)
@@ -0,0 +1,142 @@
+/*
+    nanogui/tiledimage.h -- Images that are split into a pyramid of tiles,
+    for displaying images larger than a texture in an ImageView
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/object.h>
+#include <mutex>
+#include <vector>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class TiledImage tiledimage.h nanogui/tiledimage.h
+ *
+ * \brief Data source of an image that an \ref ImageView loads tile by tile.
+ *
+ * The image is split into a mip pyramid: level 0 has the full resolution,
+ * and each further level halves the size of the previous one (rounding up)
+ * until the whole image fits into a single tile. Every level is divided
+ * into square tiles of \ref tileSize() pixels.
+ *
+ * The \ref ImageView only requests the tiles of the level that matches its
+ * zoom factor and that intersect the visible region. It calls
+ * \ref readTile() on loader threads, concurrently with the UI thread and
+ * with itself, so implementations must allow concurrent reads.
+ */
+class NANOGUI_EXPORT TiledImage : public Object {
+public:
+    TiledImage(const Vector2i &size, int tileSize = 256);
+
+    /// Return the size of the image at full resolution
+    const Vector2i &size() const { return mSize; }
+
+    /// Return the width and height of a tile in pixels
+    int tileSize() const { return mTileSize; }
+
+    /// Return the number of levels of the pyramid
+    int levelCount() const { return mLevelCount; }
+
+    /// Return the size of the image at the given level
+    Vector2i levelSize(int level) const;
+
+    /// Return the number of tiles in each direction at the given level
+    Vector2i tileCount(int level) const;
+
+    /// Return the number of valid pixels of a tile, which is smaller than the tile size at the right and bottom edges
+    Vector2i tilePixels(int level, const Vector2i &tile) const;
+
+    /**
+     * \brief Read the pixels of a tile.
+     *
+     * \c pixels has room for a full tile of RGBA pixels with 8 bits per
+     * channel, stored row by row. Only the valid pixels reported by
+     * \ref tilePixels() are used, and rows are always \ref tileSize()
+     * pixels apart. Return \c false if the tile could not be read.
+     */
+    virtual bool readTile(int level, const Vector2i &tile, uint8_t *pixels) const = 0;
+
+protected:
+    Vector2i mSize;
+    int mTileSize;
+    int mLevelCount;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/**
+ * \class MemoryTiledImage tiledimage.h nanogui/tiledimage.h
+ *
+ * \brief Tiled image whose pixels are stored in memory.
+ *
+ * The coarser levels of the pyramid are computed by averaging blocks of
+ * 2x2 pixels when they are first needed.
+ */
+class NANOGUI_EXPORT MemoryTiledImage : public TiledImage {
+public:
+    /// Take over \c pixels, which holds the RGBA pixels of the image at full resolution, row by row
+    MemoryTiledImage(const Vector2i &size, std::vector<uint8_t> pixels, int tileSize = 256);
+
+    virtual bool readTile(int level, const Vector2i &tile, uint8_t *pixels) const override;
+
+protected:
+    /// Return the pixels of a level, computing it and the levels above it if needed
+    const std::vector<uint8_t> &level(int level) const;
+
+protected:
+    mutable std::vector<std::vector<uint8_t>> mLevels;
+    /// Guards the computation of each level (except for level 0)
+    mutable std::vector<std::once_flag> mLevelFlags;
+};
+
+/**
+ * \class FileTiledImage tiledimage.h nanogui/tiledimage.h
+ *
+ * \brief Tiled image stored in a pyramid file that is memory-mapped.
+ *
+ * The file holds the uncompressed tiles of all levels, so reading a tile is
+ * a copy from the mapping, and the operating system only reads the parts of
+ * the file that are shown. Such files are created with \ref write() from any
+ * other tiled image, e.g. a \ref MemoryTiledImage or an implementation that
+ * decodes a large image format piece by piece.
+ */
+class NANOGUI_EXPORT FileTiledImage : public TiledImage {
+public:
+    /// Memory-map the given pyramid file, or throw \c std::runtime_error if it is invalid
+    explicit FileTiledImage(const std::string &filename);
+
+    ~FileTiledImage();
+
+    FileTiledImage(const FileTiledImage &) = delete;
+    FileTiledImage &operator=(const FileTiledImage &) = delete;
+
+    virtual bool readTile(int level, const Vector2i &tile, uint8_t *pixels) const override;
+
+    /// Write all tiles of \c image to a pyramid file, one tile at a time
+    static void write(const std::string &filename, const TiledImage &image);
+
+protected:
+    /// Map a file whose header holds the given width, height and tile size
+    FileTiledImage(const std::string &filename, const Vector3i &header);
+
+    /// Return the offset of a tile in the file
+    uint64_t tileOffset(int level, const Vector2i &tile) const;
+
+protected:
+    const uint8_t *mData;
+    size_t mSize;
+    /// Platform-specific mapping handle
+    void *mMapping;
+};
+
+NAMESPACE_END(nanogui)
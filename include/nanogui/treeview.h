@@ -0,0 +1,211 @@
+/*
+    nanogui/treeview.h -- Virtualized tree which only queries the nodes
+    that are expanded and visible
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+/** \file */
+
+#pragma once
+
+#include <nanogui/widget.h>
+#include <functional>
+#include <memory>
+
+NAMESPACE_BEGIN(nanogui)
+
+/**
+ * \class TreeModel treeview.h nanogui/treeview.h
+ *
+ * \brief Data source of a \ref TreeView.
+ *
+ * Nodes are identified by opaque 64 bit identifiers chosen by the model
+ * (e.g. an index into a node array, or a pointer). The invisible root node
+ * has the identifier 0. The tree view only asks for the children of nodes
+ * that the user has expanded, and only for the text of visible rows.
+ */
+class NANOGUI_EXPORT TreeModel : public Object {
+public:
+    /// Return the number of children of the given node
+    virtual int childCount(uint64_t node) const = 0;
+
+    /// Return the identifier of the child of \c node at position \c index
+    virtual uint64_t child(uint64_t node, int index) const = 0;
+
+    /// Return the text of the given node
+    virtual std::string text(uint64_t node) const = 0;
+
+    /// Return the icon of the given node (0 means no icon)
+    virtual int icon(uint64_t node) const;
+
+    /**
+     * \brief Return whether the given node can be expanded.
+     *
+     * The default implementation calls \ref childCount(). Models where
+     * counting children is expensive (e.g. directories) should override this.
+     */
+    virtual bool hasChildren(uint64_t node) const;
+
+protected:
+    virtual ~TreeModel() { }
+};
+
+/**
+ * \class TreeView treeview.h nanogui/treeview.h
+ *
+ * \brief Scrollable tree of fixed-height rows backed by a \ref TreeModel.
+ *
+ * The view does not mirror the tree. It only stores the nodes that are
+ * expanded, together with the number of visible rows below each of them,
+ * so the memory usage is independent of the size of the tree. Mapping a row
+ * index to a node takes a binary search per level of expanded ancestors,
+ * and rows are drawn directly with NanoVG.
+ */
+class NANOGUI_EXPORT TreeView : public Widget {
+public:
+    TreeView(Widget *parent);
+    virtual ~TreeView();
+
+    /// Return the data model
+    TreeModel *model() { return mModel; }
+    /// Return the data model
+    const TreeModel *model() const { return mModel.get(); }
+    /// Set the data model (collapses all nodes)
+    void setModel(TreeModel *model);
+
+    /**
+     * \brief Notify the view that the structure of the model has changed.
+     *
+     * Expanded nodes stay expanded as long as they can still be found at the
+     * same position below their parent.
+     */
+    void modelChanged();
+
+    /// Return the height of each row in pixels
+    int rowHeight() const { return mRowHeight; }
+    /// Set the height of each row in pixels
+    void setRowHeight(int rowHeight) { mRowHeight = std::max(rowHeight, 1); }
+
+    /// Return the horizontal indentation per tree level in pixels
+    int indent() const { return mIndent; }
+    /// Set the horizontal indentation per tree level in pixels
+    void setIndent(int indent) { mIndent = indent; }
+
+    /// Return the number of visible rows
+    int rowCount() const;
+
+    /// Return the node shown in the given row
+    uint64_t node(int row) const { return lookup(row).node; }
+
+    /// Return the depth of the node shown in the given row (0 for children of the root)
+    int depth(int row) const { return lookup(row).depth; }
+
+    /// Return the row of the parent of the node shown in the given row (-1 for children of the root)
+    int parentRow(int row) const { return lookup(row).parentRow; }
+
+    /// Return whether the node shown in the given row is expanded
+    bool expanded(int row) const { return lookup(row).expanded != nullptr; }
+
+    /// Expand or collapse the node shown in the given row
+    void setExpanded(int row, bool expanded);
+
+    /// Collapse all nodes
+    void collapseAll();
+
+    /// Return the selected row (or -1 if there is none)
+    int selectedRow() const { return mSelectedRow; }
+    /// Set the selected row (-1 clears the selection)
+    void setSelectedRow(int row) { mSelectedRow = row; }
+
+    /// Return the callback that is invoked with the node when the user selects a row
+    std::function<void(uint64_t)> callback() const { return mCallback; }
+    /// Set the callback that is invoked with the node when the user selects a row
+    void setCallback(const std::function<void(uint64_t)> &callback) { mCallback = callback; }
+
+    /// Return the current scroll amount as a value between 0 and 1. 0 means scrolled to the top and 1 to the bottom.
+    float scroll() const { return (float) mScroll; }
+    /// Set the scroll amount to a value between 0 and 1. 0 means scrolled to the top and 1 to the bottom.
+    void setScroll(float scroll) { mScroll = std::max(0.f, std::min(1.f, scroll)); }
+
+    /// Scroll the minimal amount that is needed to make the given row visible
+    void scrollToRow(int row);
+
+    /// Return the row at the given position (relative to the parent), or -1
+    int rowAt(const Vector2i &p) const;
+
+    virtual Vector2i preferredSize(NVGcontext *ctx) const override;
+    virtual bool mouseButtonEvent(const Vector2i &p, int button, bool down, int modifiers) override;
+    virtual bool mouseDragEvent(const Vector2i &p, const Vector2i &rel, int button, int modifiers) override;
+    virtual bool scrollEvent(const Vector2i &p, const Vector2f &rel) override;
+    virtual bool keyboardEvent(int key, int scancode, int action, int modifiers) override;
+    virtual void draw(NVGcontext *ctx) override;
+    virtual void save(Serializer &s) const override;
+    virtual bool load(Serializer &s) override;
+
+protected:
+    /// Bookkeeping for an expanded node
+    struct ExpandedNode {
+        uint64_t node;
+        /// Position below the parent node
+        int index;
+        int childCount;
+        /// Number of visible rows below this node
+        int rowCount;
+        ExpandedNode *parent;
+        /// Expanded children, sorted by \c index
+        std::vector<std::unique_ptr<ExpandedNode>> children;
+        /// Rows contributed by the expanded children that precede each entry of \c children
+        std::vector<int> offsets;
+    };
+
+    /// Result of looking up a row
+    struct Row {
+        uint64_t node = 0;
+        int depth = -1;
+        int parentRow = -1;
+        int index = -1;
+        /// Bookkeeping of the parent node
+        ExpandedNode *parent = nullptr;
+        /// Bookkeeping of the node itself if it is expanded, otherwise \c nullptr
+        ExpandedNode *expanded = nullptr;
+    };
+
+    /// Find the node that is shown in the given row
+    Row lookup(int row) const;
+
+    /// Recompute the row counts of the given node and its ancestors
+    void updateCounts(ExpandedNode *node);
+
+    /// Drop expanded children which are no longer found in the model (returns the updated row count)
+    int validate(ExpandedNode *node);
+
+    /// Total height of all rows in pixels
+    double contentHeight() const { return (double) rowCount() * mRowHeight; }
+
+    /// Distance in pixels between the top of the first row and the top of the view
+    double scrollOffset() const {
+        return mScroll * std::max(0.0, contentHeight() - mSize.y());
+    }
+
+    /// Select a row and invoke the callback
+    void selectRow(int row);
+
+protected:
+    ref<TreeModel> mModel;
+    std::unique_ptr<ExpandedNode> mRoot;
+    int mRowHeight;
+    int mIndent;
+    int mSelectedRow;
+    double mScroll;
+    double mLastClick;
+    std::function<void(uint64_t)> mCallback;
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+NAMESPACE_END(nanogui)
@@ -30,7 +30,12 @@ public:
     /// Return the current scroll amount as a value between 0 and 1. 0 means scrolled to the top and 1 to the bottom.
     float scroll() const { return mScroll; }
     /// Set the scroll amount to a value between 0 and 1. 0 means scrolled to the top and 1 to the bottom.
-    void setScroll(float scroll) { mScroll = scroll; }
+    void setScroll(float scroll) { mScroll = mScrollTarget = scroll; }
+
+    /// Return whether mouse wheel scrolling is animated
+    bool smoothScrolling() const { return mSmoothScrolling; }
+    /// Set whether mouse wheel scrolling is animated
+    void setSmoothScrolling(bool smooth) { mSmoothScrolling = smooth; }
 
     virtual void performLayout(NVGcontext *ctx) override;
     virtual Vector2i preferredSize(NVGcontext *ctx) const override;
@@ -39,9 +44,21 @@ public:
     virtual void draw(NVGcontext *ctx) override;
     virtual void save(Serializer &s) const override;
     virtual bool load(Serializer &s) override;
+protected:
+    /// Measure the child and place it according to the current scroll amount
+    void layoutChild(NVGcontext *ctx);
+
+    /// Scroll offset of the child in pixels for the current scroll amount
+    int childOffset() const {
+        return (int) (-mScroll * std::max(0, mChildPreferredHeight - mSize.y()));
+    }
+
 protected:
     int mChildPreferredHeight;
     float mScroll;
+    float mScrollTarget;
+    double mLastFrame;
+    bool mSmoothScrolling;
     bool mUpdateLayout;
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -14,6 +14,7 @@
 
 #include <nanogui/object.h>
 #include <nanogui/theme.h>
+#include <functional>
 #include <vector>
 
 NAMESPACE_BEGIN(nanogui)
@@ -46,7 +47,7 @@ public:
     /// Return the used \ref Layout generator
     const Layout *layout() const { return mLayout.get(); }
     /// Set the used \ref Layout generator
-    void setLayout(Layout *layout) { mLayout = layout; }
+    void setLayout(Layout *layout);
 
     /// Return the \ref Theme used to draw this widget
     Theme *theme() { return mTheme; }
@@ -90,7 +91,7 @@ public:
      * size; this is done with a call to \ref setSize or a call to \ref performLayout()
      * in the parent widget.
      */
-    void setFixedSize(const Vector2i &fixedSize) { mFixedSize = fixedSize; }
+    void setFixedSize(const Vector2i &fixedSize) { invalidateLayout(); mFixedSize = fixedSize; }
 
     /// Return the fixed size (see \ref setFixedSize())
     const Vector2i &fixedSize() const { return mFixedSize; }
@@ -100,14 +101,21 @@ public:
     // Return the fixed height (see \ref setFixedSize())
     int fixedHeight() const { return mFixedSize.y(); }
     /// Set the fixed width (see \ref setFixedSize())
-    void setFixedWidth(int width) { mFixedSize.x() = width; }
+    void setFixedWidth(int width) { invalidateLayout(); mFixedSize.x() = width; }
     /// Set the fixed height (see \ref setFixedSize())
-    void setFixedHeight(int height) { mFixedSize.y() = height; }
+    void setFixedHeight(int height) { invalidateLayout(); mFixedSize.y() = height; }
 
     /// Return whether or not the widget is currently visible (assuming all parents are visible)
     bool visible() const { return mVisible; }
     /// Set whether or not the widget is currently visible (assuming all parents are visible)
-    void setVisible(bool visible) { mVisible = visible; }
+    void setVisible(bool visible) {
+        if (visible == mVisible)
+            return;
+        mVisible = visible;
+        /* Only the layout of the parent depends on the visibility */
+        if (mParent)
+            mParent->invalidateLayout();
+    }
 
     /// Check if this widget is currently visible, taking parent widgets into account
     bool visibleRecursive() const {
@@ -166,6 +174,9 @@ public:
     /// Walk up the hierarchy and return the parent screen
     Screen *screen();
 
+    /// Return the pixel ratio of the parent screen (or the default ratio of \ref TextMetrics if there is none)
+    float pixelRatio() const;
+
     /// Associate this widget with an ID value (optional)
     void setId(const std::string &id) { mId = id; }
     /// Return the ID value associated with this widget, if any
@@ -189,7 +200,7 @@ public:
     /// Return current font size. If not set the default of the current theme will be returned
     int fontSize() const;
     /// Set the font size of this widget
-    void setFontSize(int fontSize) { mFontSize = fontSize; }
+    void setFontSize(int fontSize) { mFontSize = fontSize; invalidateLayout(); }
     /// Return whether the font size is explicitly specified for this widget
     bool hasFontSize() const { return mFontSize > 0; }
 
@@ -203,7 +214,7 @@ public:
      * Sets the amount of extra scaling applied to *icon* fonts.
      * See \ref nanogui::Widget::mIconExtraScale.
      */
-    void setIconExtraScale(float scale) { mIconExtraScale = scale; }
+    void setIconExtraScale(float scale) { mIconExtraScale = scale; invalidateLayout(); }
 
     /// Return a pointer to the cursor of the widget
     Cursor cursor() const { return mCursor; }
@@ -246,6 +257,73 @@ public:
     /// Compute the preferred size of the widget
     virtual Vector2i preferredSize(NVGcontext *ctx) const;
 
+    /**
+     * \brief Return the preferred size of the widget, reusing the result of
+     * the previous call until \ref invalidateLayout() is invoked.
+     *
+     * Layout generators use this function to measure child widgets, so that
+     * every widget is measured at most once per layout pass. Widgets whose
+     * preferred size depends on state other than their caption, font size,
+     * fixed size, theme, layout and visible children must call
+     * \ref invalidateLayout() when that state changes. The current size,
+     * which is the preferred size of widgets without a layout, is never
+     * cached.
+     */
+    Vector2i cachedPreferredSize(NVGcontext *ctx) const;
+
+    /**
+     * \brief Discard the cached preferred size of this widget and of all
+     * of its parents, and schedule the widget for \ref updateLayout().
+     *
+     * This is called automatically when the caption, font size, fixed size,
+     * theme, layout, visibility or list of children of a widget changes, and
+     * when a parameter of its layout changes (see \ref Layout::invalidate()).
+     */
+    void invalidateLayout();
+
+    /**
+     * \brief Lay out the parts of the widget hierarchy below this widget
+     * whose layout was invalidated.
+     *
+     * For every widget that called \ref invalidateLayout(), only the subtree
+     * of its nearest ancestor whose size (i.e. the preferred size with the
+     * fixed size applied) did not change is laid out again. Children of the
+     * root widget (the windows of a \ref Screen) whose size changed are
+     * resized to their preferred size. \ref Screen invokes this function
+     * once per frame before drawing.
+     */
+    void updateLayout(NVGcontext *ctx);
+
+    /// Return whether the cached preferred size (see \ref cachedPreferredSize()) is up to date
+    bool layoutValid() const { return mPreferredSizeValid; }
+
+    /// Return whether this widget or one of its descendants awaits \ref updateLayout()
+    bool layoutPending() const { return mSubtreeDirty; }
+
+    /// Return the number of \ref preferredSize() evaluations done by \ref cachedPreferredSize() so far
+    static size_t measureCount();
+
+    /// Reset the counter returned by \ref measureCount() to zero
+    static void resetMeasureCount();
+
+    /**
+     * \brief Set the number of threads used to lay out independent subtrees
+     * (the windows of a \ref Screen and the tabs of a \ref TabWidget).
+     *
+     * The default of 1 lays out everything on the calling thread, and 0 uses
+     * one thread per hardware core. Text in the faces known to
+     * \ref TextMetrics is measured concurrently; only measurements which
+     * fall back to the NanoVG context (other faces and wrapped \ref Label
+     * captions) are serialized by \ref LayoutLock. A \ref Layout instance
+     * must not be shared between subtrees that are laid out concurrently.
+     * The worker threads are started on first use and joined by
+     * \ref nanogui::shutdown().
+     */
+    static void setLayoutThreads(int threads);
+
+    /// Return the number of threads used to lay out independent subtrees (see \ref setLayoutThreads())
+    static int layoutThreads();
+
     /// Invoke the associated layout generator to properly place child widgets, if any
     virtual void performLayout(NVGcontext *ctx);
 
@@ -262,6 +340,33 @@ protected:
     /// Free all resources used by the widget and any children
     virtual ~Widget();
 
+    /**
+     * \brief Discard the cached preferred size and mark this widget as
+     * awaiting \ref updateLayout().
+     *
+     * Invoked by \ref invalidateLayout() on the widget and then on each of
+     * its parents.
+     */
+    virtual void markLayoutDirty();
+
+    /// Clear the layout flags of this widget and its descendants before they are laid out
+    void clearLayoutDirty();
+
+    /// Return the size requested from the layout of the parent (the preferred size with the fixed size applied)
+    Vector2i layoutSize(NVGcontext *ctx) const;
+
+    /**
+     * \brief Invoke \c func on each of the given widgets, distributing them
+     * over the calling thread and up to \ref layoutThreads() - 1 threads of
+     * a persistent worker pool.
+     *
+     * The widgets must be roots of disjoint subtrees. The function returns
+     * once all invocations have finished, and rethrows the first exception
+     * raised by one of them. Calls from a worker thread run serially.
+     */
+    static void forEachParallel(const std::vector<Widget *> &widgets,
+                                const std::function<void(Widget *)> &func);
+
     /**
      * Convenience definition for subclasses to get the full icon scale for this
      * class of Widget.  It simple returns the value
@@ -335,8 +440,46 @@ protected:
      */
     float mIconExtraScale;
     Cursor mCursor;
+
+    /// The preferred size that was computed by the last call to \ref cachedPreferredSize()
+    mutable Vector2i mPreferredSize;
+    /// Whether \ref mPreferredSize is up to date
+    mutable bool mPreferredSizeValid;
+    /// Set when \ref preferredSize() returned the current size, which is not cached
+    mutable bool mPreferredSizeIsSize;
+    /// Result of \ref layoutSize() when the widget was last laid out (-1 if unknown)
+    Vector2i mLastLayoutSize;
+    /// Whether this widget invoked \ref invalidateLayout() since it was last laid out
+    bool mLayoutDirty;
+    /// Whether this widget or one of its descendants invoked \ref invalidateLayout() since it was last laid out
+    bool mSubtreeDirty;
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
+/**
+ * \class LayoutLock widget.h nanogui/widget.h
+ *
+ * \brief Scoped lock which serializes access to shared state while layouts
+ * run on several threads (see \ref Widget::setLayoutThreads()).
+ *
+ * Shared state includes the NanoVG context and the widgets above the
+ * subtrees that are laid out concurrently. The lock is recursive, and free
+ * when no parallel layout is in progress. \ref Widget::invalidateLayout(),
+ * the NanoVG fallbacks of \ref TextMetrics and the line breaking of
+ * \ref Label hold it. Implementations of \ref Widget::preferredSize() and
+ * \ref Widget::performLayout() which use the NanoVG context directly must
+ * acquire it as well.
+ */
+class NANOGUI_EXPORT LayoutLock {
+public:
+    LayoutLock();
+    ~LayoutLock();
+
+    LayoutLock(const LayoutLock &) = delete;
+    LayoutLock &operator=(const LayoutLock &) = delete;
+private:
+    bool mLocked;
+};
+
 NAMESPACE_END(nanogui)
@@ -29,7 +29,7 @@ public:
     /// Return the window title
     const std::string &title() const { return mTitle; }
     /// Set the window title
-    void setTitle(const std::string &title) { mTitle = title; }
+    void setTitle(const std::string &title) { mTitle = title; invalidateLayout(); }
 
     /// Is this a model dialog?
     bool modal() const { return mModal; }
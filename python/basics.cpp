@@ -6,10 +6,63 @@ DECLARE_WIDGET(Label);
 DECLARE_WIDGET(Popup);
 DECLARE_WIDGET(MessageDialog);
 DECLARE_WIDGET(VScrollPanel);
+DECLARE_WIDGET(ListView);
+DECLARE_WIDGET(LogView);
+DECLARE_WIDGET(TableView);
+DECLARE_WIDGET(TreeView);
 DECLARE_WIDGET(ComboBox);
 DECLARE_WIDGET(ProgressBar);
 DECLARE_WIDGET(Slider);
 
+class PyTableModel : public TableModel {
+public:
+    using TableModel::TableModel;
+    int rowCount() const override {
+        PYBIND11_OVERLOAD_PURE(int, TableModel, rowCount);
+    }
+    int columnCount() const override {
+        PYBIND11_OVERLOAD_PURE(int, TableModel, columnCount);
+    }
+    std::string text(int row, int column) const override {
+        PYBIND11_OVERLOAD_PURE(std::string, TableModel, text, row, column);
+    }
+    std::string headerText(int column) const override {
+        PYBIND11_OVERLOAD(std::string, TableModel, headerText, column);
+    }
+    bool editable(int row, int column) const override {
+        PYBIND11_OVERLOAD(bool, TableModel, editable, row, column);
+    }
+    bool setText(int row, int column, const std::string &value) override {
+        PYBIND11_OVERLOAD(bool, TableModel, setText, row, column, value);
+    }
+    bool lessThan(int column, int rowA, int rowB) const override {
+        PYBIND11_OVERLOAD(bool, TableModel, lessThan, column, rowA, rowB);
+    }
+    bool accept(int row, const std::string &filter) const override {
+        PYBIND11_OVERLOAD(bool, TableModel, accept, row, filter);
+    }
+};
+
+class PyTreeModel : public TreeModel {
+public:
+    using TreeModel::TreeModel;
+    int childCount(uint64_t node) const override {
+        PYBIND11_OVERLOAD_PURE(int, TreeModel, childCount, node);
+    }
+    uint64_t child(uint64_t node, int index) const override {
+        PYBIND11_OVERLOAD_PURE(uint64_t, TreeModel, child, node, index);
+    }
+    std::string text(uint64_t node) const override {
+        PYBIND11_OVERLOAD_PURE(std::string, TreeModel, text, node);
+    }
+    int icon(uint64_t node) const override {
+        PYBIND11_OVERLOAD(int, TreeModel, icon, node);
+    }
+    bool hasChildren(uint64_t node) const override {
+        PYBIND11_OVERLOAD(bool, TreeModel, hasChildren, node);
+    }
+};
+
 void register_basics(py::module &m) {
     py::class_<Label, Widget, ref<Label>, PyLabel>(m, "Label", D(Label))
         .def(py::init<Widget *, const std::string &, const std::string &, int>(),
@@ -60,7 +113,145 @@ void register_basics(py::module &m) {
     py::class_<VScrollPanel, Widget, ref<VScrollPanel>, PyVScrollPanel>(m, "VScrollPanel", D(VScrollPanel))
         .def(py::init<Widget *>(), py::arg("parent"), D(VScrollPanel, VScrollPanel))
         .def("scroll", &VScrollPanel::scroll, D(VScrollPanel, scroll))
-        .def("setScroll", &VScrollPanel::setScroll, D(VScrollPanel, setScroll));
+        .def("setScroll", &VScrollPanel::setScroll, D(VScrollPanel, setScroll))
+        .def("smoothScrolling", &VScrollPanel::smoothScrolling, D(VScrollPanel, smoothScrolling))
+        .def("setSmoothScrolling", &VScrollPanel::setSmoothScrolling, D(VScrollPanel, setSmoothScrolling));
+
+    py::class_<ListView, Widget, ref<ListView>, PyListView>(m, "ListView", D(ListView))
+        .def(py::init<Widget *>(), py::arg("parent"), D(ListView, ListView))
+        .def("rowCount", &ListView::rowCount, D(ListView, rowCount))
+        .def("setRowCount", &ListView::setRowCount, D(ListView, setRowCount))
+        .def("rowHeight", &ListView::rowHeight, D(ListView, rowHeight))
+        .def("setRowHeight", &ListView::setRowHeight, D(ListView, setRowHeight))
+        .def("overscan", &ListView::overscan, D(ListView, overscan))
+        .def("setOverscan", &ListView::setOverscan, D(ListView, setOverscan))
+        .def("createCallback", &ListView::createCallback, D(ListView, createCallback))
+        .def("setCreateCallback", &ListView::setCreateCallback, D(ListView, setCreateCallback))
+        .def("bindCallback", &ListView::bindCallback, D(ListView, bindCallback))
+        .def("setBindCallback", &ListView::setBindCallback, D(ListView, setBindCallback))
+        .def("selectedIndex", &ListView::selectedIndex, D(ListView, selectedIndex))
+        .def("setSelectedIndex", &ListView::setSelectedIndex, D(ListView, setSelectedIndex))
+        .def("callback", &ListView::callback, D(ListView, callback))
+        .def("setCallback", &ListView::setCallback, D(ListView, setCallback))
+        .def("scroll", &ListView::scroll, D(ListView, scroll))
+        .def("setScroll", &ListView::setScroll, D(ListView, setScroll))
+        .def("scrollToRow", &ListView::scrollToRow, D(ListView, scrollToRow))
+        .def("refresh", &ListView::refresh, D(ListView, refresh))
+        .def("realizedRange", &ListView::realizedRange, D(ListView, realizedRange))
+        .def("rowWidget", &ListView::rowWidget, D(ListView, rowWidget))
+        .def("rowAt", &ListView::rowAt, D(ListView, rowAt));
+
+    py::class_<LogView, Widget, ref<LogView>, PyLogView> logView(m, "LogView", D(LogView));
+    logView
+        .def(py::init<Widget *, size_t>(), py::arg("parent"), py::arg("capacity") = 10000, D(LogView, LogView))
+        .def("append", &LogView::append, py::arg("text"), py::arg("level") = LogView::Level::Info, D(LogView, append))
+        .def("clear", &LogView::clear, D(LogView, clear))
+        .def("capacity", &LogView::capacity, D(LogView, capacity))
+        .def("setCapacity", &LogView::setCapacity, D(LogView, setCapacity))
+        .def("totalLines", &LogView::totalLines, D(LogView, totalLines))
+        .def("lineCount", &LogView::lineCount, D(LogView, lineCount))
+        .def("lineText", &LogView::lineText, D(LogView, lineText))
+        .def("lineLevel", &LogView::lineLevel, D(LogView, lineLevel))
+        .def("filter", &LogView::filter, D(LogView, filter))
+        .def("setFilter", &LogView::setFilter, D(LogView, setFilter))
+        .def("minimumLevel", &LogView::minimumLevel, D(LogView, minimumLevel))
+        .def("setMinimumLevel", &LogView::setMinimumLevel, D(LogView, setMinimumLevel))
+        .def("levelColor", &LogView::levelColor, D(LogView, levelColor))
+        .def("setLevelColor", &LogView::setLevelColor, D(LogView, setLevelColor))
+        .def("autoScroll", &LogView::autoScroll, D(LogView, autoScroll))
+        .def("setAutoScroll", &LogView::setAutoScroll, D(LogView, setAutoScroll))
+        .def("scrollToBottom", &LogView::scrollToBottom, D(LogView, scrollToBottom))
+        .def("lineHeight", &LogView::lineHeight, D(LogView, lineHeight))
+        .def("update", &LogView::update, D(LogView, update));
+
+    py::enum_<LogView::Level>(logView, "Level", D(LogView, Level))
+        .value("Debug", LogView::Level::Debug)
+        .value("Info", LogView::Level::Info)
+        .value("Warning", LogView::Level::Warning)
+        .value("Error", LogView::Level::Error);
+
+    py::class_<TableModel, ref<TableModel>, PyTableModel>(m, "TableModel", D(TableModel))
+        .def(py::init<>())
+        .def("rowCount", &TableModel::rowCount, D(TableModel, rowCount))
+        .def("columnCount", &TableModel::columnCount, D(TableModel, columnCount))
+        .def("text", &TableModel::text, D(TableModel, text))
+        .def("headerText", &TableModel::headerText, D(TableModel, headerText))
+        .def("editable", &TableModel::editable, D(TableModel, editable))
+        .def("setText", &TableModel::setText, D(TableModel, setText))
+        .def("lessThan", &TableModel::lessThan, D(TableModel, lessThan))
+        .def("accept", &TableModel::accept, D(TableModel, accept));
+
+    py::class_<TableView, Widget, ref<TableView>, PyTableView>(m, "TableView", D(TableView))
+        .def(py::init<Widget *>(), py::arg("parent"), D(TableView, TableView))
+        .def("model", (TableModel *(TableView::*)(void)) &TableView::model, D(TableView, model))
+        .def("setModel", &TableView::setModel, D(TableView, setModel))
+        .def("modelChanged", &TableView::modelChanged, D(TableView, modelChanged))
+        .def("rowHeight", &TableView::rowHeight, D(TableView, rowHeight))
+        .def("setRowHeight", &TableView::setRowHeight, D(TableView, setRowHeight))
+        .def("headerHeight", &TableView::headerHeight, D(TableView, headerHeight))
+        .def("setHeaderHeight", &TableView::setHeaderHeight, D(TableView, setHeaderHeight))
+        .def("defaultColumnWidth", &TableView::defaultColumnWidth, D(TableView, defaultColumnWidth))
+        .def("setDefaultColumnWidth", &TableView::setDefaultColumnWidth, D(TableView, setDefaultColumnWidth))
+        .def("columnWidth", &TableView::columnWidth, D(TableView, columnWidth))
+        .def("setColumnWidth", &TableView::setColumnWidth, D(TableView, setColumnWidth))
+        .def("fixedRowCount", &TableView::fixedRowCount, D(TableView, fixedRowCount))
+        .def("setFixedRowCount", &TableView::setFixedRowCount, D(TableView, setFixedRowCount))
+        .def("fixedColumnCount", &TableView::fixedColumnCount, D(TableView, fixedColumnCount))
+        .def("setFixedColumnCount", &TableView::setFixedColumnCount, D(TableView, setFixedColumnCount))
+        .def("sortColumn", &TableView::sortColumn, D(TableView, sortColumn))
+        .def("sortAscending", &TableView::sortAscending, D(TableView, sortAscending))
+        .def("sortByColumn", &TableView::sortByColumn, py::arg("column"),
+             py::arg("ascending") = true, D(TableView, sortByColumn))
+        .def("filter", &TableView::filter, D(TableView, filter))
+        .def("setFilter", &TableView::setFilter, D(TableView, setFilter))
+        .def("indexPending", &TableView::indexPending, D(TableView, indexPending))
+        .def("rowCount", &TableView::rowCount, D(TableView, rowCount))
+        .def("modelRow", &TableView::modelRow, D(TableView, modelRow))
+        .def("viewRow", &TableView::viewRow, D(TableView, viewRow))
+        .def("selectedRow", &TableView::selectedRow, D(TableView, selectedRow))
+        .def("setSelectedRow", &TableView::setSelectedRow, D(TableView, setSelectedRow))
+        .def("callback", &TableView::callback, D(TableView, callback))
+        .def("setCallback", &TableView::setCallback, D(TableView, setCallback))
+        .def("scrollX", &TableView::scrollX, D(TableView, scrollX))
+        .def("setScrollX", &TableView::setScrollX, D(TableView, setScrollX))
+        .def("scrollY", &TableView::scrollY, D(TableView, scrollY))
+        .def("setScrollY", &TableView::setScrollY, D(TableView, setScrollY))
+        .def("scrollToRow", &TableView::scrollToRow, D(TableView, scrollToRow))
+        .def("cellAt", &TableView::cellAt, D(TableView, cellAt))
+        .def("editCell", &TableView::editCell, D(TableView, editCell));
+
+    py::class_<TreeModel, ref<TreeModel>, PyTreeModel>(m, "TreeModel", D(TreeModel))
+        .def(py::init<>())
+        .def("childCount", &TreeModel::childCount, D(TreeModel, childCount))
+        .def("child", &TreeModel::child, D(TreeModel, child))
+        .def("text", &TreeModel::text, D(TreeModel, text))
+        .def("icon", &TreeModel::icon, D(TreeModel, icon))
+        .def("hasChildren", &TreeModel::hasChildren, D(TreeModel, hasChildren));
+
+    py::class_<TreeView, Widget, ref<TreeView>, PyTreeView>(m, "TreeView", D(TreeView))
+        .def(py::init<Widget *>(), py::arg("parent"), D(TreeView, TreeView))
+        .def("model", (TreeModel *(TreeView::*)(void)) &TreeView::model, D(TreeView, model))
+        .def("setModel", &TreeView::setModel, D(TreeView, setModel))
+        .def("modelChanged", &TreeView::modelChanged, D(TreeView, modelChanged))
+        .def("rowHeight", &TreeView::rowHeight, D(TreeView, rowHeight))
+        .def("setRowHeight", &TreeView::setRowHeight, D(TreeView, setRowHeight))
+        .def("indent", &TreeView::indent, D(TreeView, indent))
+        .def("setIndent", &TreeView::setIndent, D(TreeView, setIndent))
+        .def("rowCount", &TreeView::rowCount, D(TreeView, rowCount))
+        .def("node", &TreeView::node, D(TreeView, node))
+        .def("depth", &TreeView::depth, D(TreeView, depth))
+        .def("parentRow", &TreeView::parentRow, D(TreeView, parentRow))
+        .def("expanded", &TreeView::expanded, D(TreeView, expanded))
+        .def("setExpanded", &TreeView::setExpanded, D(TreeView, setExpanded))
+        .def("collapseAll", &TreeView::collapseAll, D(TreeView, collapseAll))
+        .def("selectedRow", &TreeView::selectedRow, D(TreeView, selectedRow))
+        .def("setSelectedRow", &TreeView::setSelectedRow, D(TreeView, setSelectedRow))
+        .def("callback", &TreeView::callback, D(TreeView, callback))
+        .def("setCallback", &TreeView::setCallback, D(TreeView, setCallback))
+        .def("scroll", &TreeView::scroll, D(TreeView, scroll))
+        .def("setScroll", &TreeView::setScroll, D(TreeView, setScroll))
+        .def("scrollToRow", &TreeView::scrollToRow, D(TreeView, scrollToRow))
+        .def("rowAt", &TreeView::rowAt, D(TreeView, rowAt));
 
     py::class_<ComboBox, Widget, ref<ComboBox>, PyComboBox>(m, "ComboBox", D(ComboBox))
         .def(py::init<Widget *>(), py::arg("parent"), D(ComboBox, ComboBox))
@@ -7,12 +7,15 @@ DECLARE_LAYOUT(GroupLayout);
 DECLARE_LAYOUT(BoxLayout);
 DECLARE_LAYOUT(GridLayout);
 DECLARE_LAYOUT(AdvancedGridLayout);
+DECLARE_LAYOUT(FlexLayout);
+DECLARE_LAYOUT(ConstraintLayout);
 
 void register_layout(py::module &m) {
     py::class_<Layout, ref<Layout>, PyLayout> layout(m, "Layout", D(Layout));
     layout
         .def("preferredSize", &Layout::preferredSize, D(Layout, preferredSize))
-        .def("performLayout", &Layout::performLayout, D(Layout, performLayout));
+        .def("performLayout", &Layout::performLayout, D(Layout, performLayout))
+        .def("invalidate", &Layout::invalidate, D(Layout, invalidate));
 
     py::class_<BoxLayout, Layout, ref<BoxLayout>, PyBoxLayout>(m, "BoxLayout", D(BoxLayout))
         .def(py::init<Orientation, Alignment, int, int>(),
@@ -93,6 +96,104 @@ void register_layout(py::module &m) {
              py::arg("horiz") = Alignment::Fill,
              py::arg("vert") = Alignment::Fill,
              D(AdvancedGridLayout, Anchor, Anchor, 3));
+
+    py::class_<FlexLayout, Layout, ref<FlexLayout>, PyFlexLayout> flexLayout(
+        m, "FlexLayout", D(FlexLayout));
+
+    flexLayout
+        .def(py::init<Orientation, bool, int, int>(),
+             py::arg("orientation") = Orientation::Horizontal,
+             py::arg("wrap") = false, py::arg("margin") = 0,
+             py::arg("spacing") = 0, D(FlexLayout, FlexLayout))
+        .def("orientation", &FlexLayout::orientation, D(FlexLayout, orientation))
+        .def("setOrientation", &FlexLayout::setOrientation, D(FlexLayout, setOrientation))
+        .def("wrap", &FlexLayout::wrap, D(FlexLayout, wrap))
+        .def("setWrap", &FlexLayout::setWrap, D(FlexLayout, setWrap))
+        .def("margin", &FlexLayout::margin, D(FlexLayout, margin))
+        .def("setMargin", &FlexLayout::setMargin, D(FlexLayout, setMargin))
+        .def("spacing", &FlexLayout::spacing, D(FlexLayout, spacing))
+        .def("setSpacing", (void(FlexLayout::*)(int)) &FlexLayout::setSpacing, D(FlexLayout, setSpacing, 2))
+        .def("setSpacing", (void(FlexLayout::*)(int, int)) &FlexLayout::setSpacing, D(FlexLayout, setSpacing))
+        .def("justification", &FlexLayout::justification, D(FlexLayout, justification))
+        .def("setJustification", &FlexLayout::setJustification, D(FlexLayout, setJustification))
+        .def("alignment", &FlexLayout::alignment, D(FlexLayout, alignment))
+        .def("setAlignment", &FlexLayout::setAlignment, D(FlexLayout, setAlignment))
+        .def("setItem", &FlexLayout::setItem, D(FlexLayout, setItem))
+        .def("item", &FlexLayout::item, D(FlexLayout, item));
+
+    py::class_<FlexLayout::Item>(flexLayout, "Item")
+        .def(py::init<float, float, int>(),
+             py::arg("grow") = 0.f, py::arg("shrink") = 1.f,
+             py::arg("basis") = -1, D(FlexLayout, Item, Item))
+        .def_readwrite("grow", &FlexLayout::Item::grow, D(FlexLayout, Item, grow))
+        .def_readwrite("shrink", &FlexLayout::Item::shrink, D(FlexLayout, Item, shrink))
+        .def_readwrite("basis", &FlexLayout::Item::basis, D(FlexLayout, Item, basis));
+    py::class_<ConstraintLayout, Layout, ref<ConstraintLayout>, PyConstraintLayout> constraintLayout(
+        m, "ConstraintLayout", D(ConstraintLayout));
+
+    constraintLayout
+        .def(py::init<int>(), py::arg("margin") = 0, D(ConstraintLayout, ConstraintLayout))
+        .def("margin", &ConstraintLayout::margin, D(ConstraintLayout, margin))
+        .def("setMargin", &ConstraintLayout::setMargin, D(ConstraintLayout, setMargin))
+        .def("sizeStrength", &ConstraintLayout::sizeStrength, D(ConstraintLayout, sizeStrength))
+        .def("setSizeStrength", &ConstraintLayout::setSizeStrength, D(ConstraintLayout, setSizeStrength))
+        .def("newVariable", &ConstraintLayout::newVariable, D(ConstraintLayout, newVariable))
+        .def("left", &ConstraintLayout::left, D(ConstraintLayout, left))
+        .def("top", &ConstraintLayout::top, D(ConstraintLayout, top))
+        .def("width", &ConstraintLayout::width, D(ConstraintLayout, width))
+        .def("height", &ConstraintLayout::height, D(ConstraintLayout, height))
+        .def("right", &ConstraintLayout::right, D(ConstraintLayout, right))
+        .def("bottom", &ConstraintLayout::bottom, D(ConstraintLayout, bottom))
+        .def("centerX", &ConstraintLayout::centerX, D(ConstraintLayout, centerX))
+        .def("centerY", &ConstraintLayout::centerY, D(ConstraintLayout, centerY))
+        .def("containerWidth", &ConstraintLayout::containerWidth, D(ConstraintLayout, containerWidth))
+        .def("containerHeight", &ConstraintLayout::containerHeight, D(ConstraintLayout, containerHeight))
+        .def("addConstraint", &ConstraintLayout::addConstraint, D(ConstraintLayout, addConstraint))
+        .def("removeConstraint", &ConstraintLayout::removeConstraint, D(ConstraintLayout, removeConstraint))
+        .def("removeWidget", &ConstraintLayout::removeWidget, D(ConstraintLayout, removeWidget))
+        .def("value", &ConstraintLayout::value, D(ConstraintLayout, value));
+
+    py::enum_<ConstraintLayout::Strength>(constraintLayout, "Strength", D(ConstraintLayout, Strength))
+        .value("Weak", ConstraintLayout::Strength::Weak)
+        .value("Medium", ConstraintLayout::Strength::Medium)
+        .value("Strong", ConstraintLayout::Strength::Strong)
+        .value("Required", ConstraintLayout::Strength::Required);
+
+    py::enum_<ConstraintLayout::Relation>(constraintLayout, "Relation", D(ConstraintLayout, Relation))
+        .value("LessEqual", ConstraintLayout::Relation::LessEqual)
+        .value("Equal", ConstraintLayout::Relation::Equal)
+        .value("GreaterEqual", ConstraintLayout::Relation::GreaterEqual);
+
+    py::class_<ConstraintLayout::Expression>(constraintLayout, "Expression", D(ConstraintLayout, Expression))
+        .def(py::init<double>(), py::arg("constant") = 0.0, D(ConstraintLayout, Expression, Expression))
+        .def_static("variable", &ConstraintLayout::Expression::variable, D(ConstraintLayout, Expression, variable))
+        .def_readwrite("terms", &ConstraintLayout::Expression::terms, D(ConstraintLayout, Expression, terms))
+        .def_readwrite("constant", &ConstraintLayout::Expression::constant, D(ConstraintLayout, Expression, constant))
+        .def(py::self + py::self)
+        .def(py::self + double())
+        .def(double() + py::self)
+        .def(py::self - py::self)
+        .def(py::self - double())
+        .def(double() - py::self)
+        .def(py::self * double())
+        .def(double() * py::self)
+        .def(-py::self)
+        .def(py::self == py::self)
+        .def(py::self == double())
+        .def(py::self <= py::self)
+        .def(py::self <= double())
+        .def(py::self >= py::self)
+        .def(py::self >= double());
+
+    py::implicitly_convertible<double, ConstraintLayout::Expression>();
+
+    py::class_<ConstraintLayout::Constraint>(constraintLayout, "Constraint", D(ConstraintLayout, Constraint))
+        .def_readwrite("expression", &ConstraintLayout::Constraint::expression)
+        .def_readwrite("relation", &ConstraintLayout::Constraint::relation)
+        .def_readwrite("strength", &ConstraintLayout::Constraint::strength)
+        .def("__or__", [](const ConstraintLayout::Constraint &c, ConstraintLayout::Strength s) {
+            return c | s;
+        });
 }
 
 #endif
@@ -215,6 +215,7 @@ PYBIND11_MODULE(nanogui, m) {
     #endif
     m.def("utf8", [](int c) { return std::string(utf8(c).data()); }, D(utf8));
     m.def("loadImageDirectory", &nanogui::loadImageDirectory, D(loadImageDirectory));
+    m.def("loadImageResource", &nanogui::loadImageResource, D(loadImageResource));
 
     py::enum_<Cursor>(m, "Cursor", D(Cursor))
         .value("Arrow", Cursor::Arrow)
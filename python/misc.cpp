@@ -47,7 +47,14 @@ void register_misc(py::module &m) {
 
     py::class_<ImageView, Widget, ref<ImageView>, PyImageView>(m, "ImageView", D(ImageView))
         .def(py::init<Widget *, GLuint>(), D(ImageView, ImageView))
+        .def(py::init<Widget *, TiledImage *>(), D(ImageView, ImageView, 2))
         .def("bindImage", &ImageView::bindImage, D(ImageView, bindImage))
+        .def("bindTiledImage", &ImageView::bindTiledImage, D(ImageView, bindTiledImage))
+        .def("tiledImage", (TiledImage *(ImageView::*)()) &ImageView::tiledImage, D(ImageView, tiledImage))
+        .def("tileCacheSize", &ImageView::tileCacheSize, D(ImageView, tileCacheSize))
+        .def("setTileCacheSize", &ImageView::setTileCacheSize, D(ImageView, setTileCacheSize))
+        .def("tileUploadsPerFrame", &ImageView::tileUploadsPerFrame, D(ImageView, tileUploadsPerFrame))
+        .def("setTileUploadsPerFrame", &ImageView::setTileUploadsPerFrame, D(ImageView, setTileUploadsPerFrame))
         .def("imageShader", &ImageView::imageShader, D(ImageView, imageShader))
         .def("scaledImageSize", &ImageView::scaledImageSize, D(ImageView, scaledImageSize))
         .def("offset", &ImageView::offset, D(ImageView, offset))
@@ -65,6 +72,19 @@ void register_misc(py::module &m) {
         .def("setPixelInfoThreshold", &ImageView::setPixelInfoThreshold, D(ImageView, setPixelInfoThreshold))
         .def("setPixelInfoCallback", &ImageView::setPixelInfoCallback, D(ImageView, setPixelInfoCallback))
         .def("pixelInfoCallback", &ImageView::pixelInfoCallback, D(ImageView, pixelInfoCallback))
+        .def("setPixelRegionCallback", [](ImageView &v,
+                 const std::function<std::vector<float>(const Vector2i &, const Vector2i &)> &callback,
+                 int channels) {
+                 /* Python callbacks return the values of the region as a flat list */
+                 v.setPixelRegionCallback([callback, channels](const Vector2i &origin, const Vector2i &size,
+                                                               float *values, Color *) {
+                     std::vector<float> result = callback(origin, size);
+                     size_t count = std::min(result.size(), (size_t) size.prod() * channels);
+                     std::copy(result.begin(), result.begin() + count, values);
+                 }, channels);
+             }, py::arg("callback"), py::arg("channels"), D(ImageView, setPixelRegionCallback))
+        .def("pixelRegionChannels", &ImageView::pixelRegionChannels, D(ImageView, pixelRegionChannels))
+        .def("invalidatePixelInfo", &ImageView::invalidatePixelInfo, D(ImageView, invalidatePixelInfo))
         .def("setFontScaleFactor", &ImageView::setFontScaleFactor, D(ImageView, setFontScaleFactor))
         .def("fontScaleFactor", &ImageView::fontScaleFactor, D(ImageView, fontScaleFactor))
         .def("imageCoordinateAt", &ImageView::imageCoordinateAt, D(ImageView, imageCoordinateAt))
@@ -84,8 +104,112 @@ void register_misc(py::module &m) {
         .def(py::init<Widget *>(), py::arg("parent"), D(ImagePanel, ImagePanel))
         .def("images", &ImagePanel::images, D(ImagePanel, images))
         .def("setImages", &ImagePanel::setImages, D(ImagePanel, setImages))
+        .def("imageLoader", (ImageLoader *(ImagePanel::*)()) &ImagePanel::imageLoader, D(ImagePanel, imageLoader))
+        .def("setImageLoader", &ImagePanel::setImageLoader, D(ImagePanel, setImageLoader))
         .def("callback", &ImagePanel::callback, D(ImagePanel, callback))
         .def("setCallback", &ImagePanel::setCallback, D(ImagePanel, setCallback));
+
+    py::class_<ImageLoader, ref<ImageLoader>>(m, "ImageLoader", D(ImageLoader))
+        .def(py::init<NVGcontext *, const std::string &, int>(), py::arg("ctx"),
+             py::arg("path"), py::arg("threads") = 0, D(ImageLoader, ImageLoader))
+        .def("update", &ImageLoader::update, py::arg("maxImages") = 8, D(ImageLoader, update))
+        .def("wait", [](ImageLoader &loader) {
+            py::gil_scoped_release release;
+            loader.wait();
+        }, D(ImageLoader, wait))
+        .def("cancel", &ImageLoader::cancel, D(ImageLoader, cancel))
+        .def("cancelled", &ImageLoader::cancelled, D(ImageLoader, cancelled))
+        .def("fileCount", &ImageLoader::fileCount, D(ImageLoader, fileCount))
+        .def("loadedCount", &ImageLoader::loadedCount, D(ImageLoader, loadedCount))
+        .def("failedCount", &ImageLoader::failedCount, D(ImageLoader, failedCount))
+        .def("progress", &ImageLoader::progress, D(ImageLoader, progress))
+        .def("done", &ImageLoader::done, D(ImageLoader, done));
+
+    py::class_<TextMetrics>(m, "TextMetrics", D(TextMetrics))
+        .def_static("findFont", &TextMetrics::findFont, D(TextMetrics, findFont))
+        .def_static("pixelRatio", (float(*)()) &TextMetrics::pixelRatio, D(TextMetrics, pixelRatio))
+        .def_static("setPixelRatio", (void(*)(float)) &TextMetrics::setPixelRatio, D(TextMetrics, setPixelRatio))
+        .def_static("pixelRatio", (float(*)(NVGcontext *)) &TextMetrics::pixelRatio, D(TextMetrics, pixelRatio, 2))
+        .def_static("setPixelRatio", (void(*)(NVGcontext *, float)) &TextMetrics::setPixelRatio, D(TextMetrics, setPixelRatio, 2))
+        .def_static("cacheCapacity", &TextMetrics::cacheCapacity, D(TextMetrics, cacheCapacity))
+        .def_static("setCacheCapacity", &TextMetrics::setCacheCapacity, D(TextMetrics, setCacheCapacity))
+        .def_static("clearCache", &TextMetrics::clearCache, D(TextMetrics, clearCache))
+        .def_static("cacheHits", &TextMetrics::cacheHits, D(TextMetrics, cacheHits))
+        .def_static("cacheMisses", &TextMetrics::cacheMisses, D(TextMetrics, cacheMisses))
+        .def_static("resetCacheStatistics", &TextMetrics::resetCacheStatistics, D(TextMetrics, resetCacheStatistics))
+        .def_static("textWidth", [](int font, float size, const std::string &text, float letterSpacing, float pixelRatio) {
+            return TextMetrics::textWidth(font, size, text.data(), text.data() + text.size(), letterSpacing, pixelRatio);
+        }, py::arg("font"), py::arg("size"), py::arg("text"), py::arg("letterSpacing") = 0.f,
+           py::arg("pixelRatio") = 0.f, D(TextMetrics, textWidth))
+        .def_static("textBounds", [](int font, float size, const std::string &text, float letterSpacing, float pixelRatio) {
+            float bounds[4];
+            TextMetrics::textBounds(font, size, text.data(), text.data() + text.size(), bounds, letterSpacing, pixelRatio);
+            return std::make_tuple(bounds[0], bounds[1], bounds[2], bounds[3]);
+        }, py::arg("font"), py::arg("size"), py::arg("text"), py::arg("letterSpacing") = 0.f,
+           py::arg("pixelRatio") = 0.f, D(TextMetrics, textBounds))
+        .def_static("glyphPositions", [](int font, float size, const std::string &text, float letterSpacing, float pixelRatio) {
+            std::vector<TextMetrics::GlyphPosition> positions;
+            TextMetrics::glyphPositions(font, size, text.data(), text.data() + text.size(), positions, letterSpacing, pixelRatio);
+            std::vector<std::tuple<size_t, float, float, float>> result;
+            for (const auto &g : positions)
+                result.emplace_back(g.offset, g.x, g.minx, g.maxx);
+            return result;
+        }, py::arg("font"), py::arg("size"), py::arg("text"), py::arg("letterSpacing") = 0.f,
+           py::arg("pixelRatio") = 0.f, D(TextMetrics, glyphPositions))
+        .def_static("quantizeFontSize", &TextMetrics::quantizeFontSize, py::arg("size"),
+                    py::arg("stepsPerOctave") = 8, py::arg("pixelRatio") = 0.f, D(TextMetrics, quantizeFontSize))
+        .def_static("verticalMetrics", [](int font, float size, float pixelRatio) {
+            float ascender, descender, lineHeight;
+            TextMetrics::verticalMetrics(font, size, &ascender, &descender, &lineHeight, pixelRatio);
+            return std::make_tuple(ascender, descender, lineHeight);
+        }, py::arg("font"), py::arg("size"), py::arg("pixelRatio") = 0.f, D(TextMetrics, verticalMetrics))
+        .def_static("fontName", &TextMetrics::fontName, D(TextMetrics, fontName))
+        .def_static("fontHash", &TextMetrics::fontHash, D(TextMetrics, fontHash));
+
+    py::class_<GlyphCache>(m, "GlyphCache", D(GlyphCache))
+        .def_static("recording", &GlyphCache::recording, D(GlyphCache, recording))
+        .def_static("setRecording", &GlyphCache::setRecording, D(GlyphCache, setRecording))
+        .def_static("addGlyphs", (void(*)(const std::string &, float, const std::string &, float)) &GlyphCache::addGlyphs,
+                    py::arg("face"), py::arg("size"), py::arg("text"), py::arg("pixelRatio") = 0.f,
+                    D(GlyphCache, addGlyphs))
+        .def_static("glyphCount", &GlyphCache::glyphCount, D(GlyphCache, glyphCount))
+        .def_static("clear", &GlyphCache::clear, D(GlyphCache, clear))
+        .def_static("load", &GlyphCache::load, D(GlyphCache, load))
+        .def_static("save", &GlyphCache::save, D(GlyphCache, save));
+
+    py::class_<TiledImage, ref<TiledImage>>(m, "TiledImage", D(TiledImage))
+        .def("size", &TiledImage::size, D(TiledImage, size))
+        .def("tileSize", &TiledImage::tileSize, D(TiledImage, tileSize))
+        .def("levelCount", &TiledImage::levelCount, D(TiledImage, levelCount))
+        .def("levelSize", &TiledImage::levelSize, D(TiledImage, levelSize))
+        .def("tileCount", &TiledImage::tileCount, D(TiledImage, tileCount))
+        .def("tilePixels", &TiledImage::tilePixels, D(TiledImage, tilePixels))
+        .def("readTile", [](const TiledImage &image, int level, const Vector2i &tile) {
+            std::string pixels((size_t) image.tileSize() * image.tileSize() * 4, '\0');
+            if (!image.readTile(level, tile, (uint8_t *) &pixels[0]))
+                throw std::runtime_error("TiledImage::readTile(): could not read the tile!");
+            return py::bytes(pixels);
+        }, D(TiledImage, readTile));
+
+    py::class_<MemoryTiledImage, TiledImage, ref<MemoryTiledImage>>(m, "MemoryTiledImage", D(MemoryTiledImage))
+        .def("__init__",
+             [](MemoryTiledImage &image, const Vector2i &size, py::bytes pixels, int tileSize) {
+                 std::string data = pixels;
+                 new (&image) MemoryTiledImage(size, std::vector<uint8_t>(data.begin(), data.end()), tileSize);
+             }, py::arg("size"), py::arg("pixels"), py::arg("tileSize") = 256, D(MemoryTiledImage, MemoryTiledImage));
+
+    py::class_<FileTiledImage, TiledImage, ref<FileTiledImage>>(m, "FileTiledImage", D(FileTiledImage))
+        .def(py::init<const std::string &>(), D(FileTiledImage, FileTiledImage))
+        .def_static("write", &FileTiledImage::write, D(FileTiledImage, write));
+
+    py::class_<ResourcePack>(m, "ResourcePack", D(ResourcePack))
+        .def_static("write", &ResourcePack::write, D(ResourcePack, write))
+        .def_static("addPack", &ResourcePack::addPack, D(ResourcePack, addPack))
+        .def_static("hasResource", &ResourcePack::hasResource, D(ResourcePack, hasResource))
+        .def_static("resource", [](const std::string &name) {
+            ResourcePack::Resource r = ResourcePack::resource(name);
+            return py::bytes((const char *) r.data, r.size);
+        }, D(ResourcePack, resource));
 }
 
 #endif
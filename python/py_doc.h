@@ -86,20 +86,43 @@ static const char *__doc_nanogui_AdvancedGridLayout_colCount = R"doc(Return the
 
 static const char *__doc_nanogui_AdvancedGridLayout_computeLayout = R"doc(Computes the layout)doc";
 
+static const char *__doc_nanogui_AdvancedGridLayout_invalidate = R"doc(See Layout::invalidate.)doc";
+
 static const char *__doc_nanogui_AdvancedGridLayout_mAnchor = R"doc(The mapping of widgets to their specified anchor points.)doc";
 
+static const char *__doc_nanogui_AdvancedGridLayout_mAnchorOrder = R"doc(Indices into mAnchors, ordered by increasing span along each axis.)doc";
+
+static const char *__doc_nanogui_AdvancedGridLayout_mAnchorSizes = R"doc(The size of each entry of mAnchors (-1 if it is not laid out).)doc";
+
+static const char *__doc_nanogui_AdvancedGridLayout_mAnchors = R"doc(The contents of mAnchor as a flat array.)doc";
+
+static const char *__doc_nanogui_AdvancedGridLayout_mAnchorsSorted = R"doc(Whether mAnchors and mAnchorOrder reflect mAnchor.)doc";
+
 static const char *__doc_nanogui_AdvancedGridLayout_mColStretch = R"doc(The stretch for each column of this AdvancedGridLayout.)doc";
 
 static const char *__doc_nanogui_AdvancedGridLayout_mCols = R"doc(The columns of this AdvancedGridLayout.)doc";
 
+static const char *__doc_nanogui_AdvancedGridLayout_mGrid = R"doc(The minimum row and column sizes computed by measure().)doc";
+
 static const char *__doc_nanogui_AdvancedGridLayout_mMargin = R"doc(The margin around this AdvancedGridLayout.)doc";
 
+static const char *__doc_nanogui_AdvancedGridLayout_mMeasuredWidget = R"doc(The widget that mGrid and mAnchorSizes were computed for.)doc";
+
 static const char *__doc_nanogui_AdvancedGridLayout_mRowStretch = R"doc(The stretch for each row of this AdvancedGridLayout.)doc";
 
 static const char *__doc_nanogui_AdvancedGridLayout_mRows = R"doc(The rows of this AdvancedGridLayout.)doc";
 
 static const char *__doc_nanogui_AdvancedGridLayout_margin = R"doc(The margin of this AdvancedGridLayout.)doc";
 
+static const char *__doc_nanogui_AdvancedGridLayout_measure =
+R"doc(Measure the anchored children of ``widget`` and compute the minimum
+row and column sizes.
+
+Each axis is handled by a single sweep over the anchors in the order
+of increasing span. The results are stored in mGrid and mAnchorSizes,
+and are reused as long as the preferred size of ``widget`` stays
+valid.)doc";
+
 static const char *__doc_nanogui_AdvancedGridLayout_performLayout = R"doc(See Layout::performLayout.)doc";
 
 static const char *__doc_nanogui_AdvancedGridLayout_preferredSize = R"doc(See Layout::preferredSize.)doc";
@@ -114,6 +137,8 @@ static const char *__doc_nanogui_AdvancedGridLayout_setMargin = R"doc(Sets the m
 
 static const char *__doc_nanogui_AdvancedGridLayout_setRowStretch = R"doc(Set the stretch factor of a given row)doc";
 
+static const char *__doc_nanogui_AdvancedGridLayout_sortAnchors = R"doc(Rebuild mAnchors and mAnchorOrder after setAnchor() was called)doc";
+
 static const char *__doc_nanogui_Alignment = R"doc(The different kinds of alignments a layout can perform.)doc";
 
 static const char *__doc_nanogui_Alignment_Fill = R"doc(Fill according to preferred sizes.)doc";
@@ -1076,6 +1101,176 @@ static const char *__doc_nanogui_ComboBox_setItems_2 = R"doc(Sets the items for
 
 static const char *__doc_nanogui_ComboBox_setSelectedIndex = R"doc(Sets the current index this ComboBox has selected.)doc";
 
+static const char *__doc_nanogui_ConstraintLayout =
+R"doc(Layout which places widgets by solving linear equalities and
+inequalities between their edges.
+
+Every widget that is referenced by a constraint receives the variables
+left(), top(), width() and height(), measured relative to the content
+area of the container (i.e. inside of the margin and the window
+title). The widgets ask for their preferred size with strength
+sizeStrength(), so stronger constraints may stretch or shrink them.
+Widgets with a fixed size ask for it with strength ``Strong`` instead.
+Constraints that cannot all be satisfied are resolved according to
+their Strength. Children that are not referenced by any constraint are
+left untouched.
+
+The system is solved with the Cassowary algorithm. Adding or removing
+a constraint only pivots the affected rows of the simplex tableau, and
+changes of the container size or of the preferred size of a widget are
+handled as edits of existing variables which are re-optimized
+incrementally. Resizing a window therefore does not rebuild the
+system.
+
+```
+ConstraintLayout *layout = new ConstraintLayout(10);
+window->setLayout(layout);
+Label *label = new Label(window, "Name");
+TextBox *textBox = new TextBox(window);
+layout->addConstraint(layout->left(label) == 0);
+layout->addConstraint(layout->left(textBox) == layout->right(label) + 8);
+layout->addConstraint(layout->right(textBox) == layout->containerWidth());
+layout->addConstraint(layout->centerY(label) == layout->centerY(textBox));
+layout->addConstraint(layout->top(textBox) == 0);
+layout->addConstraint(layout->bottom(textBox) <= layout->containerHeight());
+```)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Constraint =
+R"doc(Relation between an expression and zero, together with its strength.
+Usually created with the comparison operators of Expression.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_ConstraintLayout =
+R"doc(Create a constraint layout with the given margin around its content
+area)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Constraint_expression = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Constraint_relation = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Constraint_strength = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Expression = R"doc(Linear combination of layout variables plus a constant.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Expression_Expression = R"doc(Create a constant expression)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Expression_constant = R"doc(Constant offset)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Expression_terms = R"doc(Pairs of variable identifier and coefficient)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Expression_variable = R"doc(Create an expression that consists of the given variable)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Relation = R"doc(Relation between the expression of a constraint and zero)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Relation_Equal = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Relation_GreaterEqual = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Relation_LessEqual = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Solver = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Strength =
+R"doc(Strength of a constraint. Stronger constraints take precedence when
+constraints conflict.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Strength_Medium = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Strength_Required = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Strength_Strong = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_Strength_Weak = R"doc()doc";
+
+static const char *__doc_nanogui_ConstraintLayout_WidgetVariables = R"doc(Variables and size edits of a widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_WidgetVariables_strength = R"doc(Strength of the width and height edits)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_WidgetVariables_suggested = R"doc(Size that was last suggested to the solver)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_WidgetVariables_vars = R"doc(Left, top, width and height)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_addConstraint =
+R"doc(Add a constraint and return an identifier for removeConstraint().
+
+Throws ``std::runtime_error`` if a required constraint conflicts with
+the existing required constraints.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_bottom = R"doc(Bottom edge of the given widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_centerX = R"doc(Horizontal center of the given widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_centerY = R"doc(Vertical center of the given widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_containerHeight = R"doc(Height of the content area of the container)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_containerWidth = R"doc(Width of the content area of the container)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_headerHeight =
+R"doc(The space that ``widget`` reserves above its children (e.g. the window
+title).)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_height = R"doc(Height of the given widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_left = R"doc(Left edge of the given widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_mContainer = R"doc(The width and height of the content area.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_mContainerFixed = R"doc(Whether the container size is currently an edit of the solver.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_mMargin = R"doc(The margin around the content area.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_mSizeStrength = R"doc(The strength with which the widgets ask for their preferred size.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_mSolver = R"doc(The incremental simplex solver.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_mWidgets = R"doc(The variables of the widgets.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_margin = R"doc(The margin of this ConstraintLayout.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_newVariable =
+R"doc(Create an additional variable (e.g. a guide line shared by several
+widgets))doc";
+
+static const char *__doc_nanogui_ConstraintLayout_performLayout = R"doc(See Layout::performLayout.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_preferredSize = R"doc(See Layout::preferredSize.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_removeConstraint = R"doc(Remove a constraint that was added with addConstraint())doc";
+
+static const char *__doc_nanogui_ConstraintLayout_removeWidget =
+R"doc(Forget the variables of a widget along with every constraint that
+refers to them.
+
+Call this before a child is removed from (or replaced in) the
+container. Otherwise its variables and constraints stay in the solver,
+and a new widget that is allocated at the same address inherits them.
+The identifiers of the removed constraints and expressions that refer
+to the widget become invalid.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_right = R"doc(Right edge of the given widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_setMargin = R"doc(Sets the margin of this ConstraintLayout.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_setSizeStrength =
+R"doc(Sets the strength with which the widgets ask for their preferred size
+(``Required`` is treated as ``Strong``).)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_sizeStrength = R"doc(The strength with which the widgets ask for their preferred size.)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_top = R"doc(Top edge of the given widget)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_updateSizes =
+R"doc(Suggest the preferred sizes of the visible children of ``widget`` to
+the solver)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_value = R"doc(Return the value of an expression in the most recent solution)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_variable =
+R"doc(Return the given variable (0: left, 1: top, 2: width, 3: height) of
+``widget``, creating them if needed)doc";
+
+static const char *__doc_nanogui_ConstraintLayout_width = R"doc(Width of the given widget)doc";
+
 static const char *__doc_nanogui_Cursor =
 R"doc(Cursor shapes available to use in GLFW. Shape of actual cursor
 determined by Operating System.)doc";
@@ -1096,6 +1291,186 @@ static const char *__doc_nanogui_Cursor_IBeam = R"doc(The I-beam cursor.)doc";
 
 static const char *__doc_nanogui_Cursor_VResize = R"doc(The vertical resize cursor.)doc";
 
+static const char *__doc_nanogui_FileTiledImage =
+R"doc(Tiled image stored in a pyramid file that is memory-mapped.
+
+The file holds the uncompressed tiles of all levels, so reading a tile
+is a copy from the mapping, and the operating system only reads the
+parts of the file that are shown. Such files are created with write()
+from any other tiled image, e.g. a MemoryTiledImage or an
+implementation that decodes a large image format piece by piece.)doc";
+
+static const char *__doc_nanogui_FileTiledImage_FileTiledImage =
+R"doc(Memory-map the given pyramid file, or throw ``std::runtime_error`` if
+it is invalid)doc";
+
+static const char *__doc_nanogui_FileTiledImage_FileTiledImage_2 = R"doc()doc";
+
+static const char *__doc_nanogui_FileTiledImage_FileTiledImage_3 = R"doc(Map a file whose header holds the given width, height and tile size)doc";
+
+static const char *__doc_nanogui_FileTiledImage_mData = R"doc()doc";
+
+static const char *__doc_nanogui_FileTiledImage_mMapping = R"doc(Platform-specific mapping handle)doc";
+
+static const char *__doc_nanogui_FileTiledImage_mSize = R"doc()doc";
+
+static const char *__doc_nanogui_FileTiledImage_readTile = R"doc()doc";
+
+static const char *__doc_nanogui_FileTiledImage_tileOffset = R"doc(Return the offset of a tile in the file)doc";
+
+static const char *__doc_nanogui_FileTiledImage_write = R"doc(Write all tiles of ``image`` to a pyramid file, one tile at a time)doc";
+
+static const char *__doc_nanogui_FlexLayout =
+R"doc(Flexible box layout, modeled after CSS flexbox.
+
+Widgets are placed one after the other along the main axis given by
+the Orientation. Each widget starts out with its basis size (by
+default its preferred size). Any remaining space on a line is
+distributed among the widgets according to their grow factors; when
+the line is too short, the widgets give up space in proportion to
+their shrink factors times their basis. If wrapping is enabled,
+widgets that do not fit are moved to a new line. Widgets with a fixed
+size along the main axis keep it.
+
+Measurement and placement are linear in the number of children, and
+each child is measured once per layout pass. With wrapping, the
+preferred size depends on the size of the container along the main
+axis; when the container is laid out at a different size than it was
+measured for, it is measured again in the next layout pass.
+
+```
+FlexLayout *layout = new FlexLayout(Orientation::Horizontal);
+layout->setSpacing(6);
+panel->setLayout(layout);
+TextBox *textBox = new TextBox(panel);
+// The text box takes all the space that the button leaves
+layout->setItem(textBox, FlexLayout::Item(1.f));
+new Button(panel, "Search");
+```)doc";
+
+static const char *__doc_nanogui_FlexLayout_Entry = R"doc(A visible child together with its flex parameters.)doc";
+
+static const char *__doc_nanogui_FlexLayout_Entry_basis = R"doc(The initial size along the main axis.)doc";
+
+static const char *__doc_nanogui_FlexLayout_Entry_item = R"doc()doc";
+
+static const char *__doc_nanogui_FlexLayout_Entry_size = R"doc(The preferred size with the fixed size applied.)doc";
+
+static const char *__doc_nanogui_FlexLayout_Entry_widget = R"doc()doc";
+
+static const char *__doc_nanogui_FlexLayout_FlexLayout =
+R"doc(Construct a flex layout.
+
+Parameter ``orientation``:
+    The main axis along which widgets are placed.
+
+Parameter ``wrap``:
+    Whether widgets which do not fit are moved to a new line.
+
+Parameter ``margin``:
+    Margin around the layout container.
+
+Parameter ``spacing``:
+    Gap between adjacent widgets and lines.)doc";
+
+static const char *__doc_nanogui_FlexLayout_Item = R"doc(Flex parameters of a widget.)doc";
+
+static const char *__doc_nanogui_FlexLayout_Item_Item = R"doc(Create an Item with the given parameters.)doc";
+
+static const char *__doc_nanogui_FlexLayout_Item_basis = R"doc(Initial size along the main axis (-1 uses the preferred size).)doc";
+
+static const char *__doc_nanogui_FlexLayout_Item_grow =
+R"doc(Relative share of the free space on the line (0 means the widget does
+not grow).)doc";
+
+static const char *__doc_nanogui_FlexLayout_Item_shrink =
+R"doc(Relative amount (weighted by the basis) the widget gives up when the
+line overflows.)doc";
+
+static const char *__doc_nanogui_FlexLayout_alignment =
+R"doc(The Alignment of the widgets within their line, perpendicular to the
+main axis.)doc";
+
+static const char *__doc_nanogui_FlexLayout_computeLines =
+R"doc(Measure the visible children of ``widget`` and break them into lines.
+
+Parameter ``mainSize``:
+    The space available along the main axis. Values <= 0 (or a disabled
+    wrap()) place all widgets on a single line.
+
+Parameter ``entries``:
+    Receives the visible children in order.
+
+Parameter ``lines``:
+    Receives the index of the first entry of each line, followed by the
+    number of entries.)doc";
+
+static const char *__doc_nanogui_FlexLayout_headerHeight =
+R"doc(The space that ``widget`` reserves above its children (e.g. the window
+title).)doc";
+
+static const char *__doc_nanogui_FlexLayout_invalidate = R"doc(See Layout::invalidate.)doc";
+
+static const char *__doc_nanogui_FlexLayout_item =
+R"doc(Retrieve the flex parameters of a given widget (the defaults if none
+were specified).)doc";
+
+static const char *__doc_nanogui_FlexLayout_justification =
+R"doc(The placement of the widgets along the main axis when none of them
+grows.)doc";
+
+static const char *__doc_nanogui_FlexLayout_mAlignment = R"doc(The Alignment of the widgets within their line.)doc";
+
+static const char *__doc_nanogui_FlexLayout_mItems = R"doc(The flex parameters of the widgets.)doc";
+
+static const char *__doc_nanogui_FlexLayout_mJustification = R"doc(The placement of the widgets along the main axis.)doc";
+
+static const char *__doc_nanogui_FlexLayout_mMainSizes =
+R"doc(The space along the main axis that the cached preferred size of each
+widget is based on (when wrapping).)doc";
+
+static const char *__doc_nanogui_FlexLayout_mMargin = R"doc(The margin around this FlexLayout.)doc";
+
+static const char *__doc_nanogui_FlexLayout_mOrientation = R"doc(The main axis of this FlexLayout.)doc";
+
+static const char *__doc_nanogui_FlexLayout_mSpacing = R"doc(The gap between widgets along each axis.)doc";
+
+static const char *__doc_nanogui_FlexLayout_mWrap = R"doc(Whether widgets which do not fit are moved to a new line.)doc";
+
+static const char *__doc_nanogui_FlexLayout_margin = R"doc(The margin around this FlexLayout.)doc";
+
+static const char *__doc_nanogui_FlexLayout_orientation = R"doc(The main axis of this FlexLayout.)doc";
+
+static const char *__doc_nanogui_FlexLayout_performLayout = R"doc(See Layout::performLayout.)doc";
+
+static const char *__doc_nanogui_FlexLayout_preferredSize = R"doc(See Layout::preferredSize.)doc";
+
+static const char *__doc_nanogui_FlexLayout_setAlignment =
+R"doc(Sets the Alignment of the widgets within their line, perpendicular to
+the main axis.)doc";
+
+static const char *__doc_nanogui_FlexLayout_setItem = R"doc(Specify the flex parameters of a given widget.)doc";
+
+static const char *__doc_nanogui_FlexLayout_setJustification =
+R"doc(Sets the placement of the widgets along the main axis (``Fill``
+behaves like ``Minimum``).)doc";
+
+static const char *__doc_nanogui_FlexLayout_setMargin = R"doc(Sets the margin around this FlexLayout.)doc";
+
+static const char *__doc_nanogui_FlexLayout_setOrientation = R"doc(Sets the main axis of this FlexLayout.)doc";
+
+static const char *__doc_nanogui_FlexLayout_setSpacing = R"doc(Sets the gap between widgets along the given axis.)doc";
+
+static const char *__doc_nanogui_FlexLayout_setSpacing_2 = R"doc(Sets the gap between widgets along both axes.)doc";
+
+static const char *__doc_nanogui_FlexLayout_setWrap = R"doc(Sets whether widgets which do not fit are moved to a new line.)doc";
+
+static const char *__doc_nanogui_FlexLayout_spacing =
+R"doc(The gap between widgets along the given axis (0: horizontal, 1:
+vertical).)doc";
+
+static const char *__doc_nanogui_FlexLayout_wrap = R"doc(Whether widgets which do not fit are moved to a new line.)doc";
+
 static const char *__doc_nanogui_FloatBox =
 R"doc(A specialization of TextBox representing floating point values.
 
@@ -1635,6 +2010,63 @@ static const char *__doc_nanogui_GLUniformBuffer_release = R"doc(Release/unbind
 
 static const char *__doc_nanogui_GLUniformBuffer_update = R"doc(Update content on the GPU using data)doc";
 
+static const char *__doc_nanogui_GlyphCache =
+R"doc(Records which glyphs are used at which sizes, persists the record and
+rasterizes it into the NanoVG font atlas of new screens.
+
+NanoVG rasterizes glyphs lazily while drawing, so the first frames of
+a window stall while the glyphs of all its captions are rendered and
+uploaded one batch at a time. The glyph cache collects the code points
+of every string that TextMetrics measures for the first time (grouped
+by face, font size and pixel ratio) while recording is enabled. Each
+Screen then draws the recorded glyphs of its pixel ratio into its
+atlas before its first frame, in a single pass.
+
+The record can be saved to a file and loaded by later runs, so that
+short-lived windows start with a warm atlas. Faces are identified by
+their name and a hash of the font data; entries of faces whose data
+changed are dropped when the file is loaded.
+
+All functions are thread-safe.)doc";
+
+static const char *__doc_nanogui_GlyphCache_addGlyphs =
+R"doc(Add the glyphs of a string in the given face and size at the given
+pixel ratio (0: the default ratio of TextMetrics).
+
+Faces that are not known to TextMetrics are ignored.)doc";
+
+static const char *__doc_nanogui_GlyphCache_addGlyphs_2 =
+R"doc(Add the glyphs of a string (``end`` may be ``nullptr`` if the string
+is null-terminated))doc";
+
+static const char *__doc_nanogui_GlyphCache_clear = R"doc(Remove all recorded glyphs)doc";
+
+static const char *__doc_nanogui_GlyphCache_glyphCount =
+R"doc(Return the number of recorded glyphs (summed over all faces, sizes and
+pixel ratios))doc";
+
+static const char *__doc_nanogui_GlyphCache_load =
+R"doc(Merge the glyphs recorded in a file into the cache.
+
+Returns ``false`` if the file does not exist or is not a glyph cache.)doc";
+
+static const char *__doc_nanogui_GlyphCache_prewarm =
+R"doc(Rasterize the recorded glyphs of the given pixel ratio into the font
+atlas of a NanoVG context.
+
+Starts and cancels its own frame, so it must not be called while a
+frame is being drawn. Screen calls this before its first frame.)doc";
+
+static const char *__doc_nanogui_GlyphCache_recording = R"doc(Return whether measured strings are recorded)doc";
+
+static const char *__doc_nanogui_GlyphCache_save =
+R"doc(Write the recorded glyphs to a file.
+
+The file is replaced atomically, so several processes may share it.
+Throws ``std::runtime_error`` if it cannot be written.)doc";
+
+static const char *__doc_nanogui_GlyphCache_setRecording = R"doc(Set whether measured strings are recorded (default: ``false)``)doc";
+
 static const char *__doc_nanogui_Graph = R"doc(Simple graph widget for showing a function plot.)doc";
 
 static const char *__doc_nanogui_Graph_Graph = R"doc()doc";
@@ -1747,14 +2179,30 @@ static const char *__doc_nanogui_GridLayout_alignment =
 R"doc(The Alignment of the specified axis (row or column number, depending
 on the Orientation) at the specified index of that row or column.)doc";
 
-static const char *__doc_nanogui_GridLayout_computeLayout = R"doc(Compute the maximum row and column sizes)doc";
+static const char *__doc_nanogui_GridLayout_computeLayout =
+R"doc(Measure the visible children and compute the maximum row and column
+sizes.
+
+The results are stored in mGrid and mCells. They are reused as long as
+the preferred size of ``widget`` stays valid, so that the measurement
+done by the parent's layout also serves performLayout().)doc";
+
+static const char *__doc_nanogui_GridLayout_invalidate = R"doc(See Layout::invalidate.)doc";
 
 static const char *__doc_nanogui_GridLayout_mAlignment = R"doc(The actual Alignment being used.)doc";
 
+static const char *__doc_nanogui_GridLayout_mCells =
+R"doc(The visible children and their sizes (preferred size with the fixed
+size applied).)doc";
+
 static const char *__doc_nanogui_GridLayout_mDefaultAlignment = R"doc(The default Alignment for this GridLayout.)doc";
 
+static const char *__doc_nanogui_GridLayout_mGrid = R"doc(The row and column sizes computed by computeLayout().)doc";
+
 static const char *__doc_nanogui_GridLayout_mMargin = R"doc(The margin around this GridLayout.)doc";
 
+static const char *__doc_nanogui_GridLayout_mMeasuredWidget = R"doc(The widget that mGrid and mCells were computed for.)doc";
+
 static const char *__doc_nanogui_GridLayout_mOrientation = R"doc(The Orientation defining this GridLayout.)doc";
 
 static const char *__doc_nanogui_GridLayout_mResolution =
@@ -1883,6 +2331,63 @@ static const char *__doc_nanogui_GroupLayout_setSpacing = R"doc(Sets the spacing
 
 static const char *__doc_nanogui_GroupLayout_spacing = R"doc(The spacing between widgets of this GroupLayout.)doc";
 
+static const char *__doc_nanogui_ImageLoader =
+R"doc(Asynchronous variant of loadImageDirectory().
+
+The constructor lists the PNG files of a directory and returns right
+away, while worker threads decode the files. NanoVG is not thread-
+safe, so the decoded images are turned into NanoVG images by update()
+on the UI thread, a few at a time, so that no single frame stalls. An
+ImagePanel that is given a loader calls update() while it is drawn and
+shows the images as they arrive; other users call it once per frame,
+e.g. from Screen::drawContents().
+
+The workers stay at most a few images ahead of update(), which bounds
+the memory held by decoded images. Calling cancel() stops them after
+their current file, and destroying the loader also waits for them to
+exit.)doc";
+
+static const char *__doc_nanogui_ImageLoader_ImageLoader =
+R"doc(Start loading the PNG images of a directory.
+
+Throws ``std::runtime_error`` if the directory cannot be opened.
+
+Parameter ``threads``:
+    Number of worker threads (0: one per processor core))doc";
+
+static const char *__doc_nanogui_ImageLoader_State = R"doc()doc";
+
+static const char *__doc_nanogui_ImageLoader_cancel = R"doc(Stop decoding and discard the images that were not created yet)doc";
+
+static const char *__doc_nanogui_ImageLoader_cancelled = R"doc(Return whether cancel() was called)doc";
+
+static const char *__doc_nanogui_ImageLoader_done =
+R"doc(Return whether every file was loaded or failed, or loading was
+cancelled)doc";
+
+static const char *__doc_nanogui_ImageLoader_failedCount = R"doc(Return the number of files that could not be decoded or uploaded)doc";
+
+static const char *__doc_nanogui_ImageLoader_fileCount = R"doc(Return the number of image files in the directory)doc";
+
+static const char *__doc_nanogui_ImageLoader_loadedCount = R"doc(Return the number of images that were created by update())doc";
+
+static const char *__doc_nanogui_ImageLoader_mContext = R"doc()doc";
+
+static const char *__doc_nanogui_ImageLoader_mState = R"doc()doc";
+
+static const char *__doc_nanogui_ImageLoader_progress =
+R"doc(Return the fraction of files that were loaded or failed, between 0 and
+1)doc";
+
+static const char *__doc_nanogui_ImageLoader_update =
+R"doc(Create NanoVG images for up to ``maxImages`` decoded files.
+
+Returns the new images along with the file names without extension, in
+the format of loadImageDirectory(). The caller owns the images. Must
+be called on the thread that owns the NanoVG context.)doc";
+
+static const char *__doc_nanogui_ImageLoader_wait = R"doc(Block until update() has work to do or all files are decoded)doc";
+
 static const char *__doc_nanogui_ImagePanel = R"doc(Image panel widget which shows a number of square-shaped icons.)doc";
 
 static const char *__doc_nanogui_ImagePanel_ImagePanel = R"doc()doc";
@@ -1893,12 +2398,18 @@ static const char *__doc_nanogui_ImagePanel_draw = R"doc()doc";
 
 static const char *__doc_nanogui_ImagePanel_gridSize = R"doc()doc";
 
+static const char *__doc_nanogui_ImagePanel_imageLoader = R"doc()doc";
+
+static const char *__doc_nanogui_ImagePanel_imageLoader_2 = R"doc()doc";
+
 static const char *__doc_nanogui_ImagePanel_images = R"doc()doc";
 
 static const char *__doc_nanogui_ImagePanel_indexForPosition = R"doc()doc";
 
 static const char *__doc_nanogui_ImagePanel_mCallback = R"doc()doc";
 
+static const char *__doc_nanogui_ImagePanel_mImageLoader = R"doc()doc";
+
 static const char *__doc_nanogui_ImagePanel_mImages = R"doc()doc";
 
 static const char *__doc_nanogui_ImagePanel_mMargin = R"doc()doc";
@@ -1941,14 +2452,32 @@ static const char *__doc_nanogui_ImagePanel_preferredSize = R"doc()doc";
 
 static const char *__doc_nanogui_ImagePanel_setCallback = R"doc()doc";
 
+static const char *__doc_nanogui_ImagePanel_setImageLoader =
+R"doc(Append the images of ``loader`` as they arrive (the panel calls
+ImageLoader::update() while it is drawn))doc";
+
 static const char *__doc_nanogui_ImagePanel_setImages = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView = R"doc(Widget used to display images.)doc";
 
 static const char *__doc_nanogui_ImageView_ImageView = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_ImageView_2 = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_TileCache = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_TileLoader = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_bindImage = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_bindTiledImage =
+R"doc(Displays an image that is split into a pyramid of tiles, which can be
+larger than the maximum texture size. Only the tiles of the level that
+matches the zoom factor and that intersect the visible region are
+loaded, on background threads, and the textures of the most recently
+used tiles are kept in a cache. While a tile is loading, the view
+shows the closest coarser tile that is available instead.)doc";
+
 static const char *__doc_nanogui_ImageView_center = R"doc(Centers the image without affecting the scaling factor.)doc";
 
 static const char *__doc_nanogui_ImageView_clampedImageCoordinateAt =
@@ -1967,6 +2496,8 @@ static const char *__doc_nanogui_ImageView_drawPixelGrid = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_drawPixelInfo = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_drawTiles = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_drawWidgetBorder = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_fit = R"doc(Centers and scales the image so that it fits inside the widgets.)doc";
@@ -1993,6 +2524,11 @@ static const char *__doc_nanogui_ImageView_imageSize = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_imageSizeF = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_invalidatePixelInfo =
+R"doc(The pixel information is formatted once and reused for as long as the
+same pixels are visible. Call this function when the pixel values
+changed without a call to bindImage().)doc";
+
 static const char *__doc_nanogui_ImageView_keyboardCharacterEvent = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_keyboardEvent = R"doc()doc";
@@ -2013,12 +2549,40 @@ static const char *__doc_nanogui_ImageView_mOffset = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_mPixelInfoCallback = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_mPixelInfoColors = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mPixelInfoLines = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mPixelInfoOrigin = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mPixelInfoSize = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mPixelInfoText = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_mPixelInfoThreshold = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_mPixelInfoValid = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mPixelRegionCallback = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mPixelRegionChannels = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mPixelValues = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_mScale = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_mShader = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_mTileCache = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mTileCacheSize = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mTileLoader = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mTileUploadsPerFrame = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_mTiledImage = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_mZoomSensitivity = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_mouseDragEvent = R"doc()doc";
@@ -2061,6 +2625,10 @@ static const char *__doc_nanogui_ImageView_pixelInfoVisible =
 R"doc(Function indicating whether the pixel information is currently
 visible.)doc";
 
+static const char *__doc_nanogui_ImageView_pixelRegionCallback = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_pixelRegionChannels = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_positionF = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_positionForCoordinate =
@@ -2069,6 +2637,8 @@ coordinate.)doc";
 
 static const char *__doc_nanogui_ImageView_preferredSize = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_releaseTiles = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_scale = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_scaledImageSize = R"doc()doc";
@@ -2097,16 +2667,41 @@ static const char *__doc_nanogui_ImageView_setPixelInfoCallback = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_setPixelInfoThreshold = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_setPixelRegionCallback =
+R"doc(Sets a callback that provides the values of all visible pixels at
+once, which takes precedence over the per-pixel information callback.
+The callback receives the image coordinates of the upper left pixel
+and the size of a rectangle, and fills ``values`` with ``channels``
+values per pixel in row-major order. ``colors`` holds one text color
+per pixel, initialized to the theme's text color, which the callback
+may replace. Each value is shown on its own line.)doc";
+
 static const char *__doc_nanogui_ImageView_setScale = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_setScaleCentered = R"doc(Set the scale while keeping the image centered)doc";
 
+static const char *__doc_nanogui_ImageView_setTileCacheSize = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_setTileUploadsPerFrame = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_setZoomSensitivity = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_sizeF = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_tileCacheSize =
+R"doc(The number of tile textures that are kept on the GPU (at least the
+visible tiles are kept).)doc";
+
+static const char *__doc_nanogui_ImageView_tileUploadsPerFrame = R"doc(The maximum number of tiles that are uploaded to the GPU per frame.)doc";
+
+static const char *__doc_nanogui_ImageView_tiledImage = R"doc()doc";
+
+static const char *__doc_nanogui_ImageView_tiledImage_2 = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_updateImageParameters = R"doc()doc";
 
+static const char *__doc_nanogui_ImageView_updatePixelInfo = R"doc()doc";
+
 static const char *__doc_nanogui_ImageView_writePixelInfo = R"doc()doc";
 
 static const char *__doc_nanogui_ImageView_zoom =
@@ -2181,10 +2776,30 @@ static const char *__doc_nanogui_Label =
 R"doc(Text label widget.
 
 The font and color can be customized. When Widget::setFixedWidth() is
-used, the text is wrapped when it surpasses the specified width.)doc";
+used, the text is wrapped when it surpasses the specified width. The
+line breaks are computed once and reused by preferredSize() and draw()
+until the caption, font or width changes.)doc";
 
 static const char *__doc_nanogui_Label_Label = R"doc()doc";
 
+static const char *__doc_nanogui_Label_LineBreaks =
+R"doc(Rows of a wrapped caption, together with the parameters they were
+computed for)doc";
+
+static const char *__doc_nanogui_Label_LineBreaks_caption = R"doc()doc";
+
+static const char *__doc_nanogui_Label_LineBreaks_font = R"doc()doc";
+
+static const char *__doc_nanogui_Label_LineBreaks_fontSize = R"doc()doc";
+
+static const char *__doc_nanogui_Label_LineBreaks_lineHeight = R"doc(Distance between the tops of consecutive rows)doc";
+
+static const char *__doc_nanogui_Label_LineBreaks_pixelRatio = R"doc()doc";
+
+static const char *__doc_nanogui_Label_LineBreaks_rows = R"doc(Byte ranges of the rows within ``caption``)doc";
+
+static const char *__doc_nanogui_Label_LineBreaks_width = R"doc()doc";
+
 static const char *__doc_nanogui_Label_caption = R"doc(Get the label's text caption)doc";
 
 static const char *__doc_nanogui_Label_color = R"doc(Get the label color)doc";
@@ -2193,6 +2808,10 @@ static const char *__doc_nanogui_Label_draw = R"doc(Draw the label)doc";
 
 static const char *__doc_nanogui_Label_font = R"doc(Get the currently active font)doc";
 
+static const char *__doc_nanogui_Label_lineBreaks =
+R"doc(Return the rows of the caption wrapped at the fixed width, breaking it
+again only if needed)doc";
+
 static const char *__doc_nanogui_Label_load = R"doc()doc";
 
 static const char *__doc_nanogui_Label_mCaption = R"doc()doc";
@@ -2201,6 +2820,8 @@ static const char *__doc_nanogui_Label_mColor = R"doc()doc";
 
 static const char *__doc_nanogui_Label_mFont = R"doc()doc";
 
+static const char *__doc_nanogui_Label_mLineBreaks = R"doc(Cached line breaks of a wrapped caption)doc";
+
 static const char *__doc_nanogui_Label_operator_delete = R"doc()doc";
 
 static const char *__doc_nanogui_Label_operator_delete_2 = R"doc()doc";
@@ -2241,6 +2862,34 @@ static const char *__doc_nanogui_Label_setTheme = R"doc(Set the Theme used to dr
 
 static const char *__doc_nanogui_Layout = R"doc(Basic interface of a layout engine.)doc";
 
+static const char *__doc_nanogui_LayoutLock =
+R"doc(Scoped lock which serializes access to shared state while layouts run
+on several threads (see Widget::setLayoutThreads()).
+
+Shared state includes the NanoVG context and the widgets above the
+subtrees that are laid out concurrently. The lock is recursive, and
+free when no parallel layout is in progress.
+Widget::invalidateLayout(), the NanoVG fallbacks of TextMetrics and
+the line breaking of Label hold it. Implementations of
+Widget::preferredSize() and Widget::performLayout() which use the
+NanoVG context directly must acquire it as well.)doc";
+
+static const char *__doc_nanogui_LayoutLock_LayoutLock = R"doc()doc";
+
+static const char *__doc_nanogui_LayoutLock_LayoutLock_2 = R"doc()doc";
+
+static const char *__doc_nanogui_LayoutLock_mLocked = R"doc()doc";
+
+static const char *__doc_nanogui_Layout_invalidate =
+R"doc(Invalidate the layout of every widget that uses this layout (see
+Widget::invalidateLayout()).
+
+The setters of parameters that affect the preferred size or the
+arrangement call this function. Subclasses which cache measurements
+override it to discard them as well.)doc";
+
+static const char *__doc_nanogui_Layout_mOwners = R"doc(The widgets that use this layout (maintained by Widget::setLayout()).)doc";
+
 static const char *__doc_nanogui_Layout_performLayout =
 R"doc(Performs any and all resizing applicable.
 
@@ -2263,53 +2912,381 @@ Returns:
     The preferred size, accounting for things such as spacing, padding
     for icons, etc.)doc";
 
-static const char *__doc_nanogui_MessageDialog = R"doc(Simple "OK" or "Yes/No"-style modal dialogs.)doc";
+static const char *__doc_nanogui_ListView =
+R"doc(Scrollable list of fixed-height rows backed by a data callback.
 
-static const char *__doc_nanogui_MessageDialog_MessageDialog = R"doc()doc";
+In contrast to placing one widget per row into a VScrollPanel, this
+widget only creates row widgets for the rows that are currently
+visible (plus a small overscan margin above and below). When the list
+is scrolled, rows that leave the visible range are recycled and re-
+bound to the rows that enter it, so the number of live widgets is
+independent of rowCount().
 
-static const char *__doc_nanogui_MessageDialog_Type = R"doc(Classification of the type of message this MessageDialog represents.)doc";
+Row widgets are created by the createCallback() (by default, a Label)
+and filled with data by the bindCallback(), which receives the row
+widget and the index of the row it now represents:
 
-static const char *__doc_nanogui_MessageDialog_Type_Information = R"doc()doc";
+```
+ListView *list = new ListView(window);
+list->setFixedSize(Vector2i(300, 400));
+list->setRowCount(1000000);
+list->setBindCallback([](Widget *row, int index) {
+    ((Label *) row)->setCaption("Row " + std::to_string(index));
+});
+```)doc";
 
-static const char *__doc_nanogui_MessageDialog_Type_Question = R"doc()doc";
+static const char *__doc_nanogui_ListView_ListView = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_Type_Warning = R"doc()doc";
+static const char *__doc_nanogui_ListView_acquireRow =
+R"doc(Take a row widget out of the pool of recycled widgets (or create a new
+one))doc";
 
-static const char *__doc_nanogui_MessageDialog_callback = R"doc()doc";
+static const char *__doc_nanogui_ListView_bindCallback = R"doc(Return the callback used to fill a row widget with the data of a row)doc";
 
-static const char *__doc_nanogui_MessageDialog_mCallback = R"doc()doc";
+static const char *__doc_nanogui_ListView_callback = R"doc(Return the callback that is invoked when the user selects a row)doc";
 
-static const char *__doc_nanogui_MessageDialog_mMessageLabel = R"doc()doc";
+static const char *__doc_nanogui_ListView_contentHeight = R"doc(Total height of all rows in pixels)doc";
 
-static const char *__doc_nanogui_MessageDialog_messageLabel = R"doc()doc";
+static const char *__doc_nanogui_ListView_createCallback = R"doc(Return the callback used to instantiate new row widgets)doc";
 
-static const char *__doc_nanogui_MessageDialog_messageLabel_2 = R"doc()doc";
+static const char *__doc_nanogui_ListView_draw = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_delete = R"doc()doc";
+static const char *__doc_nanogui_ListView_keyboardEvent = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_delete_2 = R"doc()doc";
+static const char *__doc_nanogui_ListView_load = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_delete_3 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mBindCallback = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_delete_4 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mCallback = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_delete_5 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mCreateCallback = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_delete_6 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mFirstRow = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_delete_7 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mFreeRows = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_new = R"doc()doc";
+static const char *__doc_nanogui_ListView_mOverscan = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_new_2 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mRebindRows = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_new_3 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mRowCount = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_new_4 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mRowHeight = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_operator_new_5 = R"doc()doc";
+static const char *__doc_nanogui_ListView_mRows = R"doc()doc";
 
-static const char *__doc_nanogui_MessageDialog_setCallback = R"doc()doc";
+static const char *__doc_nanogui_ListView_mScroll = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_mSelectedIndex = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_mUpdateRows = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_mUpdatingRows = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_markLayoutDirty = R"doc(Row recycling and binding do not invalidate the layout of the parents)doc";
+
+static const char *__doc_nanogui_ListView_mouseButtonEvent = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_mouseDragEvent = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_overscan =
+R"doc(Return the number of rows that are kept alive above and below the
+visible range)doc";
+
+static const char *__doc_nanogui_ListView_performLayout = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_preferredSize = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_realizedRange =
+R"doc(Return the range of rows ``[first, last)`` that currently have a row
+widget)doc";
+
+static const char *__doc_nanogui_ListView_refresh =
+R"doc(Re-bind all rows that are currently alive (e.g. after the underlying
+data has changed))doc";
+
+static const char *__doc_nanogui_ListView_releaseRow = R"doc(Move a row widget into the pool of recycled widgets)doc";
+
+static const char *__doc_nanogui_ListView_rowAt =
+R"doc(Return the index of the row at the given position (relative to the
+parent), or -1)doc";
+
+static const char *__doc_nanogui_ListView_rowCount = R"doc(Return the number of rows in the list)doc";
+
+static const char *__doc_nanogui_ListView_rowHeight = R"doc(Return the height of each row in pixels)doc";
+
+static const char *__doc_nanogui_ListView_rowWidget =
+R"doc(Return the widget that currently represents the given row, or
+``nullptr`` if it is not alive)doc";
+
+static const char *__doc_nanogui_ListView_save = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_scroll =
+R"doc(Return the current scroll amount as a value between 0 and 1. 0 means
+scrolled to the top and 1 to the bottom.)doc";
+
+static const char *__doc_nanogui_ListView_scrollEvent = R"doc()doc";
+
+static const char *__doc_nanogui_ListView_scrollOffset =
+R"doc(Distance in pixels between the top of the first row and the top of the
+view)doc";
+
+static const char *__doc_nanogui_ListView_scrollToRow = R"doc(Scroll the minimal amount that is needed to make the given row visible)doc";
+
+static const char *__doc_nanogui_ListView_selectedIndex = R"doc(Return the index of the selected row (or -1 if there is none))doc";
+
+static const char *__doc_nanogui_ListView_setBindCallback = R"doc(Set the callback used to fill a row widget with the data of a row)doc";
+
+static const char *__doc_nanogui_ListView_setCallback = R"doc(Set the callback that is invoked when the user selects a row)doc";
+
+static const char *__doc_nanogui_ListView_setCreateCallback =
+R"doc(Set the callback used to instantiate new row widgets.
+
+The callback must construct the widget as a direct child of the list
+view that is passed to it. If no callback is set, a Label is used.)doc";
+
+static const char *__doc_nanogui_ListView_setOverscan =
+R"doc(Set the number of rows that are kept alive above and below the visible
+range)doc";
+
+static const char *__doc_nanogui_ListView_setRowCount = R"doc(Set the number of rows in the list)doc";
+
+static const char *__doc_nanogui_ListView_setRowHeight = R"doc(Set the height of each row in pixels)doc";
+
+static const char *__doc_nanogui_ListView_setScroll =
+R"doc(Set the scroll amount to a value between 0 and 1. 0 means scrolled to
+the top and 1 to the bottom.)doc";
+
+static const char *__doc_nanogui_ListView_setSelectedIndex = R"doc(Set the index of the selected row (-1 clears the selection))doc";
+
+static const char *__doc_nanogui_ListView_updateRows =
+R"doc(Recycle rows which left the visible range and bind rows that entered
+it)doc";
+
+static const char *__doc_nanogui_LogView =
+R"doc(Read-only console that shows the most recent lines of a log.
+
+Lines are stored in a ring buffer of fixed capacity; once it is full,
+each new line replaces the oldest one, and the storage of the replaced
+line is reused. append() may be called from any thread and only holds
+a lock while the lines are copied into the buffer, so producers can
+log hundreds of thousands of lines per second.
+
+The widget collects the new lines once per frame, which makes the cost
+of an append independent of the number of lines on display. Lines have
+a fixed height and are virtualized like the rows of a ListView: only
+the visible lines are copied out of the buffer and drawn, and no line
+is measured. Lines can be filtered by a substring and a minimum level,
+and are colored by their level. While the view is scrolled to the
+bottom and autoScroll() is enabled, it follows new lines.)doc";
+
+static const char *__doc_nanogui_LogView_Entry = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_Entry_level = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_Entry_text = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_Level = R"doc(Severity of a line)doc";
+
+static const char *__doc_nanogui_LogView_Level_Debug = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_Level_Error = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_Level_Info = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_Level_Warning = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_LogView = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_append =
+R"doc(Append text to the log (thread-safe).
+
+The text is split into lines at newline characters; a trailing newline
+does not start an empty line.)doc";
+
+static const char *__doc_nanogui_LogView_autoScroll =
+R"doc(Return whether the view follows new lines while it is scrolled to the
+bottom)doc";
+
+static const char *__doc_nanogui_LogView_capacity = R"doc(Return the maximum number of lines that are kept (thread-safe))doc";
+
+static const char *__doc_nanogui_LogView_clear = R"doc(Remove all lines (thread-safe))doc";
+
+static const char *__doc_nanogui_LogView_contentHeight = R"doc(Height of the lines that pass the filter in pixels)doc";
+
+static const char *__doc_nanogui_LogView_draw = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_entry =
+R"doc(Return the entry with the given sequence number (the caller must hold
+the lock))doc";
+
+static const char *__doc_nanogui_LogView_filter = R"doc(Return the substring that lines must contain to be shown)doc";
+
+static const char *__doc_nanogui_LogView_keyboardEvent = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_levelColor = R"doc(Return the color of lines with the given level)doc";
+
+static const char *__doc_nanogui_LogView_lineCount =
+R"doc(Return the number of lines that pass the filter (as of the last frame
+or call to update()))doc";
+
+static const char *__doc_nanogui_LogView_lineHeight = R"doc(Return the height of a line in pixels)doc";
+
+static const char *__doc_nanogui_LogView_lineLevel =
+R"doc(Return the level of the given line among the lines that pass the
+filter (``Info`` if it was dropped since))doc";
+
+static const char *__doc_nanogui_LogView_lineText =
+R"doc(Return the text of the given line among the lines that pass the filter
+(empty if it was dropped since))doc";
+
+static const char *__doc_nanogui_LogView_load = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mAutoScroll = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mCount =
+R"doc(Number of lines in the buffer (the oldest has sequence number mTotal -
+mCount))doc";
+
+static const char *__doc_nanogui_LogView_mEntries = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mFilter = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mFollow = R"doc(Whether the view is attached to the bottom)doc";
+
+static const char *__doc_nanogui_LogView_mLevelColors = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mMinimumLevel = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mMutex = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mPending = R"doc(Whether lines were appended since the last update)doc";
+
+static const char *__doc_nanogui_LogView_mRows = R"doc(Sequence numbers of the lines that pass the filter)doc";
+
+static const char *__doc_nanogui_LogView_mScanned = R"doc(Sequence number of the next line that has not been filtered yet)doc";
+
+static const char *__doc_nanogui_LogView_mScrollY =
+R"doc(Distance in pixels between the top of the first line and the top of
+the view)doc";
+
+static const char *__doc_nanogui_LogView_mTotal = R"doc(Sequence number of the next line)doc";
+
+static const char *__doc_nanogui_LogView_mVisible = R"doc(Lines copied out of the buffer for drawing (reused between frames))doc";
+
+static const char *__doc_nanogui_LogView_matches = R"doc(Return whether a line passes the filter)doc";
+
+static const char *__doc_nanogui_LogView_minimumLevel = R"doc(Return the lowest level that is shown)doc";
+
+static const char *__doc_nanogui_LogView_mouseButtonEvent = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_mouseDragEvent = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_preferredSize = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_refilter = R"doc(Rebuild the list of lines that pass the filter)doc";
+
+static const char *__doc_nanogui_LogView_save = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_scrollEvent = R"doc()doc";
+
+static const char *__doc_nanogui_LogView_scrollToBottom =
+R"doc(Scroll to the last line (and follow new lines if autoScroll() is
+enabled))doc";
+
+static const char *__doc_nanogui_LogView_setAutoScroll =
+R"doc(Set whether the view follows new lines while it is scrolled to the
+bottom)doc";
+
+static const char *__doc_nanogui_LogView_setCapacity =
+R"doc(Set the maximum number of lines that are kept, dropping the oldest
+lines if needed (thread-safe))doc";
+
+static const char *__doc_nanogui_LogView_setFilter =
+R"doc(Set the substring that lines must contain to be shown (an empty string
+shows all lines))doc";
+
+static const char *__doc_nanogui_LogView_setLevelColor = R"doc(Set the color of lines with the given level)doc";
+
+static const char *__doc_nanogui_LogView_setMinimumLevel = R"doc(Set the lowest level that is shown)doc";
+
+static const char *__doc_nanogui_LogView_setScrollOffset = R"doc(Move the view, keeping it within the content)doc";
+
+static const char *__doc_nanogui_LogView_totalLines =
+R"doc(Return the number of lines that were appended since the widget was
+created (thread-safe))doc";
+
+static const char *__doc_nanogui_LogView_update =
+R"doc(Collect the lines that were appended since the last update (called by
+draw()))doc";
+
+static const char *__doc_nanogui_MemoryTiledImage =
+R"doc(Tiled image whose pixels are stored in memory.
+
+The coarser levels of the pyramid are computed by averaging blocks of
+2x2 pixels when they are first needed.)doc";
+
+static const char *__doc_nanogui_MemoryTiledImage_MemoryTiledImage =
+R"doc(Take over ``pixels``, which holds the RGBA pixels of the image at full
+resolution, row by row)doc";
+
+static const char *__doc_nanogui_MemoryTiledImage_level =
+R"doc(Return the pixels of a level, computing it and the levels above it if
+needed)doc";
+
+static const char *__doc_nanogui_MemoryTiledImage_mLevelFlags = R"doc(Guards the computation of each level (except for level 0))doc";
+
+static const char *__doc_nanogui_MemoryTiledImage_mLevels = R"doc()doc";
+
+static const char *__doc_nanogui_MemoryTiledImage_readTile = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog = R"doc(Simple "OK" or "Yes/No"-style modal dialogs.)doc";
+
+static const char *__doc_nanogui_MessageDialog_MessageDialog = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_Type = R"doc(Classification of the type of message this MessageDialog represents.)doc";
+
+static const char *__doc_nanogui_MessageDialog_Type_Information = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_Type_Question = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_Type_Warning = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_callback = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_mCallback = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_mMessageLabel = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_messageLabel = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_messageLabel_2 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_delete = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_delete_2 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_delete_3 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_delete_4 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_delete_5 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_delete_6 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_delete_7 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_new = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_new_2 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_new_3 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_new_4 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_operator_new_5 = R"doc()doc";
+
+static const char *__doc_nanogui_MessageDialog_setCallback = R"doc()doc";
 
 static const char *__doc_nanogui_Object = R"doc(Reference counted object base class.)doc";
 
@@ -2476,7 +3453,9 @@ static const char *__doc_nanogui_Popup_setAnchorPos =
 R"doc(Return the anchor position in the parent window; the placement of the
 popup is relative to it)doc";
 
-static const char *__doc_nanogui_Popup_setSide = R"doc(Set the side of the parent window at which popup will appear)doc";
+static const char *__doc_nanogui_Popup_setSide =
+R"doc(Set the side of the parent window at which popup will appear (on the
+left side, the popup ends at the anchor position))doc";
 
 static const char *__doc_nanogui_Popup_side = R"doc(Return the side of the parent window at which popup will appear)doc";
 
@@ -2522,6 +3501,74 @@ static const char *__doc_nanogui_ProgressBar_setValue = R"doc()doc";
 
 static const char *__doc_nanogui_ProgressBar_value = R"doc()doc";
 
+static const char *__doc_nanogui_ResourcePack =
+R"doc(Read-only archive of named assets that is accessed in place.
+
+A pack starts with a small index of resource names, offsets and sizes,
+sorted by name, followed by the contents of the resources. Packs are
+memory-mapped, so opening one only reads the index, and the pages of a
+resource are read by the operating system when the resource is first
+used. Pointers to resources stay valid for the lifetime of the pack.
+
+The fonts of NanoGUI are stored in a pack that is built along with the
+library (with the ``nanogui-pack`` tool). It is either embedded into
+the library or installed next to it, depending on the CMake option
+``NANOGUI_EMBED_RESOURCES``, and can be extended with the
+application's own files via the ``NANOGUI_EXTRA_RESOURCES`` CMake
+variable. Further packs can be registered at runtime with addPack();
+resource() searches the most recently added packs first, so they can
+also replace built-in resources.)doc";
+
+static const char *__doc_nanogui_ResourcePack_Resource = R"doc(Contents of a resource (``data`` is ``nullptr`` if it does not exist))doc";
+
+static const char *__doc_nanogui_ResourcePack_ResourcePack = R"doc(Memory-map the pack stored in the given file)doc";
+
+static const char *__doc_nanogui_ResourcePack_ResourcePack_2 =
+R"doc(Access a pack that is stored in memory (the data is not copied and
+must outlive the pack))doc";
+
+static const char *__doc_nanogui_ResourcePack_ResourcePack_3 = R"doc()doc";
+
+static const char *__doc_nanogui_ResourcePack_Resource_data = R"doc()doc";
+
+static const char *__doc_nanogui_ResourcePack_Resource_size = R"doc()doc";
+
+static const char *__doc_nanogui_ResourcePack_addPack = R"doc(Register a pack that is searched before all previously added packs)doc";
+
+static const char *__doc_nanogui_ResourcePack_count = R"doc(Return the number of resources)doc";
+
+static const char *__doc_nanogui_ResourcePack_entryName = R"doc(Return the name of an index entry without copying it)doc";
+
+static const char *__doc_nanogui_ResourcePack_find = R"doc(Look up a resource by name (binary search over the index))doc";
+
+static const char *__doc_nanogui_ResourcePack_hasResource =
+R"doc(Return whether any registered pack (including the built-in one)
+contains a resource)doc";
+
+static const char *__doc_nanogui_ResourcePack_mCount = R"doc()doc";
+
+static const char *__doc_nanogui_ResourcePack_mData = R"doc()doc";
+
+static const char *__doc_nanogui_ResourcePack_mMapping = R"doc(Platform-specific mapping handle (``nullptr`` for packs in memory))doc";
+
+static const char *__doc_nanogui_ResourcePack_mSize = R"doc()doc";
+
+static const char *__doc_nanogui_ResourcePack_name =
+R"doc(Return the name of the resource with the given index (resources are
+sorted by name))doc";
+
+static const char *__doc_nanogui_ResourcePack_parse = R"doc(Validate the header and the index)doc";
+
+static const char *__doc_nanogui_ResourcePack_resource =
+R"doc(Return a resource from the registered packs, or throw
+``std::runtime_error`` if it is unknown)doc";
+
+static const char *__doc_nanogui_ResourcePack_write =
+R"doc(Write a pack that contains the given files.
+
+Each entry of ``files`` is a pair of a resource name and the path of
+the file that provides its contents.)doc";
+
 static const char *__doc_nanogui_Screen =
 R"doc(Represents a display surface (i.e. a full-screen or windowed GLFW
 window) and forms the root element of a hierarchy of nanogui widgets.)doc";
@@ -2848,15 +3895,12 @@ static const char *__doc_nanogui_TabHeader_ClickLocation_TabButtons = R"doc()doc
 
 static const char *__doc_nanogui_TabHeader_TabButton = R"doc(Implementation class of the actual tab buttons.)doc";
 
-static const char *__doc_nanogui_TabHeader_TabButton_StringView = R"doc(Helper struct to represent the TabButton.)doc";
-
-static const char *__doc_nanogui_TabHeader_TabButton_StringView_first = R"doc()doc";
-
-static const char *__doc_nanogui_TabHeader_TabButton_StringView_last = R"doc()doc";
-
 static const char *__doc_nanogui_TabHeader_TabButton_TabButton = R"doc()doc";
 
-static const char *__doc_nanogui_TabHeader_TabButton_calculateVisibleString = R"doc()doc";
+static const char *__doc_nanogui_TabHeader_TabButton_calculateVisibleString =
+R"doc(Determine how much of the label fits into the button. The glyph
+positions of the label are cached, so that only a binary search is
+needed when the button width changes.)doc";
 
 static const char *__doc_nanogui_TabHeader_TabButton_drawActiveBorderAt = R"doc()doc";
 
@@ -2866,13 +3910,35 @@ static const char *__doc_nanogui_TabHeader_TabButton_drawInactiveBorderAt = R"do
 
 static const char *__doc_nanogui_TabHeader_TabButton_label = R"doc()doc";
 
+static const char *__doc_nanogui_TabHeader_TabButton_mGlyphFont =
+R"doc(Font, font size and pixel ratio of the glyph positions (an empty font
+means that they are out of date).)doc";
+
+static const char *__doc_nanogui_TabHeader_TabButton_mGlyphFontSize =
+R"doc(Font, font size and pixel ratio of the glyph positions (an empty font
+means that they are out of date).)doc";
+
+static const char *__doc_nanogui_TabHeader_TabButton_mGlyphPixelRatio =
+R"doc(Font, font size and pixel ratio of the glyph positions (an empty font
+means that they are out of date).)doc";
+
+static const char *__doc_nanogui_TabHeader_TabButton_mGlyphs = R"doc(Glyph positions and advance of the label.)doc";
+
 static const char *__doc_nanogui_TabHeader_TabButton_mHeader = R"doc()doc";
 
 static const char *__doc_nanogui_TabHeader_TabButton_mLabel = R"doc()doc";
 
+static const char *__doc_nanogui_TabHeader_TabButton_mLabelWidth = R"doc(Glyph positions and advance of the label.)doc";
+
 static const char *__doc_nanogui_TabHeader_TabButton_mSize = R"doc()doc";
 
-static const char *__doc_nanogui_TabHeader_TabButton_mVisibleText = R"doc()doc";
+static const char *__doc_nanogui_TabHeader_TabButton_mTruncated = R"doc(Whether the shown part of the label is followed by dots.)doc";
+
+static const char *__doc_nanogui_TabHeader_TabButton_mVisibleFor =
+R"doc(The button width for which the visible string was calculated (-1 if
+it is out of date).)doc";
+
+static const char *__doc_nanogui_TabHeader_TabButton_mVisibleLength = R"doc(Number of bytes of the label that are shown.)doc";
 
 static const char *__doc_nanogui_TabHeader_TabButton_mVisibleWidth = R"doc()doc";
 
@@ -2978,6 +4044,8 @@ label. Returns -1 if there was no such tab)doc";
 
 static const char *__doc_nanogui_TabHeader_removeTab_2 = R"doc(Removes the tab with the specified index.)doc";
 
+static const char *__doc_nanogui_TabHeader_scrollEvent = R"doc()doc";
+
 static const char *__doc_nanogui_TabHeader_setActiveTab = R"doc()doc";
 
 static const char *__doc_nanogui_TabHeader_setCallback =
@@ -3010,103 +4078,506 @@ visible tab buttons.)doc";
 
 static const char *__doc_nanogui_TabHeader_visibleEnd = R"doc()doc";
 
-static const char *__doc_nanogui_TabHeader_visibleEnd_2 = R"doc()doc";
+static const char *__doc_nanogui_TabHeader_visibleEnd_2 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget =
+R"doc(A wrapper around the widgets TabHeader and StackedWidget which hooks
+the two classes together.)doc";
+
+static const char *__doc_nanogui_TabWidget_TabWidget = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_activeTab = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_addTab =
+R"doc(Inserts a tab at the end of the tabs collection and associates it with
+the provided widget.)doc";
+
+static const char *__doc_nanogui_TabWidget_addTab_2 =
+R"doc(Inserts a tab into the tabs collection at the specified index and
+associates it with the provided widget.)doc";
+
+static const char *__doc_nanogui_TabWidget_callback = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_createTab =
+R"doc(Creates a new tab with the specified name and returns a pointer to the
+layer.)doc";
+
+static const char *__doc_nanogui_TabWidget_createTab_2 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_draw = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_ensureTabVisible =
+R"doc(This function can be invoked to ensure that the tab with the provided
+index the is visible, i.e to track the given tab. Forwards to the tab
+header widget. This function should be used whenever the client wishes
+to make the tab header follow a newly added tab, as the content of the
+new tab is made visible but the tab header does not track it by
+default.)doc";
+
+static const char *__doc_nanogui_TabWidget_mCallback = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_mContent = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_mHeader = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_delete = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_delete_2 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_delete_3 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_delete_4 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_delete_5 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_delete_6 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_delete_7 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_new = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_new_2 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_new_3 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_new_4 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_operator_new_5 = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_performLayout = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_preferredSize = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_removeTab =
+R"doc(Removes the tab with the specified label and returns the index of the
+label. Returns whether the removal was successful.)doc";
+
+static const char *__doc_nanogui_TabWidget_removeTab_2 = R"doc(Removes the tab with the specified index.)doc";
+
+static const char *__doc_nanogui_TabWidget_setActiveTab = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_setCallback =
+R"doc(Sets the callable objects which is invoked when a tab is changed. The
+argument provided to the callback is the index of the new active tab.)doc";
+
+static const char *__doc_nanogui_TabWidget_tab = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_tabCount = R"doc()doc";
+
+static const char *__doc_nanogui_TabWidget_tabIndex =
+R"doc(Retrieves the index of a specific tab using a widget pointer. Returns
+-1 if there is no such tab.)doc";
+
+static const char *__doc_nanogui_TabWidget_tabLabelAt = R"doc(Retrieves the label of the tab at a specific index.)doc";
+
+static const char *__doc_nanogui_TabWidget_tabLabelIndex =
+R"doc(Retrieves the index of a specific tab using its tab label. Returns -1
+if there is no such tab.)doc";
+
+static const char *__doc_nanogui_TabWidget_tab_2 = R"doc()doc";
+
+static const char *__doc_nanogui_TableModel =
+R"doc(Data source of a TableView.
+
+The TableView sorts and filters its rows on a worker thread, which
+calls rowCount(), text(), lessThan() and accept() concurrently with
+the UI thread. Implementations must therefore allow concurrent reads.
+The table cancels the worker before it calls setText(), so edits need
+no synchronization; other changes to the data must not race with the
+worker either. After the data has changed, call
+TableView::modelChanged() to recompute the sort/filter index.)doc";
+
+static const char *__doc_nanogui_TableModel_accept =
+R"doc(Return whether ``row`` should be shown for the given filter.
+
+The default implementation accepts rows where any cell contains
+``filter`` as a substring.)doc";
+
+static const char *__doc_nanogui_TableModel_columnCount = R"doc(Return the number of columns)doc";
+
+static const char *__doc_nanogui_TableModel_editable = R"doc(Return whether the given cell can be edited (``false`` by default))doc";
+
+static const char *__doc_nanogui_TableModel_headerText = R"doc(Return the caption of the given column (empty by default))doc";
+
+static const char *__doc_nanogui_TableModel_lessThan =
+R"doc(Ordering used when sorting by ``column.``
+
+The default implementation compares numerically when both cells
+contain numbers and lexicographically otherwise.)doc";
+
+static const char *__doc_nanogui_TableModel_rowCount = R"doc(Return the number of rows)doc";
+
+static const char *__doc_nanogui_TableModel_setText = R"doc(Store the edited text of a cell. Return ``false`` to reject the value.)doc";
+
+static const char *__doc_nanogui_TableModel_text = R"doc(Return the text of the given cell)doc";
+
+static const char *__doc_nanogui_TableView =
+R"doc(Scrollable table with row and column virtualization.
+
+Only the cells that intersect the visible area are queried from the
+TableModel, and their text is drawn directly with NanoVG. A single
+TextBox is created on demand when the user double-clicks an editable
+cell. The first fixedRowCount() rows and fixedColumnCount() columns
+stay in place while the rest of the table scrolls.
+
+Clicking a column header sorts the table by that column; clicking it
+again reverses the order. Sorting and filtering run on a worker thread
+that is owned by the table, and the previous ordering remains visible
+until the new one is available. A new sort or filter request cancels
+the one that is being computed.)doc";
+
+static const char *__doc_nanogui_TableView_IndexTask = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_TableView = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_callback =
+R"doc(Return the callback that is invoked with the model row when the user
+selects a row)doc";
+
+static const char *__doc_nanogui_TableView_cellAt =
+R"doc(Return the cell at the given position (relative to the parent).
+
+The result contains the sorted and filtered row (-1 for the header)
+and the column, or (-2, -2) if the position is outside of the cells.)doc";
+
+static const char *__doc_nanogui_TableView_closeEditor = R"doc(Write back the value of the editor and hide it)doc";
+
+static const char *__doc_nanogui_TableView_columnAtOffset =
+R"doc(Index of the column that contains the given x offset (relative to the
+first column))doc";
+
+static const char *__doc_nanogui_TableView_columnOffset = R"doc(Horizontal offset of the given column, relative to the first column)doc";
+
+static const char *__doc_nanogui_TableView_columnWidth = R"doc(Return the width of the given column)doc";
+
+static const char *__doc_nanogui_TableView_contentHeight = R"doc(Height of the scrolling rows)doc";
+
+static const char *__doc_nanogui_TableView_contentWidth = R"doc(Width of the scrolling columns)doc";
+
+static const char *__doc_nanogui_TableView_defaultColumnWidth = R"doc(Return the width of columns which have no explicit width)doc";
+
+static const char *__doc_nanogui_TableView_draw = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_drawCells =
+R"doc(Draw the rows [``r0,`` ``r1)`` of the columns [``c0,`` ``c1)`` with
+the top left corner at (``x,`` ``y)``)doc";
+
+static const char *__doc_nanogui_TableView_drawHeader =
+R"doc(Draw the header cells of the columns [``c0,`` ``c1)`` whose left edge
+is at ``x``)doc";
+
+static const char *__doc_nanogui_TableView_drawScrollBars = R"doc(Draw the scroll bars)doc";
+
+static const char *__doc_nanogui_TableView_editCell = R"doc(Open the editor on the given cell if the model allows editing it)doc";
+
+static const char *__doc_nanogui_TableView_fetchIndex = R"doc(Adopt the result of the worker thread once it is available)doc";
+
+static const char *__doc_nanogui_TableView_filter = R"doc(Return the current filter string)doc";
+
+static const char *__doc_nanogui_TableView_fixedColumnCount = R"doc(Return the number of leading columns which do not scroll horizontally)doc";
+
+static const char *__doc_nanogui_TableView_fixedColumns = R"doc(Number of non-scrolling columns, clamped to the columns of the model)doc";
+
+static const char *__doc_nanogui_TableView_fixedHeight = R"doc(Height of the header and the non-scrolling rows)doc";
+
+static const char *__doc_nanogui_TableView_fixedRowCount = R"doc(Return the number of leading rows which do not scroll vertically)doc";
+
+static const char *__doc_nanogui_TableView_fixedRows = R"doc(Number of non-scrolling rows, clamped to the rows of the model)doc";
+
+static const char *__doc_nanogui_TableView_fixedWidth = R"doc(Width of the non-scrolling columns)doc";
+
+static const char *__doc_nanogui_TableView_headerHeight = R"doc(Return the height of the column header in pixels (0 hides the header))doc";
+
+static const char *__doc_nanogui_TableView_indexPending = R"doc(Return whether a sort/filter computation is still running)doc";
+
+static const char *__doc_nanogui_TableView_keyboardEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_load = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mCallback = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mColumnOffsets = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mColumnWidths = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mColumnsDirty = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mDefaultColumnWidth = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mDragMode = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mEditColumn = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mEditRow = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mEditor = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mFilter = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mFixedColumnCount = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mFixedRowCount = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mHeaderHeight = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mIndex = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mIndexPending = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mIndexTask = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mIndexed = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mLastClick = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mModel = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mRowHeight = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mScrollX = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mScrollY = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mSelectedRow = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mSortAscending = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mSortColumn = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_model = R"doc(Return the data model)doc";
+
+static const char *__doc_nanogui_TableView_modelChanged = R"doc(Notify the table that the data of the model has changed)doc";
+
+static const char *__doc_nanogui_TableView_modelRow = R"doc(Return the model row shown at the given (sorted and filtered) position)doc";
+
+static const char *__doc_nanogui_TableView_model_2 = R"doc(Return the data model)doc";
+
+static const char *__doc_nanogui_TableView_mouseButtonEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_mouseDragEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_performLayout = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_preferredSize = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_rowCount = R"doc(Return the number of rows after filtering)doc";
+
+static const char *__doc_nanogui_TableView_rowHeight = R"doc(Return the height of each row in pixels)doc";
+
+static const char *__doc_nanogui_TableView_save = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_scrollEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TableView_scrollOffsetX =
+R"doc(Horizontal distance in pixels that the scrolling columns are scrolled
+by)doc";
+
+static const char *__doc_nanogui_TableView_scrollOffsetY = R"doc(Vertical distance in pixels that the scrolling rows are scrolled by)doc";
+
+static const char *__doc_nanogui_TableView_scrollToRow =
+R"doc(Scroll the minimal amount that is needed to make the given (sorted and
+filtered) row visible)doc";
+
+static const char *__doc_nanogui_TableView_scrollX = R"doc(Return the horizontal scroll amount as a value between 0 and 1)doc";
+
+static const char *__doc_nanogui_TableView_scrollY = R"doc(Return the vertical scroll amount as a value between 0 and 1)doc";
+
+static const char *__doc_nanogui_TableView_selectedRow = R"doc(Return the selected model row (or -1 if there is none))doc";
+
+static const char *__doc_nanogui_TableView_setCallback =
+R"doc(Set the callback that is invoked with the model row when the user
+selects a row)doc";
+
+static const char *__doc_nanogui_TableView_setColumnWidth = R"doc(Set the width of the given column)doc";
+
+static const char *__doc_nanogui_TableView_setDefaultColumnWidth = R"doc(Set the width of columns which have no explicit width)doc";
+
+static const char *__doc_nanogui_TableView_setFilter = R"doc(Only show the rows that are accepted by TableModel::accept())doc";
+
+static const char *__doc_nanogui_TableView_setFixedColumnCount = R"doc(Set the number of leading columns which do not scroll horizontally)doc";
+
+static const char *__doc_nanogui_TableView_setFixedRowCount = R"doc(Set the number of leading rows which do not scroll vertically)doc";
+
+static const char *__doc_nanogui_TableView_setHeaderHeight = R"doc(Set the height of the column header in pixels (0 hides the header))doc";
+
+static const char *__doc_nanogui_TableView_setModel = R"doc(Set the data model)doc";
+
+static const char *__doc_nanogui_TableView_setRowHeight = R"doc(Set the height of each row in pixels)doc";
+
+static const char *__doc_nanogui_TableView_setScrollX = R"doc(Set the horizontal scroll amount to a value between 0 and 1)doc";
+
+static const char *__doc_nanogui_TableView_setScrollY = R"doc(Set the vertical scroll amount to a value between 0 and 1)doc";
+
+static const char *__doc_nanogui_TableView_setSelectedRow = R"doc(Select the given model row (-1 clears the selection))doc";
+
+static const char *__doc_nanogui_TableView_sortAscending = R"doc(Return whether the table is sorted in ascending order)doc";
+
+static const char *__doc_nanogui_TableView_sortByColumn = R"doc(Sort by the given column (-1 restores the order of the model))doc";
+
+static const char *__doc_nanogui_TableView_sortColumn = R"doc(Return the column used for sorting (or -1 if the table is unsorted))doc";
+
+static const char *__doc_nanogui_TableView_updateColumns = R"doc(Recompute the column offsets if the widths have changed)doc";
+
+static const char *__doc_nanogui_TableView_updateIndex = R"doc(Start recomputing the sort/filter index on the worker thread)doc";
+
+static const char *__doc_nanogui_TableView_viewRow =
+R"doc(Return the (sorted and filtered) position of the given model row, or
+-1 if it is not shown)doc";
+
+static const char *__doc_nanogui_TableView_viewSize = R"doc(Size of the area available to the cells (i.e. without the scroll bars))doc";
+
+static const char *__doc_nanogui_TextArea =
+R"doc(Scrollable, editable multi-line text field for large documents.
+
+The text is stored in a TextBuffer, so editing a multi-megabyte
+document only touches the piece table. Lines have a fixed height and
+are virtualized like the rows of a TreeView: only the visible lines
+are extracted, measured and drawn. The glyph positions of a line are
+computed with TextMetrics when the line first becomes visible and are
+kept until the line is edited, and long lines only draw the glyphs
+that intersect the view.
+
+The text uses the embedded ``"sans"`` face. The preferred size shows
+ten lines independently of the contents, so edits never invalidate the
+layout.)doc";
+
+static const char *__doc_nanogui_TextArea_LineLayout = R"doc(Text and glyph positions of a line)doc";
+
+static const char *__doc_nanogui_TextArea_LineLayout_glyphs = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_LineLayout_text = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_LineLayout_width = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_TextArea = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_append = R"doc(Append text at the end of the document without moving the cursor)doc";
+
+static const char *__doc_nanogui_TextArea_buffer = R"doc(Return the underlying text buffer)doc";
+
+static const char *__doc_nanogui_TextArea_callback = R"doc(Return the callback that is invoked whenever the user changes the text)doc";
+
+static const char *__doc_nanogui_TextArea_contentHeight = R"doc(Height of the document in pixels)doc";
+
+static const char *__doc_nanogui_TextArea_copySelection = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_cursorPosition = R"doc(Return the byte offset of the cursor)doc";
+
+static const char *__doc_nanogui_TextArea_draw = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_editable = R"doc(Return whether the user can edit the text)doc";
+
+static const char *__doc_nanogui_TextArea_insert =
+R"doc(Replace the selection (or insert at the cursor) and invoke the
+callback)doc";
+
+static const char *__doc_nanogui_TextArea_invalidateLines =
+R"doc(Drop the cached layout of ``line``, and of all following lines if
+``following`` is set)doc";
+
+static const char *__doc_nanogui_TextArea_keyboardCharacterEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_keyboardEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TextArea_lineHeight = R"doc(Return the height of a line in pixels)doc";
+
+static const char *__doc_nanogui_TextArea_lineLayout = R"doc(Return the layout of the given line, computing it if needed)doc";
+
+static const char *__doc_nanogui_TextArea_load = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget =
-R"doc(A wrapper around the widgets TabHeader and StackedWidget which hooks
-the two classes together.)doc";
+static const char *__doc_nanogui_TextArea_mBuffer = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_TabWidget = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mCallback = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_activeTab = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mCursorPos = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_addTab =
-R"doc(Inserts a tab at the end of the tabs collection and associates it with
-the provided widget.)doc";
+static const char *__doc_nanogui_TextArea_mDragScrollbar =
+R"doc(Whether the current drag moves the scroll bar (otherwise it selects
+text))doc";
 
-static const char *__doc_nanogui_TabWidget_addTab_2 =
-R"doc(Inserts a tab into the tabs collection at the specified index and
-associates it with the provided widget.)doc";
+static const char *__doc_nanogui_TextArea_mEditable = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_callback = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mLastClick = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_createTab =
-R"doc(Creates a new tab with the specified name and returns a pointer to the
-layer.)doc";
+static const char *__doc_nanogui_TextArea_mLayoutFontSize = R"doc(Font size and pixel ratio of the cached layouts)doc";
 
-static const char *__doc_nanogui_TabWidget_createTab_2 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mLayoutPixelRatio = R"doc(Font size and pixel ratio of the cached layouts)doc";
 
-static const char *__doc_nanogui_TabWidget_draw = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mLineLayouts = R"doc(Layouts of recently visible lines)doc";
 
-static const char *__doc_nanogui_TabWidget_ensureTabVisible =
-R"doc(This function can be invoked to ensure that the tab with the provided
-index the is visible, i.e to track the given tab. Forwards to the tab
-header widget. This function should be used whenever the client wishes
-to make the tab header follow a newly added tab, as the content of the
-new tab is made visible but the tab header does not track it by
-default.)doc";
+static const char *__doc_nanogui_TextArea_mPreferredX =
+R"doc(Horizontal position that vertical cursor movement tries to keep (-1 if
+unset))doc";
 
-static const char *__doc_nanogui_TabWidget_mCallback = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mScrollX =
+R"doc(Distance in pixels between the left of the text and the left of the
+view)doc";
 
-static const char *__doc_nanogui_TabWidget_mContent = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mScrollY =
+R"doc(Distance in pixels between the top of the document and the top of the
+view)doc";
 
-static const char *__doc_nanogui_TabWidget_mHeader = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mSelection = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_operator_delete = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mouseButtonEvent = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_operator_delete_2 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_mouseDragEvent = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_operator_delete_3 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_moveCursor = R"doc(Move the cursor, extending the selection if ``extend`` is set)doc";
 
-static const char *__doc_nanogui_TabWidget_operator_delete_4 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_nextCharacter = R"doc(Return the start of the character following ``pos``)doc";
 
-static const char *__doc_nanogui_TabWidget_operator_delete_5 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_offsetToX = R"doc(Return the horizontal position of a byte offset within a line)doc";
 
-static const char *__doc_nanogui_TabWidget_operator_delete_6 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_pasteFromClipboard = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_operator_delete_7 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_positionAt =
+R"doc(Return the byte offset closest to the given position (relative to the
+parent))doc";
 
-static const char *__doc_nanogui_TabWidget_operator_new = R"doc()doc";
+static const char *__doc_nanogui_TextArea_preferredSize = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_operator_new_2 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_previousCharacter = R"doc(Return the start of the character preceding ``pos``)doc";
 
-static const char *__doc_nanogui_TabWidget_operator_new_3 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_replace = R"doc(Replace the range [begin, end) and invoke the callback)doc";
 
-static const char *__doc_nanogui_TabWidget_operator_new_4 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_save = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_operator_new_5 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_scrollEvent = R"doc()doc";
 
-static const char *__doc_nanogui_TabWidget_performLayout = R"doc()doc";
+static const char *__doc_nanogui_TextArea_scrollToCursor = R"doc(Scroll the minimal amount that is needed to make the cursor visible)doc";
 
-static const char *__doc_nanogui_TabWidget_preferredSize = R"doc()doc";
+static const char *__doc_nanogui_TextArea_scrollToLine =
+R"doc(Scroll the minimal amount that is needed to make the given line
+visible)doc";
 
-static const char *__doc_nanogui_TabWidget_removeTab =
-R"doc(Removes the tab with the specified label and returns the index of the
-label. Returns whether the removal was successful.)doc";
+static const char *__doc_nanogui_TextArea_select =
+R"doc(Select the text between ``start`` and ``end`` (the cursor is placed at
+``end``))doc";
 
-static const char *__doc_nanogui_TabWidget_removeTab_2 = R"doc(Removes the tab with the specified index.)doc";
+static const char *__doc_nanogui_TextArea_selectedText = R"doc(Return the selected text)doc";
 
-static const char *__doc_nanogui_TabWidget_setActiveTab = R"doc()doc";
+static const char *__doc_nanogui_TextArea_selectionStart =
+R"doc(Return the byte offset where the selection starts
+(``std::string::npos`` if nothing is selected))doc";
 
-static const char *__doc_nanogui_TabWidget_setCallback =
-R"doc(Sets the callable objects which is invoked when a tab is changed. The
-argument provided to the callback is the index of the new active tab.)doc";
+static const char *__doc_nanogui_TextArea_setCallback = R"doc(Set the callback that is invoked whenever the user changes the text)doc";
 
-static const char *__doc_nanogui_TabWidget_tab = R"doc()doc";
+static const char *__doc_nanogui_TextArea_setCursorPosition = R"doc(Move the cursor (clears the selection))doc";
 
-static const char *__doc_nanogui_TabWidget_tabCount = R"doc()doc";
+static const char *__doc_nanogui_TextArea_setEditable = R"doc(Set whether the user can edit the text)doc";
 
-static const char *__doc_nanogui_TabWidget_tabIndex =
-R"doc(Retrieves the index of a specific tab using a widget pointer. Returns
--1 if there is no such tab.)doc";
+static const char *__doc_nanogui_TextArea_setValue =
+R"doc(Replace the document (moves the cursor to the start and scrolls to the
+top))doc";
 
-static const char *__doc_nanogui_TabWidget_tabLabelAt = R"doc(Retrieves the label of the tab at a specific index.)doc";
+static const char *__doc_nanogui_TextArea_value = R"doc(Return the document)doc";
 
-static const char *__doc_nanogui_TabWidget_tabLabelIndex =
-R"doc(Retrieves the index of a specific tab using its tab label. Returns -1
-if there is no such tab.)doc";
+static const char *__doc_nanogui_TextArea_viewWidth = R"doc(Width of the area in which text is drawn)doc";
 
-static const char *__doc_nanogui_TabWidget_tab_2 = R"doc()doc";
+static const char *__doc_nanogui_TextArea_xToOffset =
+R"doc(Return the byte offset within a line that is closest to a horizontal
+position)doc";
 
 static const char *__doc_nanogui_TextBox =
 R"doc(Fancy text box with builtin regular expression-based validation.
@@ -3135,6 +4606,8 @@ static const char *__doc_nanogui_TextBox_SpinArea_Top = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_TextBox = R"doc()doc";
 
+static const char *__doc_nanogui_TextBox_Validator = R"doc(Compiled form of a format)doc";
+
 static const char *__doc_nanogui_TextBox_alignment = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_callback = R"doc(The callback to execute when the value of this TextBox has changed.)doc";
@@ -3143,7 +4616,9 @@ static const char *__doc_nanogui_TextBox_checkFormat = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_copySelection = R"doc()doc";
 
-static const char *__doc_nanogui_TextBox_cursorIndex2Position = R"doc()doc";
+static const char *__doc_nanogui_TextBox_cursorIndex2Position =
+R"doc(Return the horizontal position of the cursor index (``originx`` is the
+left edge of the text))doc";
 
 static const char *__doc_nanogui_TextBox_defaultValue = R"doc()doc";
 
@@ -3177,6 +4652,16 @@ static const char *__doc_nanogui_TextBox_mEditable = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_mFormat = R"doc()doc";
 
+static const char *__doc_nanogui_TextBox_mGlyphFontSize = R"doc(The font size and pixel ratio of mGlyphs)doc";
+
+static const char *__doc_nanogui_TextBox_mGlyphPixelRatio = R"doc(The font size and pixel ratio of mGlyphs)doc";
+
+static const char *__doc_nanogui_TextBox_mGlyphText = R"doc(The text that is described by mGlyphs)doc";
+
+static const char *__doc_nanogui_TextBox_mGlyphWidth = R"doc(The advance of mGlyphText)doc";
+
+static const char *__doc_nanogui_TextBox_mGlyphs = R"doc(Glyph positions of mGlyphText, relative to the start of the text)doc";
+
 static const char *__doc_nanogui_TextBox_mLastClick = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_mMouseDownModifier = R"doc()doc";
@@ -3201,6 +4686,8 @@ static const char *__doc_nanogui_TextBox_mUnitsImage = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_mValidFormat = R"doc()doc";
 
+static const char *__doc_nanogui_TextBox_mValidator = R"doc()doc";
+
 static const char *__doc_nanogui_TextBox_mValue = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_mValueTemp = R"doc()doc";
@@ -3241,7 +4728,9 @@ static const char *__doc_nanogui_TextBox_placeholder =
 R"doc(Return the placeholder text to be displayed while the text box is
 empty.)doc";
 
-static const char *__doc_nanogui_TextBox_position2CursorIndex = R"doc()doc";
+static const char *__doc_nanogui_TextBox_position2CursorIndex =
+R"doc(Return the cursor index that is closest to a horizontal position
+(``originx`` is the left edge of the text))doc";
 
 static const char *__doc_nanogui_TextBox_preferredSize = R"doc()doc";
 
@@ -3257,7 +4746,12 @@ static const char *__doc_nanogui_TextBox_setDefaultValue = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_setEditable = R"doc()doc";
 
-static const char *__doc_nanogui_TextBox_setFormat = R"doc(Specify a regular expression specifying valid formats)doc";
+static const char *__doc_nanogui_TextBox_setFormat =
+R"doc(Specify a regular expression specifying valid formats.
+
+The expression is compiled once and shared between all text boxes with
+the same format. The integer and floating point formats of IntBox and
+FloatBox are checked without regular expressions.)doc";
 
 static const char *__doc_nanogui_TextBox_setPlaceholder =
 R"doc(Specify a placeholder text to be displayed while the text box is
@@ -3281,10 +4775,239 @@ static const char *__doc_nanogui_TextBox_units = R"doc()doc";
 
 static const char *__doc_nanogui_TextBox_unitsImage = R"doc()doc";
 
-static const char *__doc_nanogui_TextBox_updateCursor = R"doc()doc";
+static const char *__doc_nanogui_TextBox_updateCursor =
+R"doc(Apply pending mouse clicks and drags to the cursor (``originx`` is the
+left edge of the text))doc";
+
+static const char *__doc_nanogui_TextBox_updateGlyphPositions =
+R"doc(Bring the cached glyph positions up to date with the edited text.
+
+Only the glyphs between the common prefix and suffix of the previous
+and the current text are measured again (together with their
+neighbors, which may be kerned against them); the glyphs of the suffix
+are shifted.)doc";
+
+static const char *__doc_nanogui_TextBox_validator =
+R"doc(Return the shared compiled form of a format (``nullptr`` if the format
+is empty))doc";
 
 static const char *__doc_nanogui_TextBox_value = R"doc()doc";
 
+static const char *__doc_nanogui_TextBuffer =
+R"doc(Piece table that stores a UTF-8 document and indexes its lines.
+
+The document is described by a sequence of pieces which refer either
+to the original text or to an append-only buffer of inserted text, so
+edits never move the bulk of a large document. The positions of the
+newlines of both buffers are recorded once, which makes counting the
+newlines of a piece a pair of binary searches. Finding the start of a
+line or the line of a position therefore takes logarithmic time in the
+number of pieces and newlines. Consecutive insertions (e.g. typing)
+extend the previous piece instead of adding new ones.
+
+Positions are byte offsets into the document.)doc";
+
+static const char *__doc_nanogui_TextBuffer_Piece = R"doc(Range of the original or the added buffer)doc";
+
+static const char *__doc_nanogui_TextBuffer_Piece_added = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_Piece_length = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_Piece_start = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_TextBuffer = R"doc(Create a buffer with the given contents)doc";
+
+static const char *__doc_nanogui_TextBuffer_countNewlines = R"doc(Count the newlines within the first ``length`` bytes of a piece)doc";
+
+static const char *__doc_nanogui_TextBuffer_erase = R"doc(Remove ``length`` bytes starting at ``pos``)doc";
+
+static const char *__doc_nanogui_TextBuffer_findPiece =
+R"doc(Return the index of the piece containing ``pos`` (the last piece if
+``pos`` is the size))doc";
+
+static const char *__doc_nanogui_TextBuffer_insert = R"doc(Insert text at the given position)doc";
+
+static const char *__doc_nanogui_TextBuffer_line = R"doc(Return the contents of the given line without its newline)doc";
+
+static const char *__doc_nanogui_TextBuffer_lineCount = R"doc(Return the number of lines (one more than the number of newlines))doc";
+
+static const char *__doc_nanogui_TextBuffer_lineEnd =
+R"doc(Return the position of the newline that ends the given line (or the
+size of the document))doc";
+
+static const char *__doc_nanogui_TextBuffer_lineOf = R"doc(Return the line that contains the given position)doc";
+
+static const char *__doc_nanogui_TextBuffer_lineStart = R"doc(Return the position of the first byte of the given line)doc";
+
+static const char *__doc_nanogui_TextBuffer_mAdded = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_mAddedNewlines = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_mLines = R"doc(Number of newlines preceding each piece)doc";
+
+static const char *__doc_nanogui_TextBuffer_mNewlines = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_mOffsets = R"doc(Position of the first byte of each piece)doc";
+
+static const char *__doc_nanogui_TextBuffer_mOriginal = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_mOriginalNewlines = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_mPieces = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_mSize = R"doc()doc";
+
+static const char *__doc_nanogui_TextBuffer_newlines = R"doc(Return the newline positions of the buffer that a piece refers to)doc";
+
+static const char *__doc_nanogui_TextBuffer_pieceCount = R"doc(Return the number of pieces (for diagnostics))doc";
+
+static const char *__doc_nanogui_TextBuffer_setText = R"doc(Replace the whole document)doc";
+
+static const char *__doc_nanogui_TextBuffer_size = R"doc(Return the size of the document in bytes)doc";
+
+static const char *__doc_nanogui_TextBuffer_source = R"doc(Return the buffer that a piece refers to)doc";
+
+static const char *__doc_nanogui_TextBuffer_text = R"doc(Return the whole document)doc";
+
+static const char *__doc_nanogui_TextBuffer_text_2 = R"doc(Return ``length`` bytes starting at ``pos``)doc";
+
+static const char *__doc_nanogui_TextBuffer_update =
+R"doc(Recompute the offsets and newline counts of the pieces starting at
+index ``first``)doc";
+
+static const char *__doc_nanogui_TextMetrics =
+R"doc(Measures text by reading TrueType fonts directly, without a NanoVG
+context.
+
+The faces ``"sans"``, ``"sans-bold"`` and ``"icons"`` are read from
+the ResourcePack when they are first used, and further faces can be
+added with addFont(). The results reproduce the measurements of NanoVG
+(kerning, rounding of glyph advances and the bounds of glyph quads) at
+a given pixel ratio, so layouts computed with either agree. Every
+Screen registers the ratio of its NanoVG context, which the functions
+that take a context use. The other functions take the ratio as an
+argument; when it is 0, they use the default ratio of
+setPixelRatio(float).
+
+All functions are thread-safe and work without OpenGL, which makes it
+possible to compute layouts headless or on worker threads. Glyph
+indices and advances are cached per face; the first 128 code points
+are resolved when the face is loaded, so measuring ASCII text does not
+lock.
+
+Complete measurements are kept in a shared cache with least recently
+used eviction, keyed on the face, size, letter spacing, pixel ratio
+and the length and 64 bit hash of the string. Captions, titles and tab
+labels that are measured every frame are therefore only laid out once.)doc";
+
+static const char *__doc_nanogui_TextMetrics_GlyphPosition = R"doc(Position of a glyph within a string (like ``NVGglyphPosition``).)doc";
+
+static const char *__doc_nanogui_TextMetrics_GlyphPosition_maxx = R"doc(Right edge of the glyph quad or the next pen position, whichever is larger)doc";
+
+static const char *__doc_nanogui_TextMetrics_GlyphPosition_minx = R"doc(Left edge of the glyph quad or the pen position, whichever is smaller)doc";
+
+static const char *__doc_nanogui_TextMetrics_GlyphPosition_offset = R"doc(Byte offset of the glyph in the string)doc";
+
+static const char *__doc_nanogui_TextMetrics_GlyphPosition_x = R"doc(Position of the pen before the glyph is drawn)doc";
+
+static const char *__doc_nanogui_TextMetrics_addFont =
+R"doc(Register a TrueType font under the given name.
+
+The data is not copied and must stay valid until the program exits.
+Returns a handle to the face, or -1 if the data could not be parsed.)doc";
+
+static const char *__doc_nanogui_TextMetrics_cacheCapacity = R"doc(Return the maximum number of cached measurements (default: 4096))doc";
+
+static const char *__doc_nanogui_TextMetrics_cacheHits = R"doc(Return how many measurements were answered from the cache)doc";
+
+static const char *__doc_nanogui_TextMetrics_cacheMisses = R"doc(Return how many measurements were not found in the cache)doc";
+
+static const char *__doc_nanogui_TextMetrics_clearCache = R"doc(Remove all cached measurements)doc";
+
+static const char *__doc_nanogui_TextMetrics_findFont =
+R"doc(Return the handle of the face with the given name, or -1 if it is
+unknown)doc";
+
+static const char *__doc_nanogui_TextMetrics_fontHash =
+R"doc(Return a 64 bit hash of the font data of a face (computed on first
+use))doc";
+
+static const char *__doc_nanogui_TextMetrics_fontName = R"doc(Return the name of a face)doc";
+
+static const char *__doc_nanogui_TextMetrics_glyphPositions =
+R"doc(Compute the positions of all glyphs of a string (like
+``nvgTextGlyphPositions``, but without a limit on the count).
+
+The positions are relative to the start of the string and are not
+cached. Returns the horizontal advance.)doc";
+
+static const char *__doc_nanogui_TextMetrics_glyphPositions_2 =
+R"doc(Compute the glyph positions of ``text`` in the given face.
+
+Falls back to NanoVG (which changes the font state of ``ctx``) if the
+face is not known to TextMetrics. The fallback holds a LayoutLock.)doc";
+
+static const char *__doc_nanogui_TextMetrics_pixelRatio =
+R"doc(Return the default ratio between framebuffer pixels and logical
+pixels, which is used for rounding when no ratio is given)doc";
+
+static const char *__doc_nanogui_TextMetrics_pixelRatio_2 =
+R"doc(Return the pixel ratio registered for a NanoVG context, or the default
+ratio if there is none)doc";
+
+static const char *__doc_nanogui_TextMetrics_quantizeFontSize =
+R"doc(Snap a font size to a geometric series of sizes in framebuffer pixels
+(at the given pixel ratio, or the default one if it is 0).
+
+NanoVG rasterizes the glyphs of every distinct size (in steps of 0.1
+framebuffer pixels) into its atlas. Text whose size follows a zoom
+factor should be drawn at a snapped size, so that zooming reuses a
+bounded set of rasterized glyphs. Sizes differ by at most half a step
+(about 4.4% with the default of 8 steps per octave) plus the rounding
+to 0.1 pixels.)doc";
+
+static const char *__doc_nanogui_TextMetrics_resetCacheStatistics = R"doc(Reset the hit and miss counters)doc";
+
+static const char *__doc_nanogui_TextMetrics_setCacheCapacity = R"doc(Set the maximum number of cached measurements (0 disables the cache))doc";
+
+static const char *__doc_nanogui_TextMetrics_setPixelRatio =
+R"doc(Set the default ratio between framebuffer pixels and logical pixels (1
+unless changed, e.g. for headless layouts))doc";
+
+static const char *__doc_nanogui_TextMetrics_setPixelRatio_2 =
+R"doc(Register the pixel ratio of a NanoVG context (each Screen keeps its
+own up to date); 0 removes it)doc";
+
+static const char *__doc_nanogui_TextMetrics_textBounds =
+R"doc(Compute the bounding box of a string drawn at the origin with
+left/baseline alignment (like ``nvgTextBounds``).
+
+The box is stored as ``[xmin, ymin, xmax, ymax]`` in ``bounds``;
+its height is the line height. Returns the horizontal advance.)doc";
+
+static const char *__doc_nanogui_TextMetrics_textBounds_2 =
+R"doc(Compute the bounds of ``text`` in the given face.
+
+Falls back to NanoVG (which changes the font state of ``ctx``) if the
+face is not known to TextMetrics. The fallback holds a LayoutLock.)doc";
+
+static const char *__doc_nanogui_TextMetrics_textWidth =
+R"doc(Return the horizontal advance of a string (like the return value of
+``nvgTextBounds``).
+
+Parameter ``end``:
+    End of the string, or ``nullptr`` if the string is null-terminated)doc";
+
+static const char *__doc_nanogui_TextMetrics_textWidth_2 =
+R"doc(Return the advance of ``text`` in the given face.
+
+Falls back to NanoVG (which changes the font state of ``ctx``) if the
+face is not known to TextMetrics. The fallback holds a LayoutLock.)doc";
+
+static const char *__doc_nanogui_TextMetrics_verticalMetrics =
+R"doc(Return the ascender, descender and line height of a face (like
+``nvgTextMetrics``))doc";
+
 static const char *__doc_nanogui_Theme = R"doc(Storage class for basic theme-related properties.)doc";
 
 static const char *__doc_nanogui_Theme_Theme = R"doc()doc";
@@ -3514,6 +5237,49 @@ static const char *__doc_nanogui_Theme_operator_new_4 = R"doc()doc";
 
 static const char *__doc_nanogui_Theme_operator_new_5 = R"doc()doc";
 
+static const char *__doc_nanogui_TiledImage =
+R"doc(Data source of an image that an ImageView loads tile by tile.
+
+The image is split into a mip pyramid: level 0 has the full
+resolution, and each further level halves the size of the previous one
+(rounding up) until the whole image fits into a single tile. Every
+level is divided into square tiles of tileSize() pixels.
+
+The ImageView only requests the tiles of the level that matches its
+zoom factor and that intersect the visible region. It calls readTile()
+on loader threads, concurrently with the UI thread and with itself, so
+implementations must allow concurrent reads.)doc";
+
+static const char *__doc_nanogui_TiledImage_TiledImage = R"doc()doc";
+
+static const char *__doc_nanogui_TiledImage_levelCount = R"doc(Return the number of levels of the pyramid)doc";
+
+static const char *__doc_nanogui_TiledImage_levelSize = R"doc(Return the size of the image at the given level)doc";
+
+static const char *__doc_nanogui_TiledImage_mLevelCount = R"doc()doc";
+
+static const char *__doc_nanogui_TiledImage_mSize = R"doc()doc";
+
+static const char *__doc_nanogui_TiledImage_mTileSize = R"doc()doc";
+
+static const char *__doc_nanogui_TiledImage_readTile =
+R"doc(Read the pixels of a tile.
+
+``pixels`` has room for a full tile of RGBA pixels with 8 bits per
+channel, stored row by row. Only the valid pixels reported by
+tilePixels() are used, and rows are always tileSize() pixels apart.
+Return ``false`` if the tile could not be read.)doc";
+
+static const char *__doc_nanogui_TiledImage_size = R"doc(Return the size of the image at full resolution)doc";
+
+static const char *__doc_nanogui_TiledImage_tileCount = R"doc(Return the number of tiles in each direction at the given level)doc";
+
+static const char *__doc_nanogui_TiledImage_tilePixels =
+R"doc(Return the number of valid pixels of a tile, which is smaller than the
+tile size at the right and bottom edges)doc";
+
+static const char *__doc_nanogui_TiledImage_tileSize = R"doc(Return the width and height of a tile in pixels)doc";
+
 static const char *__doc_nanogui_ToolButton = R"doc(Simple radio+toggle button with an icon.)doc";
 
 static const char *__doc_nanogui_ToolButton_ToolButton = R"doc()doc";
@@ -3542,6 +5308,150 @@ static const char *__doc_nanogui_ToolButton_operator_new_4 = R"doc()doc";
 
 static const char *__doc_nanogui_ToolButton_operator_new_5 = R"doc()doc";
 
+static const char *__doc_nanogui_TreeModel =
+R"doc(Data source of a TreeView.
+
+Nodes are identified by opaque 64 bit identifiers chosen by the model
+(e.g. an index into a node array, or a pointer). The invisible root
+node has the identifier 0. The tree view only asks for the children of
+nodes that the user has expanded, and only for the text of visible
+rows.)doc";
+
+static const char *__doc_nanogui_TreeModel_child = R"doc(Return the identifier of the child of ``node`` at position ``index``)doc";
+
+static const char *__doc_nanogui_TreeModel_childCount = R"doc(Return the number of children of the given node)doc";
+
+static const char *__doc_nanogui_TreeModel_hasChildren =
+R"doc(Return whether the given node can be expanded.
+
+The default implementation calls childCount(). Models where counting
+children is expensive (e.g. directories) should override this.)doc";
+
+static const char *__doc_nanogui_TreeModel_icon = R"doc(Return the icon of the given node (0 means no icon))doc";
+
+static const char *__doc_nanogui_TreeModel_text = R"doc(Return the text of the given node)doc";
+
+static const char *__doc_nanogui_TreeView =
+R"doc(Scrollable tree of fixed-height rows backed by a TreeModel.
+
+The view does not mirror the tree. It only stores the nodes that are
+expanded, together with the number of visible rows below each of them,
+so the memory usage is independent of the size of the tree. Mapping a
+row index to a node takes a binary search per level of expanded
+ancestors, and rows are drawn directly with NanoVG.)doc";
+
+static const char *__doc_nanogui_TreeView_TreeView = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_callback =
+R"doc(Return the callback that is invoked with the node when the user
+selects a row)doc";
+
+static const char *__doc_nanogui_TreeView_collapseAll = R"doc(Collapse all nodes)doc";
+
+static const char *__doc_nanogui_TreeView_contentHeight = R"doc(Total height of all rows in pixels)doc";
+
+static const char *__doc_nanogui_TreeView_depth =
+R"doc(Return the depth of the node shown in the given row (0 for children of
+the root))doc";
+
+static const char *__doc_nanogui_TreeView_draw = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_expanded = R"doc(Return whether the node shown in the given row is expanded)doc";
+
+static const char *__doc_nanogui_TreeView_indent = R"doc(Return the horizontal indentation per tree level in pixels)doc";
+
+static const char *__doc_nanogui_TreeView_keyboardEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_load = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_lookup = R"doc(Find the node that is shown in the given row)doc";
+
+static const char *__doc_nanogui_TreeView_mCallback = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mIndent = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mLastClick = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mModel = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mRoot = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mRowHeight = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mScroll = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mSelectedRow = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_model = R"doc(Return the data model)doc";
+
+static const char *__doc_nanogui_TreeView_modelChanged =
+R"doc(Notify the view that the structure of the model has changed.
+
+Expanded nodes stay expanded as long as they can still be found at the
+same position below their parent.)doc";
+
+static const char *__doc_nanogui_TreeView_model_2 = R"doc(Return the data model)doc";
+
+static const char *__doc_nanogui_TreeView_mouseButtonEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_mouseDragEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_node = R"doc(Return the node shown in the given row)doc";
+
+static const char *__doc_nanogui_TreeView_parentRow =
+R"doc(Return the row of the parent of the node shown in the given row (-1
+for children of the root))doc";
+
+static const char *__doc_nanogui_TreeView_preferredSize = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_rowAt = R"doc(Return the row at the given position (relative to the parent), or -1)doc";
+
+static const char *__doc_nanogui_TreeView_rowCount = R"doc(Return the number of visible rows)doc";
+
+static const char *__doc_nanogui_TreeView_rowHeight = R"doc(Return the height of each row in pixels)doc";
+
+static const char *__doc_nanogui_TreeView_save = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_scroll =
+R"doc(Return the current scroll amount as a value between 0 and 1. 0 means
+scrolled to the top and 1 to the bottom.)doc";
+
+static const char *__doc_nanogui_TreeView_scrollEvent = R"doc()doc";
+
+static const char *__doc_nanogui_TreeView_scrollOffset =
+R"doc(Distance in pixels between the top of the first row and the top of the
+view)doc";
+
+static const char *__doc_nanogui_TreeView_scrollToRow = R"doc(Scroll the minimal amount that is needed to make the given row visible)doc";
+
+static const char *__doc_nanogui_TreeView_selectRow = R"doc(Select a row and invoke the callback)doc";
+
+static const char *__doc_nanogui_TreeView_selectedRow = R"doc(Return the selected row (or -1 if there is none))doc";
+
+static const char *__doc_nanogui_TreeView_setCallback =
+R"doc(Set the callback that is invoked with the node when the user selects a
+row)doc";
+
+static const char *__doc_nanogui_TreeView_setExpanded = R"doc(Expand or collapse the node shown in the given row)doc";
+
+static const char *__doc_nanogui_TreeView_setIndent = R"doc(Set the horizontal indentation per tree level in pixels)doc";
+
+static const char *__doc_nanogui_TreeView_setModel = R"doc(Set the data model (collapses all nodes))doc";
+
+static const char *__doc_nanogui_TreeView_setRowHeight = R"doc(Set the height of each row in pixels)doc";
+
+static const char *__doc_nanogui_TreeView_setScroll =
+R"doc(Set the scroll amount to a value between 0 and 1. 0 means scrolled to
+the top and 1 to the bottom.)doc";
+
+static const char *__doc_nanogui_TreeView_setSelectedRow = R"doc(Set the selected row (-1 clears the selection))doc";
+
+static const char *__doc_nanogui_TreeView_updateCounts = R"doc(Recompute the row counts of the given node and its ancestors)doc";
+
+static const char *__doc_nanogui_TreeView_validate =
+R"doc(Drop expanded children which are no longer found in the model (returns
+the updated row count))doc";
+
 static const char *__doc_nanogui_UniformBufferStd140 =
 R"doc(Helper class for accumulating uniform buffer data following the
 'std140' packing format.)doc";
@@ -3558,14 +5468,24 @@ a certain area.)doc";
 
 static const char *__doc_nanogui_VScrollPanel_VScrollPanel = R"doc()doc";
 
+static const char *__doc_nanogui_VScrollPanel_childOffset = R"doc(Scroll offset of the child in pixels for the current scroll amount)doc";
+
 static const char *__doc_nanogui_VScrollPanel_draw = R"doc()doc";
 
+static const char *__doc_nanogui_VScrollPanel_layoutChild = R"doc(Measure the child and place it according to the current scroll amount)doc";
+
 static const char *__doc_nanogui_VScrollPanel_load = R"doc()doc";
 
 static const char *__doc_nanogui_VScrollPanel_mChildPreferredHeight = R"doc()doc";
 
+static const char *__doc_nanogui_VScrollPanel_mLastFrame = R"doc()doc";
+
 static const char *__doc_nanogui_VScrollPanel_mScroll = R"doc()doc";
 
+static const char *__doc_nanogui_VScrollPanel_mScrollTarget = R"doc()doc";
+
+static const char *__doc_nanogui_VScrollPanel_mSmoothScrolling = R"doc()doc";
+
 static const char *__doc_nanogui_VScrollPanel_mUpdateLayout = R"doc()doc";
 
 static const char *__doc_nanogui_VScrollPanel_mouseDragEvent = R"doc()doc";
@@ -3610,6 +5530,10 @@ static const char *__doc_nanogui_VScrollPanel_setScroll =
 R"doc(Set the scroll amount to a value between 0 and 1. 0 means scrolled to
 the top and 1 to the bottom.)doc";
 
+static const char *__doc_nanogui_VScrollPanel_setSmoothScrolling = R"doc(Set whether mouse wheel scrolling is animated)doc";
+
+static const char *__doc_nanogui_VScrollPanel_smoothScrolling = R"doc(Return whether mouse wheel scrolling is animated)doc";
+
 static const char *__doc_nanogui_Widget =
 R"doc(Base class of all widgets.
 
@@ -3632,6 +5556,17 @@ parent)doc";
 
 static const char *__doc_nanogui_Widget_addChild_2 = R"doc(Convenience function which appends a widget at the end)doc";
 
+static const char *__doc_nanogui_Widget_cachedPreferredSize =
+R"doc(Return the preferred size of the widget, reusing the result of the
+previous call until invalidateLayout() is invoked.
+
+Layout generators use this function to measure child widgets, so that
+every widget is measured at most once per layout pass. Widgets whose
+preferred size depends on state other than their caption, font size,
+fixed size, theme, layout and visible children must call
+invalidateLayout() when that state changes. The current size, which is
+the preferred size of widgets without a layout, is never cached.)doc";
+
 static const char *__doc_nanogui_Widget_childAt = R"doc(Retrieves the child at the specific position)doc";
 
 static const char *__doc_nanogui_Widget_childAt_2 = R"doc(Retrieves the child at the specific position)doc";
@@ -3642,6 +5577,10 @@ static const char *__doc_nanogui_Widget_childIndex = R"doc(Returns the index of
 
 static const char *__doc_nanogui_Widget_children = R"doc(Return the list of child widgets of the current widget)doc";
 
+static const char *__doc_nanogui_Widget_clearLayoutDirty =
+R"doc(Clear the layout flags of this widget and its descendants before they
+are laid out)doc";
+
 static const char *__doc_nanogui_Widget_contains = R"doc(Check if the widget contains a certain position)doc";
 
 static const char *__doc_nanogui_Widget_cursor = R"doc(Return a pointer to the cursor of the widget)doc";
@@ -3668,6 +5607,15 @@ static const char *__doc_nanogui_Widget_fontSize =
 R"doc(Return current font size. If not set the default of the current theme
 will be returned)doc";
 
+static const char *__doc_nanogui_Widget_forEachParallel =
+R"doc(Invoke ``func`` on each of the given widgets, distributing them over
+the calling thread and up to layoutThreads() - 1 threads of a
+persistent worker pool.
+
+The widgets must be roots of disjoint subtrees. The function returns
+once all invocations have finished, and rethrows the first exception
+raised by one of them. Calls from a worker thread run serially.)doc";
+
 static const char *__doc_nanogui_Widget_hasFontSize = R"doc(Return whether the font size is explicitly specified for this widget)doc";
 
 static const char *__doc_nanogui_Widget_height = R"doc(Return the height of the widget)doc";
@@ -3688,12 +5636,36 @@ Remark:
 
 static const char *__doc_nanogui_Widget_id = R"doc(Return the ID value associated with this widget, if any)doc";
 
+static const char *__doc_nanogui_Widget_invalidateLayout =
+R"doc(Discard the cached preferred size of this widget and of all of its
+parents, and schedule the widget for updateLayout().
+
+This is called automatically when the caption, font size, fixed size,
+theme, layout, visibility or list of children of a widget changes, and
+when a parameter of its layout changes (see Layout::invalidate()).)doc";
+
 static const char *__doc_nanogui_Widget_keyboardCharacterEvent = R"doc(Handle text input (UTF-32 format) (default implementation: do nothing))doc";
 
 static const char *__doc_nanogui_Widget_keyboardEvent = R"doc(Handle a keyboard event (default implementation: do nothing))doc";
 
 static const char *__doc_nanogui_Widget_layout = R"doc(Return the used Layout generator)doc";
 
+static const char *__doc_nanogui_Widget_layoutPending =
+R"doc(Return whether this widget or one of its descendants awaits
+updateLayout())doc";
+
+static const char *__doc_nanogui_Widget_layoutSize =
+R"doc(Return the size requested from the layout of the parent (the preferred
+size with the fixed size applied))doc";
+
+static const char *__doc_nanogui_Widget_layoutThreads =
+R"doc(Return the number of threads used to lay out independent subtrees (see
+setLayoutThreads()))doc";
+
+static const char *__doc_nanogui_Widget_layoutValid =
+R"doc(Return whether the cached preferred size (see cachedPreferredSize())
+is up to date)doc";
+
 static const char *__doc_nanogui_Widget_layout_2 = R"doc(Return the used Layout generator)doc";
 
 static const char *__doc_nanogui_Widget_load = R"doc(Restore the state of the widget from the given Serializer instance)doc";
@@ -3748,16 +5720,38 @@ the :func:`nanogui::Widget::icon_scale` function.  Expected usage when
 
 static const char *__doc_nanogui_Widget_mId = R"doc()doc";
 
+static const char *__doc_nanogui_Widget_mLastLayoutSize =
+R"doc(Result of layoutSize() when the widget was last laid out (-1 if
+unknown))doc";
+
 static const char *__doc_nanogui_Widget_mLayout = R"doc()doc";
 
+static const char *__doc_nanogui_Widget_mLayoutDirty =
+R"doc(Whether this widget invoked invalidateLayout() since it was last laid
+out)doc";
+
 static const char *__doc_nanogui_Widget_mMouseFocus = R"doc()doc";
 
 static const char *__doc_nanogui_Widget_mParent = R"doc()doc";
 
 static const char *__doc_nanogui_Widget_mPos = R"doc()doc";
 
+static const char *__doc_nanogui_Widget_mPreferredSize =
+R"doc(The preferred size that was computed by the last call to
+cachedPreferredSize())doc";
+
+static const char *__doc_nanogui_Widget_mPreferredSizeIsSize =
+R"doc(Set when preferredSize() returned the current size, which is not
+cached)doc";
+
+static const char *__doc_nanogui_Widget_mPreferredSizeValid = R"doc(Whether mPreferredSize is up to date)doc";
+
 static const char *__doc_nanogui_Widget_mSize = R"doc()doc";
 
+static const char *__doc_nanogui_Widget_mSubtreeDirty =
+R"doc(Whether this widget or one of its descendants invoked
+invalidateLayout() since it was last laid out)doc";
+
 static const char *__doc_nanogui_Widget_mTheme = R"doc()doc";
 
 static const char *__doc_nanogui_Widget_mTooltip = R"doc()doc";
@@ -3766,6 +5760,17 @@ static const char *__doc_nanogui_Widget_mVisible =
 R"doc(Whether or not this Widget is currently visible. When a Widget is not
 currently visible, no time is wasted executing its drawing method.)doc";
 
+static const char *__doc_nanogui_Widget_markLayoutDirty =
+R"doc(Discard the cached preferred size and mark this widget as awaiting
+updateLayout().
+
+Invoked by invalidateLayout() on the widget and then on each of its
+parents.)doc";
+
+static const char *__doc_nanogui_Widget_measureCount =
+R"doc(Return the number of preferredSize() evaluations done by
+cachedPreferredSize() so far)doc";
+
 static const char *__doc_nanogui_Widget_mouseButtonEvent =
 R"doc(Handle a mouse button event (default implementation: propagate to
 children))doc";
@@ -3812,6 +5817,10 @@ static const char *__doc_nanogui_Widget_performLayout =
 R"doc(Invoke the associated layout generator to properly place child
 widgets, if any)doc";
 
+static const char *__doc_nanogui_Widget_pixelRatio =
+R"doc(Return the pixel ratio of the parent screen (or the default ratio of
+TextMetrics if there is none))doc";
+
 static const char *__doc_nanogui_Widget_position = R"doc(Return the position relative to the parent widget)doc";
 
 static const char *__doc_nanogui_Widget_preferredSize = R"doc(Compute the preferred size of the widget)doc";
@@ -3822,6 +5831,8 @@ static const char *__doc_nanogui_Widget_removeChild_2 = R"doc(Remove a child wid
 
 static const char *__doc_nanogui_Widget_requestFocus = R"doc(Request the focus to be moved to this widget)doc";
 
+static const char *__doc_nanogui_Widget_resetMeasureCount = R"doc(Reset the counter returned by measureCount() to zero)doc";
+
 static const char *__doc_nanogui_Widget_save = R"doc(Save the state of the widget into the given Serializer instance)doc";
 
 static const char *__doc_nanogui_Widget_screen = R"doc(Walk up the hierarchy and return the parent screen)doc";
@@ -3861,6 +5872,18 @@ static const char *__doc_nanogui_Widget_setId = R"doc(Associate this widget with
 
 static const char *__doc_nanogui_Widget_setLayout = R"doc(Set the used Layout generator)doc";
 
+static const char *__doc_nanogui_Widget_setLayoutThreads =
+R"doc(Set the number of threads used to lay out independent subtrees (the
+windows of a Screen and the tabs of a TabWidget).
+
+The default of 1 lays out everything on the calling thread, and 0 uses
+one thread per hardware core. Text in the faces known to TextMetrics
+is measured concurrently; only measurements which fall back to the
+NanoVG context (other faces and wrapped Label captions) are serialized
+by LayoutLock. A Layout instance must not be shared between subtrees
+that are laid out concurrently. The worker threads are started on
+first use and joined by nanogui::shutdown().)doc";
+
 static const char *__doc_nanogui_Widget_setParent = R"doc(Set the parent widget)doc";
 
 static const char *__doc_nanogui_Widget_setPosition = R"doc(Set the position relative to the parent widget)doc";
@@ -3885,6 +5908,17 @@ static const char *__doc_nanogui_Widget_theme_2 = R"doc(Return the Theme used to
 
 static const char *__doc_nanogui_Widget_tooltip = R"doc()doc";
 
+static const char *__doc_nanogui_Widget_updateLayout =
+R"doc(Lay out the parts of the widget hierarchy below this widget whose
+layout was invalidated.
+
+For every widget that called invalidateLayout(), only the subtree of
+its nearest ancestor whose size (i.e. the preferred size with the
+fixed size applied) did not change is laid out again. Children of the
+root widget (the windows of a Screen) whose size changed are resized
+to their preferred size. Screen invokes this function once per frame
+before drawing.)doc";
+
 static const char *__doc_nanogui_Widget_visible =
 R"doc(Return whether or not the widget is currently visible (assuming all
 parents are visible))doc";
@@ -4198,7 +6232,18 @@ mainloop).)doc";
 
 static const char *__doc_nanogui_loadImageDirectory =
 R"doc(Load a directory of PNG images and upload them to the GPU (suitable
-for use with ImagePanel))doc";
+for use with ImagePanel).
+
+The files are decoded in parallel, and the images are sorted by name.
+See ImageLoader for a variant that returns right away.)doc";
+
+static const char *__doc_nanogui_loadImageResource =
+R"doc(Return the image that is stored under the given name in the registered
+resource packs (see ResourcePack).
+
+The image is decoded and uploaded on the first request and cached per
+NanoVG context. Throws ``std::runtime_error`` if the resource is unknown
+or cannot be decoded.)doc";
 
 static const char *__doc_nanogui_lookAt =
 R"doc(Creates a "look at" matrix that describes the position and orientation
@@ -8,6 +8,7 @@ typedef IntBox<int64_t> Int64Box;
 DECLARE_WIDGET(TextBox);
 DECLARE_WIDGET(DoubleBox);
 DECLARE_WIDGET(Int64Box);
+DECLARE_WIDGET(TextArea);
 
 void register_textbox(py::module &m) {
     py::class_<TextBox, Widget, ref<TextBox>, PyTextBox> tbox(m, "TextBox", D(TextBox));
@@ -61,6 +62,43 @@ void register_textbox(py::module &m) {
         .def("setMinValue", &DoubleBox::setMinValue, D(FloatBox, setMinValue))
         .def("setMaxValue", &DoubleBox::setMaxValue, D(FloatBox, setMaxValue))
         .def("setMinValue", &DoubleBox::setMinMaxValues, D(FloatBox, setMinMaxValues));
+
+    py::class_<TextBuffer>(m, "TextBuffer", D(TextBuffer))
+        .def(py::init<const std::string &>(), py::arg("text") = std::string(), D(TextBuffer, TextBuffer))
+        .def("setText", &TextBuffer::setText, D(TextBuffer, setText))
+        .def("text", (std::string (TextBuffer::*)() const) &TextBuffer::text, D(TextBuffer, text))
+        .def("text", (std::string (TextBuffer::*)(size_t, size_t) const) &TextBuffer::text, D(TextBuffer, text, 2))
+        .def("size", &TextBuffer::size, D(TextBuffer, size))
+        .def("lineCount", &TextBuffer::lineCount, D(TextBuffer, lineCount))
+        .def("lineStart", &TextBuffer::lineStart, D(TextBuffer, lineStart))
+        .def("lineEnd", &TextBuffer::lineEnd, D(TextBuffer, lineEnd))
+        .def("line", &TextBuffer::line, D(TextBuffer, line))
+        .def("lineOf", &TextBuffer::lineOf, D(TextBuffer, lineOf))
+        .def("insert", &TextBuffer::insert, D(TextBuffer, insert))
+        .def("erase", &TextBuffer::erase, D(TextBuffer, erase))
+        .def("pieceCount", &TextBuffer::pieceCount, D(TextBuffer, pieceCount));
+
+    py::class_<TextArea, Widget, ref<TextArea>, PyTextArea>(m, "TextArea", D(TextArea))
+        .def(py::init<Widget *, const std::string &>(), py::arg("parent"),
+            py::arg("value") = std::string(), D(TextArea, TextArea))
+        .def("value", &TextArea::value, D(TextArea, value))
+        .def("setValue", &TextArea::setValue, D(TextArea, setValue))
+        .def("buffer", &TextArea::buffer, py::return_value_policy::reference_internal, D(TextArea, buffer))
+        .def("editable", &TextArea::editable, D(TextArea, editable))
+        .def("setEditable", &TextArea::setEditable, D(TextArea, setEditable))
+        .def("cursorPosition", &TextArea::cursorPosition, D(TextArea, cursorPosition))
+        .def("setCursorPosition", &TextArea::setCursorPosition, D(TextArea, setCursorPosition))
+        .def("selectionStart", &TextArea::selectionStart, D(TextArea, selectionStart))
+        .def("select", &TextArea::select, D(TextArea, select))
+        .def("selectedText", &TextArea::selectedText, D(TextArea, selectedText))
+        .def("insert", &TextArea::insert, D(TextArea, insert))
+        .def("append", &TextArea::append, D(TextArea, append))
+        .def("lineHeight", &TextArea::lineHeight, D(TextArea, lineHeight))
+        .def("callback", &TextArea::callback, D(TextArea, callback))
+        .def("setCallback", &TextArea::setCallback, D(TextArea, setCallback))
+        .def("scrollToCursor", &TextArea::scrollToCursor, D(TextArea, scrollToCursor))
+        .def("scrollToLine", &TextArea::scrollToLine, D(TextArea, scrollToLine))
+        .def("positionAt", &TextArea::positionAt, D(TextArea, positionAt));
 }
 
 #endif
@@ -80,6 +80,15 @@ void register_widget(py::module &m) {
         .def("keyboardCharacterEvent", &Widget::keyboardCharacterEvent,
              D(Widget, keyboardCharacterEvent))
         .def("preferredSize", &Widget::preferredSize, D(Widget, preferredSize))
+        .def("cachedPreferredSize", &Widget::cachedPreferredSize, D(Widget, cachedPreferredSize))
+        .def("invalidateLayout", &Widget::invalidateLayout, D(Widget, invalidateLayout))
+        .def("updateLayout", &Widget::updateLayout, D(Widget, updateLayout))
+        .def("layoutValid", &Widget::layoutValid, D(Widget, layoutValid))
+        .def("layoutPending", &Widget::layoutPending, D(Widget, layoutPending))
+        .def_static("measureCount", &Widget::measureCount, D(Widget, measureCount))
+        .def_static("resetMeasureCount", &Widget::resetMeasureCount, D(Widget, resetMeasureCount))
+        .def_static("setLayoutThreads", &Widget::setLayoutThreads, D(Widget, setLayoutThreads))
+        .def_static("layoutThreads", &Widget::layoutThreads, D(Widget, layoutThreads))
         .def("performLayout", &Widget::performLayout, D(Widget, performLayout))
         .def("draw", &Widget::draw, D(Widget, draw));
 
@@ -13,6 +13,7 @@
 #include <nanogui/theme.h>
 #include <nanogui/opengl.h>
 #include <nanogui/serializer/core.h>
+#include <nanogui/textmetrics.h>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -24,22 +25,22 @@ Button::Button(Widget *parent, const std::string &caption, int icon)
 
 Vector2i Button::preferredSize(NVGcontext *ctx) const {
     int fontSize = mFontSize == -1 ? mTheme->mButtonFontSize : mFontSize;
-    nvgFontSize(ctx, fontSize);
-    nvgFontFace(ctx, "sans-bold");
-    float tw = nvgTextBounds(ctx, 0,0, mCaption.c_str(), nullptr, nullptr);
+    float tw = TextMetrics::textWidth(ctx, "sans-bold", fontSize, mCaption);
     float iw = 0.0f, ih = fontSize;
 
     if (mIcon) {
         if (nvgIsFontIcon(mIcon)) {
             ih *= icon_scale();
-            nvgFontFace(ctx, "icons");
-            nvgFontSize(ctx, ih);
-            iw = nvgTextBounds(ctx, 0, 0, utf8(mIcon).data(), nullptr, nullptr)
+            iw = TextMetrics::textWidth(ctx, "icons", ih, utf8(mIcon).data())
                 + mSize.y() * 0.15f;
         } else {
             int w, h;
             ih *= 0.9f;
-            nvgImageSize(ctx, mIcon, &w, &h);
+            {
+                /* Queries the shared NanoVG context */
+                LayoutLock lock;
+                nvgImageSize(ctx, mIcon, &w, &h);
+            }
             iw = w * ih / h;
         }
     }
@@ -155,7 +156,7 @@ void Button::draw(NVGcontext *ctx) {
     int fontSize = mFontSize == -1 ? mTheme->mButtonFontSize : mFontSize;
     nvgFontSize(ctx, fontSize);
     nvgFontFace(ctx, "sans-bold");
-    float tw = nvgTextBounds(ctx, 0,0, mCaption.c_str(), nullptr, nullptr);
+    float tw = TextMetrics::textWidth(ctx, "sans-bold", fontSize, mCaption);
 
     Vector2f center = mPos.cast<float>() + mSize.cast<float>() * 0.5f;
     Vector2f textPos(center.x() - tw * 0.5f, center.y() - 1);
@@ -172,7 +173,7 @@ void Button::draw(NVGcontext *ctx) {
             ih *= icon_scale();
             nvgFontSize(ctx, ih);
             nvgFontFace(ctx, "icons");
-            iw = nvgTextBounds(ctx, 0, 0, icon.data(), nullptr, nullptr);
+            iw = TextMetrics::textWidth(ctx, "icons", ih, icon.data());
         } else {
             int w, h;
             ih *= 0.9f;
@@ -13,6 +13,7 @@
 #include <nanogui/opengl.h>
 #include <nanogui/theme.h>
 #include <nanogui/serializer/core.h>
+#include <nanogui/textmetrics.h>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -49,10 +50,8 @@ bool CheckBox::mouseButtonEvent(const Vector2i &p, int button, bool down,
 Vector2i CheckBox::preferredSize(NVGcontext *ctx) const {
     if (mFixedSize != Vector2i::Zero())
         return mFixedSize;
-    nvgFontSize(ctx, fontSize());
-    nvgFontFace(ctx, "sans");
     return Vector2i(
-        nvgTextBounds(ctx, 0, 0, mCaption.c_str(), nullptr, nullptr) +
+        TextMetrics::textWidth(ctx, "sans", fontSize(), mCaption) +
             1.8f * fontSize(),
         fontSize() * 1.3f);
 }
@@ -16,7 +16,12 @@
 #endif
 
 #include <nanogui/opengl.h>
+#include <nanogui/resourcepack.h>
+#include <nanogui/imageloader.h>
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <mutex>
 #include <thread>
 #include <chrono>
 #include <iostream>
@@ -24,17 +29,22 @@
 #if !defined(_WIN32)
 #  include <locale.h>
 #  include <signal.h>
-#  include <sys/dir.h>
 #endif
 
 NAMESPACE_BEGIN(nanogui)
 
 extern std::map<GLFWwindow *, Screen *> __nanogui_screens;
+extern void __nanogui_join_layout_workers();
 
 #if defined(__APPLE__)
   extern void disable_saved_application_state_osx();
 #endif
 
+/* Worker threads wake up the main loop with __nanogui_post_empty_event(),
+   which must not call into GLFW once shutdown() has terminated it */
+static std::mutex wakeup_mutex;
+static bool wakeup_enabled = false;
+
 void init() {
     #if !defined(_WIN32)
         /* Avoid locale-related number parsing issues */
@@ -57,6 +67,15 @@ void init() {
         throw std::runtime_error("Could not initialize GLFW!");
 
     glfwSetTime(0);
+
+    std::lock_guard<std::mutex> guard(wakeup_mutex);
+    wakeup_enabled = true;
+}
+
+void __nanogui_post_empty_event() {
+    std::lock_guard<std::mutex> guard(wakeup_mutex);
+    if (wakeup_enabled)
+        glfwPostEmptyEvent();
 }
 
 static bool mainloop_active = false;
@@ -129,6 +148,11 @@ bool active() {
 }
 
 void shutdown() {
+    __nanogui_join_layout_workers();
+    {
+        std::lock_guard<std::mutex> guard(wakeup_mutex);
+        wakeup_enabled = false;
+    }
     glfwTerminate();
 }
 
@@ -165,40 +189,42 @@ int __nanogui_get_image(NVGcontext *ctx, const std::string &name, uint8_t *data,
     return iconID;
 }
 
+int loadImageResource(NVGcontext *ctx, const std::string &name) {
+    static std::mutex mutex;
+    static std::map<std::pair<NVGcontext *, std::string>, int> imageCache;
+    std::lock_guard<std::mutex> guard(mutex);
+    auto key = std::make_pair(ctx, name);
+    auto it = imageCache.find(key);
+    if (it != imageCache.end())
+        return it->second;
+    ResourcePack::Resource r = ResourcePack::resource(name);
+    int image = nvgCreateImageMem(ctx, 0, (unsigned char *) r.data, (int) r.size);
+    if (image == 0)
+        throw std::runtime_error("Unable to load image resource \"" + name + "\".");
+    imageCache[key] = image;
+    return image;
+}
+
 std::vector<std::pair<int, std::string>>
 loadImageDirectory(NVGcontext *ctx, const std::string &path) {
+    /* Decode in parallel, and create the NanoVG images on this thread */
+    ref<ImageLoader> loader = new ImageLoader(ctx, path);
     std::vector<std::pair<int, std::string> > result;
-#if !defined(_WIN32)
-    DIR *dp = opendir(path.c_str());
-    if (!dp)
-        throw std::runtime_error("Could not open image directory!");
-    struct dirent *ep;
-    while ((ep = readdir(dp))) {
-        const char *fname = ep->d_name;
-#else
-    WIN32_FIND_DATA ffd;
-    std::string searchPath = path + "/*.*";
-    HANDLE handle = FindFirstFileA(searchPath.c_str(), &ffd);
-    if (handle == INVALID_HANDLE_VALUE)
-        throw std::runtime_error("Could not open image directory!");
-    do {
-        const char *fname = ffd.cFileName;
-#endif
-        if (strstr(fname, "png") == nullptr)
-            continue;
-        std::string fullName = path + "/" + std::string(fname);
-        int img = nvgCreateImage(ctx, fullName.c_str(), 0);
-        if (img == 0)
+    while (!loader->done()) {
+        loader->wait();
+        auto images = loader->update(std::numeric_limits<int>::max());
+        result.insert(result.end(), images.begin(), images.end());
+        if (loader->failedCount() > 0) {
+            loader->cancel();
+            for (const auto &image : result)
+                nvgDeleteImage(ctx, image.first);
             throw std::runtime_error("Could not open image data!");
-        result.push_back(
-            std::make_pair(img, fullName.substr(0, fullName.length() - 4)));
-#if !defined(_WIN32)
+        }
     }
-    closedir(dp);
-#else
-    } while (FindNextFileA(handle, &ffd) != 0);
-    FindClose(handle);
-#endif
+    std::sort(result.begin(), result.end(),
+              [](const std::pair<int, std::string> &a, const std::pair<int, std::string> &b) {
+                  return a.second < b.second;
+              });
     return result;
 }
 
@@ -0,0 +1,719 @@
+/*
+    src/constraintlayout.cpp -- Layout that places widgets by solving a
+    system of linear constraints with an incremental simplex solver
+
+    The solver follows the Cassowary algorithm by Badros, Borning and
+    Stuckey ("The Cassowary Linear Arithmetic Constraint Solving
+    Algorithm", 2001).
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/constraintlayout.h>
+#include <nanogui/widget.h>
+#include <nanogui/window.h>
+#include <nanogui/theme.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+NAMESPACE_BEGIN(nanogui)
+
+namespace {
+    const double epsilon = 1e-8;
+
+    bool nearZero(double value) { return std::abs(value) < epsilon; }
+
+    double weight(ConstraintLayout::Strength strength) {
+        switch (strength) {
+            case ConstraintLayout::Strength::Weak: return 1.0;
+            case ConstraintLayout::Strength::Medium: return 1e3;
+            case ConstraintLayout::Strength::Strong: return 1e6;
+            default: return 1001001000.0;
+        }
+    }
+
+    /* Round up, but ignore the numerical noise of the solver */
+    int roundUp(double value) { return (int) std::ceil(value - 1e-3); }
+}
+
+/**
+ * Simplex tableau in the form used by Cassowary. Every row expresses a basic
+ * symbol as a linear combination of the parametric symbols; the constant of
+ * a row is the current value of its basic symbol. Non-required constraints
+ * add error symbols to the objective, weighted by their strength.
+ */
+struct ConstraintLayout::Solver {
+    enum class SymbolType { Invalid, External, Slack, Error, Dummy };
+
+    struct Symbol {
+        uint64_t id = 0;
+        SymbolType type = SymbolType::Invalid;
+
+        bool valid() const { return type != SymbolType::Invalid; }
+        bool operator<(const Symbol &other) const { return id < other.id; }
+    };
+
+    struct Row {
+        std::map<Symbol, double> cells;
+        double constant = 0.0;
+
+        double add(double value) { return constant += value; }
+
+        void insert(const Symbol &symbol, double coefficient = 1.0) {
+            auto it = cells.emplace(symbol, 0.0).first;
+            it->second += coefficient;
+            if (nearZero(it->second))
+                cells.erase(it);
+        }
+
+        void insert(const Row &other, double coefficient = 1.0) {
+            constant += other.constant * coefficient;
+            for (const auto &cell : other.cells)
+                insert(cell.first, cell.second * coefficient);
+        }
+
+        void remove(const Symbol &symbol) { cells.erase(symbol); }
+
+        void reverseSign() {
+            constant = -constant;
+            for (auto &cell : cells)
+                cell.second = -cell.second;
+        }
+
+        /* Solve the row (interpreted as 0 = row) for the given symbol */
+        void solveFor(const Symbol &symbol) {
+            auto it = cells.find(symbol);
+            double coefficient = -1.0 / it->second;
+            cells.erase(it);
+            constant *= coefficient;
+            for (auto &cell : cells)
+                cell.second *= coefficient;
+        }
+
+        /* Solve the row (interpreted as lhs = row) for rhs */
+        void solveFor(const Symbol &lhs, const Symbol &rhs) {
+            insert(lhs, -1.0);
+            solveFor(rhs);
+        }
+
+        double coefficientFor(const Symbol &symbol) const {
+            auto it = cells.find(symbol);
+            return it == cells.end() ? 0.0 : it->second;
+        }
+
+        void substitute(const Symbol &symbol, const Row &row) {
+            auto it = cells.find(symbol);
+            if (it == cells.end())
+                return;
+            double coefficient = it->second;
+            cells.erase(it);
+            insert(row, coefficient);
+        }
+    };
+
+    struct Tag {
+        Symbol marker, other;
+    };
+
+    struct ConstraintInfo {
+        Tag tag;
+        double strength;
+        /// Variables that appear in the expression of the constraint
+        std::vector<int> vars;
+    };
+
+    struct EditInfo {
+        int constraint;
+        double constant;
+    };
+
+    std::map<Symbol, Row> rows;
+    std::vector<Symbol> symbols;
+    std::vector<double> values;
+    /// Variables that were released by removeVariable() and can be reused
+    std::vector<int> freeVariables;
+    std::unordered_map<int, ConstraintInfo> constraints;
+    std::unordered_map<int, EditInfo> edits;
+    std::vector<Symbol> infeasibleRows;
+    Row objective;
+    std::unique_ptr<Row> artificial;
+    uint64_t symbolCount = 0;
+    int constraintCount = 0;
+
+    Symbol newSymbol(SymbolType type) {
+        Symbol symbol;
+        symbol.id = ++symbolCount;
+        symbol.type = type;
+        return symbol;
+    }
+
+    int newVariable() {
+        if (!freeVariables.empty()) {
+            int var = freeVariables.back();
+            freeVariables.pop_back();
+            return var;
+        }
+        symbols.push_back(Symbol());
+        values.push_back(0.0);
+        return (int) symbols.size() - 1;
+    }
+
+    Symbol variableSymbol(int var) {
+        if (var < 0 || var >= (int) symbols.size())
+            throw std::runtime_error("ConstraintLayout: unknown variable!");
+        if (!symbols[var].valid())
+            symbols[var] = newSymbol(SymbolType::External);
+        return symbols[var];
+    }
+
+    int addConstraint(const Expression &expr, Relation relation, double strength) {
+        Tag tag;
+        Row row = createRow(expr, relation, strength, tag);
+        Symbol subject = chooseSubject(row, tag);
+
+        if (!subject.valid() && allDummies(row)) {
+            if (!nearZero(row.constant))
+                throw std::runtime_error("ConstraintLayout: unsatisfiable constraint!");
+            subject = tag.marker;
+        }
+
+        if (!subject.valid()) {
+            if (!addWithArtificialVariable(row))
+                throw std::runtime_error("ConstraintLayout: unsatisfiable constraint!");
+        } else {
+            row.solveFor(subject);
+            substitute(subject, row);
+            rows[subject] = std::move(row);
+        }
+
+        std::vector<int> vars;
+        for (const auto &term : expr.terms)
+            if (std::find(vars.begin(), vars.end(), term.first) == vars.end())
+                vars.push_back(term.first);
+
+        int id = ++constraintCount;
+        constraints[id] = ConstraintInfo { tag, strength, std::move(vars) };
+        optimize(objective);
+        return id;
+    }
+
+    void removeConstraint(int id) {
+        auto it = constraints.find(id);
+        if (it == constraints.end())
+            throw std::runtime_error("ConstraintLayout: unknown constraint!");
+        Tag tag = it->second.tag;
+        double strength = it->second.strength;
+        constraints.erase(it);
+
+        /* Remove the error weights from the objective */
+        if (tag.marker.type == SymbolType::Error)
+            removeMarkerEffects(tag.marker, strength);
+        if (tag.other.type == SymbolType::Error)
+            removeMarkerEffects(tag.other, strength);
+
+        /* Make the marker basic (if it is not already) and drop its row */
+        auto rowIt = rows.find(tag.marker);
+        if (rowIt != rows.end()) {
+            rows.erase(rowIt);
+        } else {
+            rowIt = markerLeavingRow(tag.marker);
+            if (rowIt == rows.end())
+                throw std::runtime_error("ConstraintLayout: failed to find leaving row!");
+            Symbol leaving = rowIt->first;
+            Row row = std::move(rowIt->second);
+            rows.erase(rowIt);
+            row.solveFor(leaving, tag.marker);
+            substitute(tag.marker, row);
+        }
+        optimize(objective);
+    }
+
+    bool hasEdit(int var) const { return edits.find(var) != edits.end(); }
+
+    void addEdit(int var, double strength) {
+        strength = std::min(strength, weight(Strength::Strong));
+        int id = addConstraint(Expression::variable(var), Relation::Equal, strength);
+        edits[var] = EditInfo { id, 0.0 };
+    }
+
+    void removeEdit(int var) {
+        auto it = edits.find(var);
+        if (it == edits.end())
+            return;
+        removeConstraint(it->second.constraint);
+        edits.erase(it);
+    }
+
+    /* Remove the edit and all constraints that refer to a variable, and release it for reuse */
+    void removeVariable(int var) {
+        removeEdit(var);
+        std::vector<int> ids;
+        for (const auto &c : constraints) {
+            const std::vector<int> &vars = c.second.vars;
+            if (std::find(vars.begin(), vars.end(), var) != vars.end())
+                ids.push_back(c.first);
+        }
+        /* Remove them in the order in which they were added, so that the result is deterministic */
+        std::sort(ids.begin(), ids.end());
+        for (int id : ids)
+            removeConstraint(id);
+
+        /* Without its constraints, the variable only remains in the tableau as round-off */
+        Symbol symbol = symbols[var];
+        if (symbol.valid()) {
+            rows.erase(symbol);
+            for (auto &row : rows)
+                row.second.remove(symbol);
+            objective.remove(symbol);
+        }
+        symbols[var] = Symbol();
+        values[var] = 0.0;
+        freeVariables.push_back(var);
+    }
+
+    /* Change the value of an edit variable and restore feasibility with the dual simplex method */
+    void suggest(int var, double value) {
+        EditInfo &info = edits.at(var);
+        double delta = value - info.constant;
+        if (delta == 0.0)
+            return;
+        info.constant = value;
+        const Tag &tag = constraints.at(info.constraint).tag;
+
+        auto it = rows.find(tag.marker);
+        if (it != rows.end()) {
+            if (it->second.add(-delta) < 0.0)
+                infeasibleRows.push_back(it->first);
+        } else if ((it = rows.find(tag.other)) != rows.end()) {
+            if (it->second.add(delta) < 0.0)
+                infeasibleRows.push_back(it->first);
+        } else {
+            for (auto &row : rows) {
+                double coefficient = row.second.coefficientFor(tag.marker);
+                if (coefficient != 0.0 && row.second.add(delta * coefficient) < 0.0 &&
+                    row.first.type != SymbolType::External)
+                    infeasibleRows.push_back(row.first);
+            }
+        }
+        dualOptimize();
+    }
+
+    void updateVariables() {
+        for (size_t i = 0; i < symbols.size(); ++i) {
+            auto it = symbols[i].valid() ? rows.find(symbols[i]) : rows.end();
+            values[i] = it == rows.end() ? 0.0 : it->second.constant;
+        }
+    }
+
+    Row createRow(const Expression &expr, Relation relation, double strength, Tag &tag) {
+        Row row;
+        row.constant = expr.constant;
+        for (const auto &term : expr.terms) {
+            if (nearZero(term.second))
+                continue;
+            Symbol symbol = variableSymbol(term.first);
+            auto it = rows.find(symbol);
+            if (it != rows.end())
+                row.insert(it->second, term.second);
+            else
+                row.insert(symbol, term.second);
+        }
+
+        bool required = strength >= weight(Strength::Required);
+        if (relation != Relation::Equal) {
+            double coefficient = relation == Relation::LessEqual ? 1.0 : -1.0;
+            Symbol slack = newSymbol(SymbolType::Slack);
+            tag.marker = slack;
+            row.insert(slack, coefficient);
+            if (!required) {
+                Symbol error = newSymbol(SymbolType::Error);
+                tag.other = error;
+                row.insert(error, -coefficient);
+                objective.insert(error, strength);
+            }
+        } else if (!required) {
+            Symbol errPlus = newSymbol(SymbolType::Error),
+                   errMinus = newSymbol(SymbolType::Error);
+            tag.marker = errPlus;
+            tag.other = errMinus;
+            row.insert(errPlus, -1.0);
+            row.insert(errMinus, 1.0);
+            objective.insert(errPlus, strength);
+            objective.insert(errMinus, strength);
+        } else {
+            Symbol dummy = newSymbol(SymbolType::Dummy);
+            tag.marker = dummy;
+            row.insert(dummy);
+        }
+
+        if (row.constant < 0.0)
+            row.reverseSign();
+        return row;
+    }
+
+    static Symbol chooseSubject(const Row &row, const Tag &tag) {
+        for (const auto &cell : row.cells)
+            if (cell.first.type == SymbolType::External)
+                return cell.first;
+        for (const Symbol &symbol : { tag.marker, tag.other }) {
+            if ((symbol.type == SymbolType::Slack || symbol.type == SymbolType::Error) &&
+                row.coefficientFor(symbol) < 0.0)
+                return symbol;
+        }
+        return Symbol();
+    }
+
+    static bool allDummies(const Row &row) {
+        for (const auto &cell : row.cells)
+            if (cell.first.type != SymbolType::Dummy)
+                return false;
+        return true;
+    }
+
+    static Symbol anyPivotableSymbol(const Row &row) {
+        for (const auto &cell : row.cells)
+            if (cell.first.type == SymbolType::Slack || cell.first.type == SymbolType::Error)
+                return cell.first;
+        return Symbol();
+    }
+
+    bool addWithArtificialVariable(const Row &row) {
+        /* Minimize an artificial variable to find a feasible basis for the row */
+        Symbol art = newSymbol(SymbolType::Slack);
+        rows[art] = row;
+        artificial.reset(new Row(row));
+        optimize(*artificial);
+        bool success = nearZero(artificial->constant);
+        artificial.reset();
+
+        auto it = rows.find(art);
+        if (it != rows.end()) {
+            Row artRow = std::move(it->second);
+            rows.erase(it);
+            if (artRow.cells.empty())
+                return success;
+            Symbol entering = anyPivotableSymbol(artRow);
+            if (!entering.valid())
+                return false;
+            artRow.solveFor(art, entering);
+            substitute(entering, artRow);
+            rows[entering] = std::move(artRow);
+        }
+
+        for (auto &r : rows)
+            r.second.remove(art);
+        objective.remove(art);
+        return success;
+    }
+
+    void substitute(const Symbol &symbol, const Row &row) {
+        for (auto &r : rows) {
+            r.second.substitute(symbol, row);
+            if (r.first.type != SymbolType::External && r.second.constant < 0.0)
+                infeasibleRows.push_back(r.first);
+        }
+        objective.substitute(symbol, row);
+        if (artificial)
+            artificial->substitute(symbol, row);
+    }
+
+    /* Primal simplex: pivot until no symbol of the objective can decrease it */
+    void optimize(const Row &obj) {
+        while (true) {
+            Symbol entering;
+            for (const auto &cell : obj.cells) {
+                if (cell.first.type != SymbolType::Dummy && cell.second < 0.0) {
+                    entering = cell.first;
+                    break;
+                }
+            }
+            if (!entering.valid())
+                return;
+
+            auto leavingIt = rows.end();
+            double ratio = std::numeric_limits<double>::max();
+            for (auto it = rows.begin(); it != rows.end(); ++it) {
+                if (it->first.type == SymbolType::External)
+                    continue;
+                double coefficient = it->second.coefficientFor(entering);
+                if (coefficient < 0.0) {
+                    double r = -it->second.constant / coefficient;
+                    if (r < ratio) {
+                        ratio = r;
+                        leavingIt = it;
+                    }
+                }
+            }
+            if (leavingIt == rows.end())
+                throw std::runtime_error("ConstraintLayout: the objective is unbounded!");
+
+            Symbol leaving = leavingIt->first;
+            Row row = std::move(leavingIt->second);
+            rows.erase(leavingIt);
+            row.solveFor(leaving, entering);
+            substitute(entering, row);
+            rows[entering] = std::move(row);
+        }
+    }
+
+    /* Dual simplex: restore feasibility of the rows that became negative after an edit */
+    void dualOptimize() {
+        while (!infeasibleRows.empty()) {
+            Symbol leaving = infeasibleRows.back();
+            infeasibleRows.pop_back();
+            auto it = rows.find(leaving);
+            if (it == rows.end() || nearZero(it->second.constant) ||
+                it->second.constant >= 0.0)
+                continue;
+
+            Symbol entering;
+            double ratio = std::numeric_limits<double>::max();
+            for (const auto &cell : it->second.cells) {
+                if (cell.second > 0.0 && cell.first.type != SymbolType::Dummy) {
+                    double r = objective.coefficientFor(cell.first) / cell.second;
+                    if (r < ratio) {
+                        ratio = r;
+                        entering = cell.first;
+                    }
+                }
+            }
+            if (!entering.valid())
+                throw std::runtime_error("ConstraintLayout: dual optimization failed!");
+
+            Row row = std::move(it->second);
+            rows.erase(it);
+            row.solveFor(leaving, entering);
+            substitute(entering, row);
+            rows[entering] = std::move(row);
+        }
+    }
+
+    void removeMarkerEffects(const Symbol &marker, double strength) {
+        auto it = rows.find(marker);
+        if (it != rows.end())
+            objective.insert(it->second, -strength);
+        else
+            objective.insert(marker, -strength);
+    }
+
+    /* Choose the row that makes the marker basic when a constraint is removed */
+    std::map<Symbol, Row>::iterator markerLeavingRow(const Symbol &marker) {
+        double r1 = std::numeric_limits<double>::max(), r2 = r1;
+        auto first = rows.end(), second = rows.end(), third = rows.end();
+        for (auto it = rows.begin(); it != rows.end(); ++it) {
+            double c = it->second.coefficientFor(marker);
+            if (c == 0.0)
+                continue;
+            if (it->first.type == SymbolType::External) {
+                third = it;
+            } else if (c < 0.0) {
+                double r = -it->second.constant / c;
+                if (r < r1) {
+                    r1 = r;
+                    first = it;
+                }
+            } else {
+                double r = it->second.constant / c;
+                if (r < r2) {
+                    r2 = r;
+                    second = it;
+                }
+            }
+        }
+        if (first != rows.end())
+            return first;
+        if (second != rows.end())
+            return second;
+        return third;
+    }
+};
+
+ConstraintLayout::ConstraintLayout(int margin)
+    : mSolver(new Solver()), mContainerFixed(false), mMargin(margin),
+      mSizeStrength(Strength::Medium) {
+    for (int i = 0; i < 2; ++i) {
+        mContainer[i] = mSolver->newVariable();
+        Expression size = Expression::variable(mContainer[i]);
+        addConstraint(size >= 0);
+        /* Unless it is fixed, the container shrinks as far as the children permit */
+        addConstraint((size == 0) | Strength::Weak);
+    }
+}
+
+ConstraintLayout::~ConstraintLayout() { }
+
+void ConstraintLayout::setSizeStrength(Strength strength) {
+    mSizeStrength = strength == Strength::Required ? Strength::Strong : strength;
+    invalidate();
+}
+
+ConstraintLayout::Expression ConstraintLayout::newVariable() {
+    return Expression::variable(mSolver->newVariable());
+}
+
+ConstraintLayout::Expression ConstraintLayout::right(const Widget *widget) {
+    return left(widget) + width(widget);
+}
+
+ConstraintLayout::Expression ConstraintLayout::bottom(const Widget *widget) {
+    return top(widget) + height(widget);
+}
+
+ConstraintLayout::Expression ConstraintLayout::centerX(const Widget *widget) {
+    return left(widget) + width(widget) * 0.5;
+}
+
+ConstraintLayout::Expression ConstraintLayout::centerY(const Widget *widget) {
+    return top(widget) + height(widget) * 0.5;
+}
+
+int ConstraintLayout::addConstraint(const Constraint &c) {
+    int id = mSolver->addConstraint(c.expression, c.relation, weight(c.strength));
+    invalidate();
+    return id;
+}
+
+void ConstraintLayout::removeConstraint(int id) {
+    mSolver->removeConstraint(id);
+    invalidate();
+}
+
+void ConstraintLayout::removeWidget(const Widget *widget) {
+    auto it = mWidgets.find(widget);
+    if (it == mWidgets.end())
+        return;
+    for (int i = 0; i < 4; ++i)
+        mSolver->removeVariable(it->second.vars[i]);
+    mWidgets.erase(it);
+    invalidate();
+}
+
+double ConstraintLayout::value(const Expression &expression) const {
+    double result = expression.constant;
+    for (const auto &term : expression.terms)
+        result += term.second * mSolver->values.at(term.first);
+    return result;
+}
+
+int ConstraintLayout::variable(const Widget *widget, int index) {
+    auto it = mWidgets.find(widget);
+    if (it == mWidgets.end()) {
+        WidgetVariables v;
+        for (int i = 0; i < 4; ++i)
+            v.vars[i] = mSolver->newVariable();
+        v.suggested = Vector2i::Constant(-1);
+        for (int i = 0; i < 2; ++i) {
+            v.strength[i] = mSizeStrength;
+            addConstraint(Expression::variable(v.vars[2 + i]) >= 0);
+            mSolver->addEdit(v.vars[2 + i], weight(v.strength[i]));
+        }
+        it = mWidgets.emplace(widget, v).first;
+    }
+    return it->second.vars[index];
+}
+
+int ConstraintLayout::headerHeight(const Widget *widget) const {
+    const Window *window = dynamic_cast<const Window *>(widget);
+    if (window && !window->title().empty())
+        return widget->theme()->mWindowHeaderHeight - mMargin/2;
+    return 0;
+}
+
+void ConstraintLayout::updateSizes(NVGcontext *ctx, const Widget *widget) const {
+    for (auto child : widget->children()) {
+        if (!child->visible())
+            continue;
+        auto it = mWidgets.find(child);
+        if (it == mWidgets.end())
+            continue;
+        WidgetVariables &v = it->second;
+
+        Vector2i ps = child->cachedPreferredSize(ctx), fs = child->fixedSize();
+        for (int i = 0; i < 2; ++i) {
+            /* Switching between fixed and preferred size replaces the edit */
+            Strength strength = fs[i] ? Strength::Strong : mSizeStrength;
+            if (strength != v.strength[i]) {
+                mSolver->removeEdit(v.vars[2 + i]);
+                mSolver->addEdit(v.vars[2 + i], weight(strength));
+                v.strength[i] = strength;
+                v.suggested[i] = -1;
+            }
+
+            /* Only sizes that changed are re-solved */
+            int size = fs[i] ? fs[i] : ps[i];
+            if (size != v.suggested[i]) {
+                mSolver->suggest(v.vars[2 + i], size);
+                v.suggested[i] = size;
+            }
+        }
+    }
+}
+
+Vector2i ConstraintLayout::preferredSize(NVGcontext *ctx, const Widget *widget) const {
+    updateSizes(ctx, widget);
+    if (mContainerFixed) {
+        for (int i = 0; i < 2; ++i)
+            mSolver->removeEdit(mContainer[i]);
+        mContainerFixed = false;
+    }
+    mSolver->updateVariables();
+
+    return Vector2i(
+        roundUp(mSolver->values[mContainer[0]]) + 2*mMargin,
+        roundUp(mSolver->values[mContainer[1]]) + 2*mMargin + headerHeight(widget)
+    );
+}
+
+void ConstraintLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
+    updateSizes(ctx, widget);
+
+    Vector2i fs_w = widget->fixedSize();
+    Vector2i containerSize(
+        fs_w[0] ? fs_w[0] : widget->width(),
+        fs_w[1] ? fs_w[1] : widget->height()
+    );
+    Vector2i start(mMargin, mMargin + headerHeight(widget));
+    containerSize -= start + Vector2i::Constant(mMargin);
+
+    /* The container size is an edit, so resizing only re-optimizes */
+    if (!mContainerFixed) {
+        for (int i = 0; i < 2; ++i)
+            mSolver->addEdit(mContainer[i], weight(Strength::Strong));
+        mContainerFixed = true;
+    }
+    for (int i = 0; i < 2; ++i)
+        mSolver->suggest(mContainer[i], std::max(containerSize[i], 0));
+    mSolver->updateVariables();
+
+    const std::vector<double> &values = mSolver->values;
+    for (auto child : widget->children()) {
+        if (!child->visible())
+            continue;
+        auto it = mWidgets.find(child);
+        if (it == mWidgets.end())
+            continue;
+        const int *vars = it->second.vars;
+
+        /* Round the edges rather than the sizes so adjacent widgets stay flush */
+        Vector2i pos(
+            (int) std::round(values[vars[0]]),
+            (int) std::round(values[vars[1]])
+        );
+        Vector2i end(
+            (int) std::round(values[vars[0]] + values[vars[2]]),
+            (int) std::round(values[vars[1]] + values[vars[3]])
+        );
+        child->setPosition(start + pos);
+        child->setSize((end - pos).cwiseMax(0));
+        child->performLayout(ctx);
+    }
+}
+
+NAMESPACE_END(nanogui)
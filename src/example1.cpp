@@ -265,22 +265,24 @@ public:
         });
         imageView->setGridThreshold(20);
         imageView->setPixelInfoThreshold(20);
-        imageView->setPixelInfoCallback(
-            [this, imageView](const Vector2i& index) -> pair<string, Color> {
+        imageView->setPixelRegionCallback(
+            [this, imageView](const Vector2i& origin, const Vector2i& size, float* values, Color* colors) {
             auto& imageData = mImagesData[mCurrentImage].second;
             auto& textureSize = imageView->imageSize();
-            string stringData;
-            uint16_t channelSum = 0;
-            for (int i = 0; i != 4; ++i) {
-                auto& channelData = imageData[4*index.y()*textureSize.x() + 4*index.x() + i];
-                channelSum += channelData;
-                stringData += (to_string(static_cast<int>(channelData)) + "\n");
+            for (int y = 0; y != size.y(); ++y) {
+                for (int x = 0; x != size.x(); ++x) {
+                    const uint8_t* pixel = &imageData[4*(origin.y() + y)*textureSize.x() + 4*(origin.x() + x)];
+                    uint16_t channelSum = 0;
+                    for (int i = 0; i != 4; ++i) {
+                        *values++ = pixel[i];
+                        channelSum += pixel[i];
+                    }
+                    float intensity = static_cast<float>(255 - (channelSum / 4)) / 255.0f;
+                    float colorScale = intensity > 0.5f ? (intensity + 1) / 2 : intensity / 2;
+                    *colors++ = Color(colorScale, 1.0f);
+                }
             }
-            float intensity = static_cast<float>(255 - (channelSum / 4)) / 255.0f;
-            float colorScale = intensity > 0.5f ? (intensity + 1) / 2 : intensity / 2;
-            Color textColor = Color(colorScale, 1.0f);
-            return { stringData, textColor };
-        });
+        }, 4);
 
         new Label(window, "File dialog", "sans-bold");
         tools = new Widget(window);
@@ -0,0 +1,80 @@
+/*
+    src/example_layout_benchmark.cpp -- measures how long it takes to lay
+    out a window with an AdvancedGridLayout of 1000x20 anchored labels,
+    which is the size of large FormHelper-generated panels
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/nanogui.h>
+#include <chrono>
+#include <iostream>
+
+using namespace nanogui;
+
+static constexpr int rows = 1000;
+static constexpr int cols = 20;
+static constexpr int iterations = 10;
+
+template <typename Func> void benchmark(const std::string &name, Func func) {
+    Widget::resetMeasureCount();
+    TextMetrics::resetCacheStatistics();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        func(i);
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << name << ": " << ms / iterations << " ms, "
+              << Widget::measureCount() / iterations << " measurements, "
+              << TextMetrics::cacheHits() / iterations << "/"
+              << TextMetrics::cacheMisses() / iterations
+              << " text cache hits/misses" << std::endl;
+}
+
+int main(int /* argc */, char ** /* argv */) {
+    nanogui::init();
+
+    /* scoped variables */ {
+        /* The screen stays hidden; it only provides a NanoVG context */
+        Screen *screen = new Screen(Vector2i(1024, 768), "Layout benchmark");
+        Window *window = new Window(screen, "Anchored cells");
+
+        AdvancedGridLayout *layout =
+            new AdvancedGridLayout(std::vector<int>(cols, 0), {}, 10);
+        for (int c = 0; c < cols; ++c)
+            layout->setColStretch(c, 1.f);
+        window->setLayout(layout);
+
+        std::vector<Label *> labels;
+        for (int r = 0; r < rows; ++r) {
+            layout->appendRow(0);
+            for (int c = 0; c < cols; ++c) {
+                Label *label = new Label(window,
+                    std::to_string(r) + ", " + std::to_string(c));
+                layout->setAnchor(label, AdvancedGridLayout::Anchor(c, r));
+                labels.push_back(label);
+            }
+        }
+
+        /* Force a full measurement in every iteration */
+        benchmark("Full layout", [&](int) {
+            window->invalidateLayout();
+            screen->performLayout();
+        });
+
+        /* Typical live update: a single caption changes per frame */
+        benchmark("Caption update", [&](int i) {
+            labels[(size_t) i * 997 % labels.size()]->setCaption(
+                "Value " + std::to_string(i));
+            screen->updateLayout(screen->nvgContext());
+        });
+    }
+
+    nanogui::shutdown();
+    return 0;
+}
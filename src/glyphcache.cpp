@@ -0,0 +1,258 @@
+/*
+    src/glyphcache.cpp -- Persistent record of the glyphs that an
+    application draws, used to fill the font atlas ahead of time
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/glyphcache.h>
+#include <nanogui/textmetrics.h>
+#include <nanogui/opengl.h>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <tuple>
+
+NAMESPACE_BEGIN(nanogui)
+
+namespace {
+    const char *fileHeader = "nanogui glyph cache 1";
+
+    struct EntryKey {
+        std::string face;
+        uint64_t hash;
+        float ratio, size;
+
+        bool operator<(const EntryKey &k) const {
+            return std::tie(face, hash, ratio, size) <
+                   std::tie(k.face, k.hash, k.ratio, k.size);
+        }
+    };
+
+    struct State {
+        std::atomic<bool> recording;
+        std::mutex mutex;
+        std::map<EntryKey, std::set<uint32_t>> entries;
+
+        State() : recording(false) { }
+    };
+
+    State &state() {
+        static State state;
+        return state;
+    }
+
+    /* Decode a UTF-8 string, skipping invalid bytes */
+    void decodeUtf8(const char *p, const char *end, std::vector<uint32_t> &codepoints) {
+        while (p < end) {
+            const unsigned char *s = (const unsigned char *) p;
+            int length;
+            uint32_t codepoint;
+            if (s[0] < 0x80) {
+                length = 1; codepoint = s[0];
+            } else if ((s[0] & 0xE0) == 0xC0) {
+                length = 2; codepoint = s[0] & 0x1F;
+            } else if ((s[0] & 0xF0) == 0xE0) {
+                length = 3; codepoint = s[0] & 0x0F;
+            } else if ((s[0] & 0xF8) == 0xF0) {
+                length = 4; codepoint = s[0] & 0x07;
+            } else {
+                ++p;
+                continue;
+            }
+            bool valid = end - p >= length;
+            for (int i = 1; valid && i < length; ++i) {
+                valid = (s[i] & 0xC0) == 0x80;
+                codepoint = (codepoint << 6) | (s[i] & 0x3F);
+            }
+            if (!valid) {
+                ++p;
+                continue;
+            }
+            p += length;
+            /* Control characters are not drawn */
+            if (codepoint >= 0x20)
+                codepoints.push_back(codepoint);
+        }
+    }
+
+    /* Return whether the face is known to TextMetrics with the same font data */
+    bool matchesFont(const EntryKey &key) {
+        int font = TextMetrics::findFont(key.face);
+        return font >= 0 && TextMetrics::fontHash(font) == key.hash;
+    }
+}
+
+bool GlyphCache::recording() {
+    return state().recording;
+}
+
+void GlyphCache::setRecording(bool recording) {
+    state().recording = recording;
+}
+
+void GlyphCache::addGlyphs(const std::string &face, float size, const std::string &text,
+                           float pixelRatio) {
+    int font = TextMetrics::findFont(face);
+    if (font >= 0)
+        addGlyphs(font, size, text.data(), text.data() + text.size(), pixelRatio);
+}
+
+void GlyphCache::addGlyphs(int font, float size, const char *string, const char *end,
+                           float pixelRatio) {
+    if (!end)
+        end = string + strlen(string);
+    std::vector<uint32_t> codepoints;
+    decodeUtf8(string, end, codepoints);
+    if (codepoints.empty())
+        return;
+
+    EntryKey key { TextMetrics::fontName(font), TextMetrics::fontHash(font),
+                   pixelRatio > 0.f ? pixelRatio : TextMetrics::pixelRatio(), size };
+    State &s = state();
+    std::lock_guard<std::mutex> guard(s.mutex);
+    s.entries[key].insert(codepoints.begin(), codepoints.end());
+}
+
+size_t GlyphCache::glyphCount() {
+    State &s = state();
+    std::lock_guard<std::mutex> guard(s.mutex);
+    size_t count = 0;
+    for (const auto &entry : s.entries)
+        count += entry.second.size();
+    return count;
+}
+
+void GlyphCache::clear() {
+    State &s = state();
+    std::lock_guard<std::mutex> guard(s.mutex);
+    s.entries.clear();
+}
+
+bool GlyphCache::load(const std::string &filename) {
+    std::ifstream is(filename);
+    std::string line;
+    if (!is || !std::getline(is, line) || line != fileHeader)
+        return false;
+
+    /* Each entry is a line "<hash> <ratio> <size> <count> <face>" followed
+       by a line with the hexadecimal code points */
+    std::map<EntryKey, std::set<uint32_t>> entries;
+    while (std::getline(is, line)) {
+        if (line.empty())
+            continue;
+        std::istringstream header(line);
+        EntryKey key;
+        size_t count;
+        if (!(header >> std::hex >> key.hash >> std::dec >> key.ratio >> key.size >> count))
+            return false;
+        header >> std::ws;
+        std::getline(header, key.face);
+
+        std::string glyphs;
+        if (!std::getline(is, glyphs))
+            return false;
+        std::istringstream gs(glyphs);
+        std::set<uint32_t> &codepoints = entries[key];
+        uint32_t codepoint;
+        while (gs >> std::hex >> codepoint)
+            codepoints.insert(codepoint);
+        if (codepoints.size() != count)
+            return false;
+    }
+
+    State &s = state();
+    std::lock_guard<std::mutex> guard(s.mutex);
+    for (const auto &entry : entries) {
+        /* Drop glyphs of faces whose data changed, but keep those of faces
+           that the application may still add */
+        if (TextMetrics::findFont(entry.first.face) >= 0 && !matchesFont(entry.first))
+            continue;
+        s.entries[entry.first].insert(entry.second.begin(), entry.second.end());
+    }
+    return true;
+}
+
+void GlyphCache::save(const std::string &filename) {
+    std::ostringstream os;
+    os << fileHeader << "\n" << std::setprecision(9);
+    {
+        State &s = state();
+        std::lock_guard<std::mutex> guard(s.mutex);
+        for (const auto &entry : s.entries) {
+            const EntryKey &key = entry.first;
+            os << std::hex << key.hash << std::dec << " " << key.ratio << " "
+               << key.size << " " << entry.second.size() << " " << key.face << "\n";
+            const char *separator = "";
+            for (uint32_t codepoint : entry.second) {
+                os << separator << std::hex << codepoint << std::dec;
+                separator = " ";
+            }
+            os << "\n";
+        }
+    }
+
+    /* Write a temporary file first, so that readers never see a partial cache */
+    std::string temp = filename + ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary);
+        file << os.str();
+        file.close();
+        if (!file)
+            throw std::runtime_error("GlyphCache: could not write \"" + temp + "\"!");
+    }
+    if (std::rename(temp.c_str(), filename.c_str()) != 0) {
+        /* Windows does not replace existing files */
+        std::remove(filename.c_str());
+        if (std::rename(temp.c_str(), filename.c_str()) != 0) {
+            std::remove(temp.c_str());
+            throw std::runtime_error("GlyphCache: could not write \"" + filename + "\"!");
+        }
+    }
+}
+
+void GlyphCache::prewarm(NVGcontext *ctx, float pixelRatio) {
+    std::vector<std::tuple<std::string, float, std::string>> batches;
+    {
+        State &s = state();
+        std::lock_guard<std::mutex> guard(s.mutex);
+        for (const auto &entry : s.entries) {
+            const EntryKey &key = entry.first;
+            if (key.ratio != pixelRatio || !matchesFont(key))
+                continue;
+            std::string text;
+            for (uint32_t codepoint : entry.second)
+                text += utf8((int) codepoint).data();
+            batches.emplace_back(key.face, key.size, std::move(text));
+        }
+    }
+    if (batches.empty())
+        return;
+
+    /* Drawing text rasterizes missing glyphs and uploads the atlas right
+       away, so the geometry of the frame can be discarded */
+    nvgBeginFrame(ctx, 1, 1, pixelRatio);
+    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_BASELINE);
+    for (const auto &batch : batches) {
+        const std::string &face = std::get<0>(batch), &text = std::get<2>(batch);
+        if (nvgFindFont(ctx, face.c_str()) < 0)
+            continue;
+        nvgFontFace(ctx, face.c_str());
+        nvgFontSize(ctx, std::get<1>(batch));
+        nvgText(ctx, 0, 0, text.data(), text.data() + text.size());
+    }
+    nvgCancelFrame(ctx);
+}
+
+NAMESPACE_END(nanogui)
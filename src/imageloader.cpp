@@ -0,0 +1,239 @@
+/*
+    src/imageloader.cpp -- Loads the images of a directory on worker
+    threads
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/imageloader.h>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#endif
+
+#include <nanogui/opengl.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+/* Decoding uses the copy of stb_image that is compiled into NanoVG */
+#include <stb_image.h>
+
+#if !defined(_WIN32)
+#  include <sys/dir.h>
+#endif
+
+NAMESPACE_BEGIN(nanogui)
+
+extern void __nanogui_post_empty_event();
+
+namespace {
+    /// Number of decoded images that the workers may keep ahead of update()
+    constexpr size_t maxDecodedImages = 16;
+
+    struct DecodedImage {
+        size_t index;
+        int width, height;
+        std::unique_ptr<unsigned char, void (*)(void *)> pixels;
+    };
+
+    /// Return the paths of the PNG files in a directory, sorted by name
+    std::vector<std::string> listImages(const std::string &path) {
+        std::vector<std::string> files;
+#if !defined(_WIN32)
+        DIR *dp = opendir(path.c_str());
+        if (!dp)
+            throw std::runtime_error("Could not open image directory!");
+        struct dirent *ep;
+        while ((ep = readdir(dp))) {
+            const char *fname = ep->d_name;
+#else
+        WIN32_FIND_DATA ffd;
+        std::string searchPath = path + "/*.*";
+        HANDLE handle = FindFirstFileA(searchPath.c_str(), &ffd);
+        if (handle == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Could not open image directory!");
+        do {
+            const char *fname = ffd.cFileName;
+#endif
+            if (strstr(fname, "png") == nullptr)
+                continue;
+            files.push_back(path + "/" + std::string(fname));
+#if !defined(_WIN32)
+        }
+        closedir(dp);
+#else
+        } while (FindNextFileA(handle, &ffd) != 0);
+        FindClose(handle);
+#endif
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+}
+
+/// State shared between the loader and its worker threads
+struct ImageLoader::State {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    /// Signals new decoded images and room for more of them
+    std::condition_variable changed;
+    std::vector<std::string> files;
+    /// Index of the next file to decode
+    size_t next = 0;
+    size_t decoded = 0, loaded = 0, failed = 0;
+    bool cancelled = false;
+    std::vector<DecodedImage> results;
+
+    void run() {
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [this]() {
+                    return cancelled || next == files.size() || results.size() < maxDecodedImages;
+                });
+                if (cancelled || next == files.size())
+                    return;
+                index = next++;
+            }
+
+            int width = 0, height = 0, channels = 0;
+            unsigned char *pixels = stbi_load(files[index].c_str(), &width, &height, &channels, 4);
+
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                decoded++;
+                if (pixels)
+                    results.push_back(DecodedImage { index, width, height,
+                        std::unique_ptr<unsigned char, void (*)(void *)>(pixels, stbi_image_free) });
+                else
+                    failed++;
+            }
+            changed.notify_all();
+
+            /* Wake up the main loop so that the image is shown right away */
+            __nanogui_post_empty_event();
+        }
+    }
+};
+
+ImageLoader::ImageLoader(NVGcontext *ctx, const std::string &path, int threads)
+    : mContext(ctx), mState(std::make_shared<State>()) {
+    mState->files = listImages(path);
+
+    if (threads <= 0)
+        threads = (int) std::max(std::thread::hardware_concurrency(), 1u);
+    threads = std::min(threads, (int) mState->files.size());
+
+    /* Same settings as nvgCreateImage(), which loadImageDirectory() used before */
+    stbi_set_unpremultiply_on_load(1);
+    stbi_convert_iphone_png_to_rgb(1);
+
+    State *state = mState.get();
+    for (int i = 0; i < threads; ++i)
+        state->threads.emplace_back([state]() { state->run(); });
+}
+
+ImageLoader::~ImageLoader() {
+    /* Each worker finishes at most the file that it is decoding */
+    cancel();
+    for (auto &thread : mState->threads)
+        thread.join();
+}
+
+std::vector<std::pair<int, std::string>> ImageLoader::update(int maxImages) {
+    std::vector<DecodedImage> batch;
+    bool more;
+    {
+        std::lock_guard<std::mutex> guard(mState->mutex);
+        size_t count = std::min(mState->results.size(), (size_t) std::max(maxImages, 1));
+        std::move(mState->results.begin(), mState->results.begin() + count,
+                  std::back_inserter(batch));
+        mState->results.erase(mState->results.begin(), mState->results.begin() + count);
+        more = !mState->results.empty();
+    }
+    if (batch.empty())
+        return {};
+    mState->changed.notify_all();
+
+    std::vector<std::pair<int, std::string>> images;
+    size_t loaded = 0, failed = 0;
+    for (const auto &image : batch) {
+        int handle = nvgCreateImageRGBA(mContext, image.width, image.height, 0, image.pixels.get());
+        if (handle == 0) {
+            failed++;
+            continue;
+        }
+        const std::string &file = mState->files[image.index];
+        images.push_back(std::make_pair(handle, file.substr(0, file.length() - 4)));
+        loaded++;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(mState->mutex);
+        mState->loaded += loaded;
+        mState->failed += failed;
+    }
+
+    /* Images that did not fit into this frame follow in the next one */
+    if (more)
+        glfwPostEmptyEvent();
+    return images;
+}
+
+void ImageLoader::wait() {
+    std::unique_lock<std::mutex> lock(mState->mutex);
+    mState->changed.wait(lock, [this]() {
+        return mState->cancelled || !mState->results.empty() ||
+               mState->decoded == mState->files.size();
+    });
+}
+
+void ImageLoader::cancel() {
+    {
+        std::lock_guard<std::mutex> guard(mState->mutex);
+        mState->cancelled = true;
+        mState->results.clear();
+    }
+    mState->changed.notify_all();
+}
+
+bool ImageLoader::cancelled() const {
+    std::lock_guard<std::mutex> guard(mState->mutex);
+    return mState->cancelled;
+}
+
+size_t ImageLoader::fileCount() const {
+    return mState->files.size();
+}
+
+size_t ImageLoader::loadedCount() const {
+    std::lock_guard<std::mutex> guard(mState->mutex);
+    return mState->loaded;
+}
+
+size_t ImageLoader::failedCount() const {
+    std::lock_guard<std::mutex> guard(mState->mutex);
+    return mState->failed;
+}
+
+float ImageLoader::progress() const {
+    std::lock_guard<std::mutex> guard(mState->mutex);
+    if (mState->files.empty())
+        return 1.f;
+    return (float) (mState->loaded + mState->failed) / (float) mState->files.size();
+}
+
+bool ImageLoader::done() const {
+    std::lock_guard<std::mutex> guard(mState->mutex);
+    return mState->cancelled || mState->loaded + mState->failed == mState->files.size();
+}
+
+NAMESPACE_END(nanogui)
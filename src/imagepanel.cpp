@@ -15,6 +15,8 @@
 
 NAMESPACE_BEGIN(nanogui)
 
+extern void __nanogui_post_empty_event();
+
 ImagePanel::ImagePanel(Widget *parent)
     : Widget(parent), mThumbSize(64), mSpacing(10), mMargin(10),
       mMouseIndex(-1) {}
@@ -62,6 +64,17 @@ Vector2i ImagePanel::preferredSize(NVGcontext *) const {
 }
 
 void ImagePanel::draw(NVGcontext* ctx) {
+    if (mImageLoader) {
+        Images images = mImageLoader->update();
+        if (!images.empty()) {
+            mImages.insert(mImages.end(), images.begin(), images.end());
+            /* This frame has already been laid out, so request another one
+               (the loader does not post an event after its last batch) */
+            invalidateLayout();
+            __nanogui_post_empty_event();
+        }
+    }
+
     Vector2i grid = gridSize();
 
     for (size_t i=0; i<mImages.size(); ++i) {
@@ -15,29 +15,37 @@
 #include <nanogui/window.h>
 #include <nanogui/screen.h>
 #include <nanogui/theme.h>
+#include <nanogui/textmetrics.h>
+#include <algorithm>
 #include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <list>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 NAMESPACE_BEGIN(nanogui)
 
+extern void __nanogui_post_empty_event();
+
 namespace {
-    std::vector<std::string> tokenize(const std::string &string,
-                                      const std::string &delim = "\n",
-                                      bool includeEmpty = false) {
-        std::string::size_type lastPos = 0, pos = string.find_first_of(delim, lastPos);
-        std::vector<std::string> tokens;
-
-        while (lastPos != std::string::npos) {
-            std::string substr = string.substr(lastPos, pos - lastPos);
-            if (!substr.empty() || includeEmpty)
-                tokens.push_back(std::move(substr));
-            lastPos = pos;
-            if (lastPos != std::string::npos) {
-                lastPos += 1;
-                pos = string.find_first_of(delim, lastPos);
+    /// Appends the non-empty lines of \c text to \c out and returns their number.
+    int appendLines(std::string &out, const std::string &text) {
+        int lines = 0;
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t stop = text.find('\n', start);
+            if (stop == std::string::npos)
+                stop = text.size();
+            if (stop > start) {
+                if (lines++ > 0)
+                    out += '\n';
+                out.append(text, start, stop - start);
             }
+            start = stop + 1;
         }
-
-        return tokens;
+        return lines;
     }
 
     constexpr char const *const defaultImageViewVertexShader =
@@ -64,8 +72,94 @@ namespace {
             color = texture(image, uv);
         })";
 
+    constexpr int tileLoaderThreads = 2;
+
+    /// Identifies a tile by its level and position in a single integer.
+    uint64_t tileKey(int level, int x, int y) {
+        return ((uint64_t) level << 56) | ((uint64_t) (uint32_t) y << 28) | (uint64_t) (uint32_t) x;
+    }
+
+    int tileLevel(uint64_t key) { return (int) (key >> 56); }
+    Vector2i tilePosition(uint64_t key) {
+        return Vector2i((int) (key & 0xFFFFFFF), (int) ((key >> 28) & 0xFFFFFFF));
+    }
 }
 
+/// State shared between the view and the threads that read its tiles
+struct ImageView::TileLoader {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stop = false;
+    ref<TiledImage> image;
+    /// Tiles to read, the most important one last
+    std::vector<uint64_t> queue;
+    /// Tiles that are queued, being read, or waiting for their upload
+    std::unordered_set<uint64_t> pending;
+    /// Tiles that were read (without pixels if reading failed)
+    std::vector<std::pair<uint64_t, std::vector<uint8_t>>> results;
+
+    void run() {
+        size_t tileBytes = (size_t) image->tileSize() * image->tileSize() * 4;
+        while (true) {
+            uint64_t key;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeup.wait(lock, [this]() { return stop || !queue.empty(); });
+                if (stop)
+                    return;
+                key = queue.back();
+                queue.pop_back();
+            }
+
+            std::vector<uint8_t> pixels(tileBytes);
+            if (!image->readTile(tileLevel(key), tilePosition(key), pixels.data()))
+                pixels.clear();
+
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                if (stop)
+                    return;
+                results.emplace_back(key, std::move(pixels));
+            }
+
+            /* Wake up the main loop so that the tile is shown right away */
+            __nanogui_post_empty_event();
+        }
+    }
+};
+
+/// Textures of the uploaded tiles, in the order of their last use
+struct ImageView::TileCache {
+    struct Tile {
+        uint64_t key;
+        /// Zero if the tile could not be read
+        GLuint texture;
+    };
+
+    /* Most recently used tiles first */
+    std::list<Tile> tiles;
+    std::unordered_map<uint64_t, std::list<Tile>::iterator> index;
+
+    /// Return the tile with the given key and mark it as used, or \c nullptr if it is missing
+    const Tile *use(uint64_t key) {
+        auto it = index.find(key);
+        if (it == index.end())
+            return nullptr;
+        tiles.splice(tiles.begin(), tiles, it->second);
+        return &*it->second;
+    }
+
+    void evict(size_t capacity) {
+        while (tiles.size() > capacity) {
+            if (tiles.back().texture)
+                glDeleteTextures(1, &tiles.back().texture);
+            index.erase(tiles.back().key);
+            tiles.pop_back();
+        }
+    }
+};
+
 ImageView::ImageView(Widget* parent, GLuint imageID)
     : Widget(parent), mImageID(imageID), mScale(1.0f), mOffset(Vector2f::Zero()),
     mFixedScale(false), mFixedOffset(false), mPixelInfoCallback(nullptr) {
@@ -88,12 +182,21 @@ ImageView::ImageView(Widget* parent, GLuint imageID)
     mShader.uploadAttrib("vertex", vertices);
 }
 
+ImageView::ImageView(Widget* parent, TiledImage* image)
+    : ImageView(parent, (GLuint) 0) {
+    bindTiledImage(image);
+}
+
 ImageView::~ImageView() {
+    releaseTiles();
     mShader.free();
 }
 
 void ImageView::bindImage(GLuint imageId) {
+    releaseTiles();
+    mTiledImage = nullptr;
     mImageID = imageId;
+    mPixelInfoValid = false;
     updateImageParameters();
     fit();
 }
@@ -174,7 +277,7 @@ bool ImageView::gridVisible() const {
 }
 
 bool ImageView::pixelInfoVisible() const {
-    return mPixelInfoCallback && (mPixelInfoThreshold != -1) && (mScale > mPixelInfoThreshold);
+    return (mPixelInfoCallback || mPixelRegionCallback) && (mPixelInfoThreshold != -1) && (mScale > mPixelInfoThreshold);
 }
 
 bool ImageView::helpersVisible() const {
@@ -305,11 +408,15 @@ void ImageView::draw(NVGcontext* ctx) {
               size().x() * r, size().y() * r);
     mShader.bind();
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, mImageID);
     mShader.setUniform("image", 0);
-    mShader.setUniform("scaleFactor", scaleFactor);
-    mShader.setUniform("position", imagePosition);
-    mShader.drawIndexed(GL_TRIANGLES, 0, 2);
+    if (mTiledImage) {
+        drawTiles(screenSize, r);
+    } else {
+        glBindTexture(GL_TEXTURE_2D, mImageID);
+        mShader.setUniform("scaleFactor", scaleFactor);
+        mShader.setUniform("position", imagePosition);
+        mShader.drawIndexed(GL_TRIANGLES, 0, 2);
+    }
     glDisable(GL_SCISSOR_TEST);
 
     if (helpersVisible())
@@ -318,7 +425,46 @@ void ImageView::draw(NVGcontext* ctx) {
     drawWidgetBorder(ctx);
 }
 
+void ImageView::bindTiledImage(TiledImage* image) {
+    releaseTiles();
+    mTiledImage = image;
+    mImageID = 0;
+    mPixelInfoValid = false;
+    if (image) {
+        mTileCache.reset(new TileCache());
+        mTileLoader.reset(new TileLoader());
+        mTileLoader->image = image;
+        TileLoader *loader = mTileLoader.get();
+        for (int i = 0; i < tileLoaderThreads; ++i)
+            loader->threads.emplace_back([loader]() { loader->run(); });
+    }
+    updateImageParameters();
+    fit();
+}
+
+void ImageView::releaseTiles() {
+    if (mTileLoader) {
+        /* The threads exit once their current tile has been read */
+        {
+            std::lock_guard<std::mutex> guard(mTileLoader->mutex);
+            mTileLoader->stop = true;
+        }
+        mTileLoader->wakeup.notify_all();
+        for (auto &thread : mTileLoader->threads)
+            thread.join();
+        mTileLoader.reset();
+    }
+    if (mTileCache) {
+        mTileCache->evict(0);
+        mTileCache.reset();
+    }
+}
+
 void ImageView::updateImageParameters() {
+    if (mTiledImage) {
+        mImageSize = mTiledImage->size();
+        return;
+    }
     // Query the width of the OpenGL texture.
     glBindTexture(GL_TEXTURE_2D, mImageID);
     GLint w, h;
@@ -327,6 +473,136 @@ void ImageView::updateImageParameters() {
     mImageSize = Vector2i(w, h);
 }
 
+void ImageView::drawTiles(const Vector2f& screenSize, float pixelRatio) {
+    TiledImage* image = mTiledImage;
+    TileLoader& loader = *mTileLoader;
+    TileCache& cache = *mTileCache;
+    int tileSize = image->tileSize();
+
+    // Upload a bounded number of the tiles that were read since the last frame.
+    std::vector<std::pair<uint64_t, std::vector<uint8_t>>> loaded;
+    bool morePending;
+    {
+        std::lock_guard<std::mutex> guard(loader.mutex);
+        size_t count = std::min(loader.results.size(), (size_t) std::max(mTileUploadsPerFrame, 1));
+        std::move(loader.results.begin(), loader.results.begin() + count, std::back_inserter(loaded));
+        loader.results.erase(loader.results.begin(), loader.results.begin() + count);
+        for (const auto& result : loaded)
+            loader.pending.erase(result.first);
+        morePending = !loader.results.empty();
+    }
+    for (auto& result : loaded) {
+        GLuint texture = 0;
+        if (!result.second.empty()) {
+            Vector2i valid = image->tilePixels(tileLevel(result.first), tilePosition(result.first));
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, tileSize);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, valid.x(), valid.y(), 0, GL_RGBA,
+                         GL_UNSIGNED_BYTE, result.second.data());
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        }
+        cache.tiles.push_front(TileCache::Tile { result.first, texture });
+        cache.index[result.first] = cache.tiles.begin();
+    }
+
+    // Pick the finest level that does not have more pixels than the screen shows.
+    int coarsest = image->levelCount() - 1;
+    float pixelsPerTexel = mScale * pixelRatio;
+    int level = pixelsPerTexel >= 1.f ? 0 : (int) std::floor(std::log2(1.f / pixelsPerTexel));
+    level = std::min(std::max(level, 0), coarsest);
+
+    // Find the visible tiles of that level.
+    float extent = (float) tileSize * (float) (1 << level);
+    Vector2i count = image->tileCount(level);
+    Vector2f topLeft = clampedImageCoordinateAt(Vector2f::Zero()) / extent;
+    Vector2f bottomRight = clampedImageCoordinateAt(sizeF()) / extent;
+    Vector2i first = topLeft.unaryExpr([](float x) { return std::floor(x); }).cast<int>();
+    Vector2i last = bottomRight.unaryExpr([](float x) { return std::floor(x); }).cast<int>()
+                        .cwiseMin(count - Vector2i::Ones());
+    Vector2f center = (topLeft + bottomRight) / 2;
+
+    std::vector<uint64_t> visible, missing, fallback;
+    for (int y = first.y(); y <= last.y(); ++y) {
+        for (int x = first.x(); x <= last.x(); ++x) {
+            uint64_t key = tileKey(level, x, y);
+            if (cache.use(key)) {
+                visible.push_back(key);
+                continue;
+            }
+            missing.push_back(key);
+            // Show the closest coarser tile that is available instead.
+            for (int l = level + 1; l <= coarsest; ++l) {
+                uint64_t parent = tileKey(l, x >> (l - level), y >> (l - level));
+                if (cache.use(parent)) {
+                    fallback.push_back(parent);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Read the tiles closest to the center first, and the coarsest level before everything else.
+    std::sort(missing.begin(), missing.end(), [&](uint64_t a, uint64_t b) {
+        Vector2f da = tilePosition(a).cast<float>() + Vector2f::Constant(0.5f) - center;
+        Vector2f db = tilePosition(b).cast<float>() + Vector2f::Constant(0.5f) - center;
+        return da.squaredNorm() > db.squaredNorm();
+    });
+    uint64_t root = tileKey(coarsest, 0, 0);
+    if (level != coarsest && !cache.use(root))
+        missing.push_back(root);
+
+    // Replace the queue, which drops the requests of tiles that scrolled out of view.
+    {
+        std::lock_guard<std::mutex> guard(loader.mutex);
+        for (uint64_t key : loader.queue)
+            loader.pending.erase(key);
+        loader.queue.clear();
+        for (uint64_t key : missing) {
+            if (loader.pending.insert(key).second)
+                loader.queue.push_back(key);
+        }
+    }
+    loader.wakeup.notify_all();
+
+    // Draw the coarser stand-ins first, so that the tiles of the current level cover them.
+    std::sort(fallback.begin(), fallback.end(), [](uint64_t a, uint64_t b) {
+        return tileLevel(a) != tileLevel(b) ? tileLevel(a) > tileLevel(b) : a < b;
+    });
+    fallback.erase(std::unique(fallback.begin(), fallback.end()), fallback.end());
+    Vector2f origin = absolutePosition().cast<float>() + mOffset;
+    auto drawTile = [&](uint64_t key) {
+        const TileCache::Tile& tile = *cache.index[key];
+        if (!tile.texture)
+            return;
+        int l = tileLevel(key);
+        Vector2f tileExtent = Vector2f::Constant((float) tileSize * (float) (1 << l));
+        Vector2f start = tilePosition(key).cast<float>().cwiseProduct(tileExtent);
+        Vector2f end = (start + image->tilePixels(l, tilePosition(key)).cast<float>() * (float) (1 << l))
+                           .cwiseMin(imageSizeF());
+        glBindTexture(GL_TEXTURE_2D, tile.texture);
+        mShader.setUniform("scaleFactor", Vector2f((mScale * (end - start)).cwiseQuotient(screenSize)));
+        mShader.setUniform("position", Vector2f((origin + mScale * start).cwiseQuotient(screenSize)));
+        mShader.drawIndexed(GL_TRIANGLES, 0, 2);
+    };
+    for (uint64_t key : fallback)
+        drawTile(key);
+    for (uint64_t key : visible)
+        drawTile(key);
+
+    // Keep at least the tiles that were used in this frame.
+    size_t used = visible.size() + fallback.size() + 1;
+    cache.evict(std::max((size_t) std::max(mTileCacheSize, 0), used));
+
+    // Uploads that did not fit into this frame continue in the next one.
+    if (morePending)
+        glfwPostEmptyEvent();
+}
+
 void ImageView::drawWidgetBorder(NVGcontext* ctx) const {
     nvgBeginPath(ctx);
     nvgStrokeWidth(ctx, 1);
@@ -408,44 +684,92 @@ void ImageView::drawPixelInfo(NVGcontext* ctx, float stride) const {
         (positionF() + positionForCoordinate(topLeft.cast<float>()));
 
     float xInitialPosition = currentCellPosition.x();
-    int xInitialIndex = topLeft.x();
 
-    // Properly scale the pixel information for the given stride.
+    // Properly scale the pixel information for the given stride. The size is
+    // snapped to a few discrete steps, so that zooming does not rasterize
+    // the glyphs at a new size in every frame.
     auto fontSize = stride * mFontScaleFactor;
     static constexpr float maxFontSize = 30.0f;
     fontSize = fontSize > maxFontSize ? maxFontSize : fontSize;
+    fontSize = TextMetrics::quantizeFontSize(fontSize, 8, TextMetrics::pixelRatio(ctx));
     nvgBeginPath(ctx);
     nvgFontSize(ctx, fontSize);
     nvgTextAlign(ctx, NVG_ALIGN_CENTER | NVG_ALIGN_TOP);
     nvgFontFace(ctx, "sans");
-    while (topLeft.y() != bottomRight.y()) {
-        while (topLeft.x() != bottomRight.x()) {
-            writePixelInfo(ctx, currentCellPosition, topLeft, stride, fontSize);
+
+    Vector2i size = bottomRight - topLeft;
+    if (!mPixelInfoValid || topLeft != mPixelInfoOrigin || size != mPixelInfoSize)
+        updatePixelInfo(topLeft, size);
+
+    for (int y = 0; y < size.y(); ++y) {
+        for (int x = 0; x < size.x(); ++x) {
+            writePixelInfo(ctx, currentCellPosition, (size_t) y * size.x() + x, stride, fontSize);
             currentCellPosition.x() += stride;
-            ++topLeft.x();
         }
         currentCellPosition.x() = xInitialPosition;
         currentCellPosition.y() += stride;
-        ++topLeft.y();
-        topLeft.x() = xInitialIndex;
     }
 }
 
+void ImageView::updatePixelInfo(const Vector2i& origin, const Vector2i& size) const {
+    size_t cells = (size_t) std::max(size.x(), 0) * (size_t) std::max(size.y(), 0);
+    // The strings are cleared rather than destroyed, so that their storage is reused.
+    mPixelInfoText.resize(cells);
+    mPixelInfoLines.assign(cells, 0);
+    mPixelInfoColors.assign(cells, mTheme->mTextColor);
+    for (auto& text : mPixelInfoText)
+        text.clear();
+
+    if (cells > 0 && mPixelRegionCallback) {
+        int channels = std::max(mPixelRegionChannels, 0);
+        mPixelValues.assign(cells * channels, 0.f);
+        mPixelRegionCallback(origin, size, mPixelValues.data(), mPixelInfoColors.data());
+        char buffer[32];
+        for (size_t i = 0; i < cells; ++i) {
+            for (int c = 0; c < channels; ++c) {
+                if (c > 0)
+                    mPixelInfoText[i] += '\n';
+                snprintf(buffer, sizeof(buffer), "%.4g", mPixelValues[i * channels + c]);
+                mPixelInfoText[i] += buffer;
+            }
+            mPixelInfoLines[i] = channels;
+        }
+    } else if (mPixelInfoCallback) {
+        for (int y = 0; y < size.y(); ++y) {
+            for (int x = 0; x < size.x(); ++x) {
+                size_t i = (size_t) y * size.x() + x;
+                auto pixelData = mPixelInfoCallback(origin + Vector2i(x, y));
+                mPixelInfoLines[i] = appendLines(mPixelInfoText[i], pixelData.first);
+                mPixelInfoColors[i] = pixelData.second;
+            }
+        }
+    }
+
+    mPixelInfoOrigin = origin;
+    mPixelInfoSize = size;
+    mPixelInfoValid = true;
+}
+
 void ImageView::writePixelInfo(NVGcontext* ctx, const Vector2f& cellPosition,
-                               const Vector2i& pixel, float stride, float fontSize) const {
-    auto pixelData = mPixelInfoCallback(pixel);
-    auto pixelDataRows = tokenize(pixelData.first);
+                               size_t cell, float stride, float fontSize) const {
+    const std::string& text = mPixelInfoText[cell];
+    int lines = mPixelInfoLines[cell];
 
     // If no data is provided for this pixel then simply return.
-    if (pixelDataRows.empty())
+    if (lines == 0)
         return;
 
-    nvgFillColor(ctx, pixelData.second);
-    float yOffset = (stride - fontSize * pixelDataRows.size()) / 2;
-    for (size_t i = 0; i != pixelDataRows.size(); ++i) {
+    nvgFillColor(ctx, mPixelInfoColors[cell]);
+    float yOffset = (stride - fontSize * lines) / 2;
+    size_t start = 0;
+    for (int i = 0; i != lines; ++i) {
+        size_t stop = text.find('\n', start);
+        if (stop == std::string::npos)
+            stop = text.size();
         nvgText(ctx, cellPosition.x() + stride / 2, cellPosition.y() + yOffset,
-                pixelDataRows[i].data(), nullptr);
+                text.data() + start, text.data() + stop);
         yOffset += fontSize;
+        start = stop + 1;
     }
 }
 
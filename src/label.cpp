@@ -12,6 +12,7 @@
 #include <nanogui/label.h>
 #include <nanogui/theme.h>
 #include <nanogui/opengl.h>
+#include <nanogui/textmetrics.h>
 #include <nanogui/serializer/core.h>
 
 NAMESPACE_BEGIN(nanogui)
@@ -36,30 +37,65 @@ void Label::setTheme(Theme *theme) {
 Vector2i Label::preferredSize(NVGcontext *ctx) const {
     if (mCaption == "")
         return Vector2i::Zero();
-    nvgFontFace(ctx, mFont.c_str());
-    nvgFontSize(ctx, fontSize());
     if (mFixedSize.x() > 0) {
-        float bounds[4];
-        nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
-        nvgTextBoxBounds(ctx, mPos.x(), mPos.y(), mFixedSize.x(), mCaption.c_str(), nullptr, bounds);
-        return Vector2i(mFixedSize.x(), bounds[3] - bounds[1]);
+        const LineBreaks &lines = lineBreaks(ctx);
+        return Vector2i(mFixedSize.x(), lines.rows.size() * lines.lineHeight);
     } else {
-        nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
         return Vector2i(
-            nvgTextBounds(ctx, 0, 0, mCaption.c_str(), nullptr, nullptr) + 2,
+            TextMetrics::textWidth(ctx, mFont, fontSize(), mCaption) + 2,
             fontSize()
         );
     }
 }
 
+const Label::LineBreaks &Label::lineBreaks(NVGcontext *ctx) const {
+    LineBreaks &lines = mLineBreaks;
+    float pixelRatio = TextMetrics::pixelRatio(ctx);
+    if (lines.caption == mCaption && lines.font == mFont &&
+        lines.fontSize == fontSize() && lines.width == mFixedSize.x() &&
+        lines.pixelRatio == pixelRatio)
+        return lines;
+
+    lines.caption = mCaption;
+    lines.font = mFont;
+    lines.fontSize = fontSize();
+    lines.width = mFixedSize.x();
+    lines.pixelRatio = pixelRatio;
+    lines.rows.clear();
+
+    /* Measures text with the shared NanoVG context */
+    LayoutLock lock;
+    nvgFontFace(ctx, mFont.c_str());
+    nvgFontSize(ctx, fontSize());
+    nvgTextMetrics(ctx, nullptr, nullptr, &lines.lineHeight);
+
+    /* Same breaking as nvgTextBox(), but only once per caption and width */
+    const char *text = lines.caption.c_str(), *end = text + lines.caption.size();
+    const char *start = text;
+    NVGtextRow rows[16];
+    int count;
+    while ((count = nvgTextBreakLines(ctx, start, end, lines.width, rows, 16)) > 0) {
+        for (int i = 0; i < count; ++i)
+            lines.rows.emplace_back(rows[i].start - text, rows[i].end - text);
+        start = rows[count - 1].next;
+    }
+    return lines;
+}
+
 void Label::draw(NVGcontext *ctx) {
     Widget::draw(ctx);
     nvgFontFace(ctx, mFont.c_str());
     nvgFontSize(ctx, fontSize());
     nvgFillColor(ctx, mColor);
     if (mFixedSize.x() > 0) {
+        const LineBreaks &lines = lineBreaks(ctx);
+        const char *text = lines.caption.c_str();
+        float y = mPos.y();
         nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
-        nvgTextBox(ctx, mPos.x(), mPos.y(), mFixedSize.x(), mCaption.c_str(), nullptr);
+        for (const auto &row : lines.rows) {
+            nvgText(ctx, mPos.x(), y, text + row.first, text + row.second);
+            y += lines.lineHeight;
+        }
     } else {
         nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
         nvgText(ctx, mPos.x(), mPos.y() + mSize.y() * 0.5f, mCaption.c_str(), nullptr);
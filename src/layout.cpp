@@ -16,10 +16,16 @@
 #include <nanogui/window.h>
 #include <nanogui/theme.h>
 #include <nanogui/label.h>
+#include <algorithm>
 #include <numeric>
 
 NAMESPACE_BEGIN(nanogui)
 
+void Layout::invalidate() {
+    for (auto owner : mOwners)
+        owner->invalidateLayout();
+}
+
 BoxLayout::BoxLayout(Orientation orientation, Alignment alignment,
           int margin, int spacing)
     : mOrientation(orientation), mAlignment(alignment), mMargin(margin),
@@ -48,7 +54,7 @@ Vector2i BoxLayout::preferredSize(NVGcontext *ctx, const Widget *widget) const {
         else
             size[axis1] += mSpacing;
 
-        Vector2i ps = w->preferredSize(ctx), fs = w->fixedSize();
+        Vector2i ps = w->cachedPreferredSize(ctx), fs = w->fixedSize();
         Vector2i targetSize(
             fs[0] ? fs[0] : ps[0],
             fs[1] ? fs[1] : ps[1]
@@ -91,7 +97,7 @@ void BoxLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
         else
             position += mSpacing;
 
-        Vector2i ps = w->preferredSize(ctx), fs = w->fixedSize();
+        Vector2i ps = w->cachedPreferredSize(ctx), fs = w->fixedSize();
         Vector2i targetSize(
             fs[0] ? fs[0] : ps[0],
             fs[1] ? fs[1] : ps[1]
@@ -139,7 +145,7 @@ Vector2i GroupLayout::preferredSize(NVGcontext *ctx, const Widget *widget) const
             height += (label == nullptr) ? mSpacing : mGroupSpacing;
         first = false;
 
-        Vector2i ps = c->preferredSize(ctx), fs = c->fixedSize();
+        Vector2i ps = c->cachedPreferredSize(ctx), fs = c->fixedSize();
         Vector2i targetSize(
             fs[0] ? fs[0] : ps[0],
             fs[1] ? fs[1] : ps[1]
@@ -175,7 +181,7 @@ void GroupLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
 
         bool indentCur = indent && label == nullptr;
         Vector2i ps = Vector2i(availableWidth - (indentCur ? mGroupIndent : 0),
-                               c->preferredSize(ctx).y());
+                               c->cachedPreferredSize(ctx).y());
         Vector2i fs = c->fixedSize();
 
         Vector2i targetSize(
@@ -197,8 +203,8 @@ void GroupLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
 Vector2i GridLayout::preferredSize(NVGcontext *ctx,
                                    const Widget *widget) const {
     /* Compute minimum row / column sizes */
-    std::vector<int> grid[2];
-    computeLayout(ctx, widget, grid);
+    computeLayout(ctx, widget);
+    const std::vector<int> *grid = mGrid;
 
     Vector2i size(
         2*mMargin + std::accumulate(grid[0].begin(), grid[0].end(), 0)
@@ -214,42 +220,47 @@ Vector2i GridLayout::preferredSize(NVGcontext *ctx,
     return size;
 }
 
-void GridLayout::computeLayout(NVGcontext *ctx, const Widget *widget, std::vector<int> *grid) const {
+void GridLayout::computeLayout(NVGcontext *ctx, const Widget *widget) const {
+    /* The measurement is still up to date if nothing below \c widget
+       changed since it was taken (see Widget::invalidateLayout()) */
+    if (mMeasuredWidget == widget && widget->layoutValid())
+        return;
+    mMeasuredWidget = widget;
+
     int axis1 = (int) mOrientation, axis2 = (axis1 + 1) % 2;
-    size_t numChildren = widget->children().size(), visibleChildren = 0;
-    for (auto w : widget->children())
-        visibleChildren += w->visible() ? 1 : 0;
+
+    mCells.clear();
+    for (auto w : widget->children()) {
+        if (!w->visible())
+            continue;
+        Vector2i ps = w->cachedPreferredSize(ctx);
+        Vector2i fs = w->fixedSize();
+        mCells.emplace_back(w, Vector2i(
+            fs[0] ? fs[0] : ps[0],
+            fs[1] ? fs[1] : ps[1]
+        ));
+    }
 
     Vector2i dim;
     dim[axis1] = mResolution;
-    dim[axis2] = (int) ((visibleChildren + mResolution - 1) / mResolution);
+    dim[axis2] = (int) ((mCells.size() + mResolution - 1) / mResolution);
 
-    grid[axis1].clear(); grid[axis1].resize(dim[axis1], 0);
-    grid[axis2].clear(); grid[axis2].resize(dim[axis2], 0);
+    mGrid[axis1].assign(dim[axis1], 0);
+    mGrid[axis2].assign(dim[axis2], 0);
 
-    size_t child = 0;
-    for (int i2 = 0; i2 < dim[axis2]; i2++) {
-        for (int i1 = 0; i1 < dim[axis1]; i1++) {
-            Widget *w = nullptr;
-            do {
-                if (child >= numChildren)
-                    return;
-                w = widget->children()[child++];
-            } while (!w->visible());
-
-            Vector2i ps = w->preferredSize(ctx);
-            Vector2i fs = w->fixedSize();
-            Vector2i targetSize(
-                fs[0] ? fs[0] : ps[0],
-                fs[1] ? fs[1] : ps[1]
-            );
-
-            grid[axis1][i1] = std::max(grid[axis1][i1], targetSize[axis1]);
-            grid[axis2][i2] = std::max(grid[axis2][i2], targetSize[axis2]);
-        }
+    for (size_t i = 0; i < mCells.size(); ++i) {
+        int i1 = (int) (i % mResolution), i2 = (int) (i / mResolution);
+        const Vector2i &targetSize = mCells[i].second;
+        mGrid[axis1][i1] = std::max(mGrid[axis1][i1], targetSize[axis1]);
+        mGrid[axis2][i2] = std::max(mGrid[axis2][i2], targetSize[axis2]);
     }
 }
 
+void GridLayout::invalidate() {
+    mMeasuredWidget = nullptr;
+    Layout::invalidate();
+}
+
 void GridLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
     Vector2i fs_w = widget->fixedSize();
     Vector2i containerSize(
@@ -257,9 +268,10 @@ void GridLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
         fs_w[1] ? fs_w[1] : widget->height()
     );
 
-    /* Compute minimum row / column sizes */
-    std::vector<int> grid[2];
-    computeLayout(ctx, widget, grid);
+    /* Compute minimum row / column sizes (usually already done while
+       measuring \c widget) */
+    computeLayout(ctx, widget);
+    std::vector<int> grid[2] = { mGrid[0], mGrid[1] };
     int dim[2] = { (int) grid[0].size(), (int) grid[1].size() };
 
     Vector2i extra = Vector2i::Zero();
@@ -291,26 +303,20 @@ void GridLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
     int axis1 = (int) mOrientation, axis2 = (axis1 + 1) % 2;
     Vector2i start = Vector2i::Constant(mMargin) + extra;
 
-    size_t numChildren = widget->children().size();
-    size_t child = 0;
+    /* Copy the cells, since laying out the children may re-measure
+       \c widget when this layout is shared with one of them */
+    std::vector<std::pair<Widget *, Vector2i>> cells = mCells;
 
     Vector2i pos = start;
+    size_t cell = 0;
     for (int i2 = 0; i2 < dim[axis2]; i2++) {
         pos[axis1] = start[axis1];
         for (int i1 = 0; i1 < dim[axis1]; i1++) {
-            Widget *w = nullptr;
-            do {
-                if (child >= numChildren)
-                    return;
-                w = widget->children()[child++];
-            } while (!w->visible());
-
-            Vector2i ps = w->preferredSize(ctx);
+            if (cell >= cells.size())
+                return;
+            Widget *w = cells[cell].first;
+            Vector2i targetSize = cells[cell++].second;
             Vector2i fs = w->fixedSize();
-            Vector2i targetSize(
-                fs[0] ? fs[0] : ps[0],
-                fs[1] ? fs[1] : ps[1]
-            );
 
             Vector2i itemPos(pos);
             for (int j = 0; j < 2; j++) {
@@ -342,7 +348,8 @@ void GridLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
 }
 
 AdvancedGridLayout::AdvancedGridLayout(const std::vector<int> &cols, const std::vector<int> &rows, int margin)
- : mCols(cols), mRows(rows), mMargin(margin) {
+ : mCols(cols), mRows(rows), mAnchorsSorted(true), mMeasuredWidget(nullptr),
+   mMargin(margin) {
     mColStretch.resize(mCols.size(), 0);
     mRowStretch.resize(mRows.size(), 0);
 }
@@ -375,19 +382,38 @@ void AdvancedGridLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
     else
         grid[1].insert(grid[1].begin(), mMargin);
 
-    for (int axis=0; axis<2; ++axis) {
+    for (int axis=0; axis<2; ++axis)
         for (size_t i=1; i<grid[axis].size(); ++i)
             grid[axis][i] += grid[axis][i-1];
 
-        for (Widget *w : widget->children()) {
-            if (!w->visible())
-                continue;
-            Anchor anchor = this->anchor(w);
+    /* Every visible child must have an anchor */
+    size_t visibleChildren = 0, placed = 0;
+    for (auto w : widget->children())
+        visibleChildren += w->visible() ? 1 : 0;
+    for (const Vector2i &size : mAnchorSizes)
+        placed += size.x() >= 0 ? 1 : 0;
+    if (placed != visibleChildren) {
+        for (auto w : widget->children())
+            if (w->visible())
+                anchor(w); /* throws for the unregistered widget */
+    }
+
+    /* Copy the sizes, since laying out the children may re-measure
+       \c widget when this layout is shared with one of them */
+    std::vector<Vector2i> sizes = mAnchorSizes;
 
+    for (size_t index = 0; index < mAnchors.size(); ++index) {
+        if (sizes[index].x() < 0)
+            continue;
+        Widget *w = const_cast<Widget *>(mAnchors[index].first);
+        const Anchor &anchor = mAnchors[index].second;
+        Vector2i pos, size;
+
+        for (int axis=0; axis<2; ++axis) {
             int itemPos = grid[axis][anchor.pos[axis]];
             int cellSize  = grid[axis][anchor.pos[axis] + anchor.size[axis]] - itemPos;
-            int ps = w->preferredSize(ctx)[axis], fs = w->fixedSize()[axis];
-            int targetSize = fs ? fs : ps;
+            int fs = w->fixedSize()[axis];
+            int targetSize = sizes[index][axis];
 
             switch (anchor.align[axis]) {
                 case Alignment::Minimum:
@@ -403,12 +429,100 @@ void AdvancedGridLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
                     break;
             }
 
-            Vector2i pos = w->position(), size = w->size();
             pos[axis] = itemPos;
             size[axis] = targetSize;
-            w->setPosition(pos);
-            w->setSize(size);
-            w->performLayout(ctx);
+        }
+
+        w->setPosition(pos);
+        w->setSize(size);
+        w->performLayout(ctx);
+    }
+}
+
+void AdvancedGridLayout::invalidate() {
+    mMeasuredWidget = nullptr;
+    Layout::invalidate();
+}
+
+void AdvancedGridLayout::sortAnchors() const {
+    mAnchors.assign(mAnchor.begin(), mAnchor.end());
+
+    for (int axis = 0; axis < 2; ++axis) {
+        std::vector<uint32_t> &order = mAnchorOrder[axis];
+        order.resize(mAnchors.size());
+        for (size_t i = 0; i < order.size(); ++i)
+            order[i] = (uint32_t) i;
+        std::stable_sort(order.begin(), order.end(),
+            [&](uint32_t a, uint32_t b) {
+                return mAnchors[a].second.size[axis] < mAnchors[b].second.size[axis];
+            });
+    }
+
+    mAnchorsSorted = true;
+}
+
+void AdvancedGridLayout::measure(NVGcontext *ctx, const Widget *widget) const {
+    if (!mAnchorsSorted)
+        sortAnchors();
+    /* The measurement is still up to date if nothing below \c widget
+       changed since it was taken (see Widget::invalidateLayout()) */
+    if (mMeasuredWidget == widget && widget->layoutValid())
+        return;
+    mMeasuredWidget = widget;
+
+    mAnchorSizes.resize(mAnchors.size());
+    for (size_t index = 0; index < mAnchors.size(); ++index) {
+        const Widget *w = mAnchors[index].first;
+        if (w->parent() != widget || !w->visible()) {
+            mAnchorSizes[index] = Vector2i::Constant(-1);
+            continue;
+        }
+        Vector2i ps = w->cachedPreferredSize(ctx), fs = w->fixedSize();
+        mAnchorSizes[index] = Vector2i(
+            fs[0] ? fs[0] : ps[0],
+            fs[1] ? fs[1] : ps[1]
+        );
+    }
+
+    for (int axis=0; axis<2; ++axis) {
+        std::vector<int> &grid = mGrid[axis];
+        const std::vector<int> &sizes = axis == 0 ? mCols : mRows;
+        const std::vector<float> &stretch = axis == 0 ? mColStretch : mRowStretch;
+        grid = sizes;
+
+        /* Anchors spanning a single cell come first, so that the cells are
+           sized before the wider anchors distribute their remaining extent */
+        for (uint32_t index : mAnchorOrder[axis]) {
+            int targetSize = mAnchorSizes[index][axis];
+            if (targetSize < 0)
+                continue;
+            const Anchor &anchor = mAnchors[index].second;
+
+            if (anchor.pos[axis] + anchor.size[axis] > (int) grid.size())
+                throw std::runtime_error(
+                    "Advanced grid layout: widget is out of bounds: " +
+                    (std::string) anchor);
+
+            int currentSize = 0;
+            float totalStretch = 0;
+            for (int i = anchor.pos[axis];
+                 i < anchor.pos[axis] + anchor.size[axis]; ++i) {
+                if (sizes[i] == 0 && anchor.size[axis] == 1)
+                    grid[i] = std::max(grid[i], targetSize);
+                currentSize += grid[i];
+                totalStretch += stretch[i];
+            }
+            if (targetSize <= currentSize)
+                continue;
+            if (totalStretch == 0)
+                throw std::runtime_error(
+                    "Advanced grid layout: no space to place widget: " +
+                    (std::string) anchor);
+            float amt = (targetSize - currentSize) / totalStretch;
+            for (int i = anchor.pos[axis];
+                 i < anchor.pos[axis] + anchor.size[axis]; ++i) {
+                grid[i] += (int) std::round(amt * stretch[i]);
+            }
         }
     }
 }
@@ -428,50 +542,12 @@ void AdvancedGridLayout::computeLayout(NVGcontext *ctx, const Widget *widget,
 
     containerSize -= extra;
 
+    measure(ctx, widget);
+
     for (int axis=0; axis<2; ++axis) {
         std::vector<int> &grid = _grid[axis];
-        const std::vector<int> &sizes = axis == 0 ? mCols : mRows;
         const std::vector<float> &stretch = axis == 0 ? mColStretch : mRowStretch;
-        grid = sizes;
-
-        for (int phase = 0; phase < 2; ++phase) {
-            for (auto pair : mAnchor) {
-                const Widget *w = pair.first;
-                if (!w->visible())
-                    continue;
-                const Anchor &anchor = pair.second;
-                if ((anchor.size[axis] == 1) != (phase == 0))
-                    continue;
-                int ps = w->preferredSize(ctx)[axis], fs = w->fixedSize()[axis];
-                int targetSize = fs ? fs : ps;
-
-                if (anchor.pos[axis] + anchor.size[axis] > (int) grid.size())
-                    throw std::runtime_error(
-                        "Advanced grid layout: widget is out of bounds: " +
-                        (std::string) anchor);
-
-                int currentSize = 0;
-                float totalStretch = 0;
-                for (int i = anchor.pos[axis];
-                     i < anchor.pos[axis] + anchor.size[axis]; ++i) {
-                    if (sizes[i] == 0 && anchor.size[axis] == 1)
-                        grid[i] = std::max(grid[i], targetSize);
-                    currentSize += grid[i];
-                    totalStretch += stretch[i];
-                }
-                if (targetSize <= currentSize)
-                    continue;
-                if (totalStretch == 0)
-                    throw std::runtime_error(
-                        "Advanced grid layout: no space to place widget: " +
-                        (std::string) anchor);
-                float amt = (targetSize - currentSize) / totalStretch;
-                for (int i = anchor.pos[axis];
-                     i < anchor.pos[axis] + anchor.size[axis]; ++i) {
-                    grid[i] += (int) std::round(amt * stretch[i]);
-                }
-            }
-        }
+        grid = mGrid[axis];
 
         int currentSize = std::accumulate(grid.begin(), grid.end(), 0);
         float totalStretch = std::accumulate(stretch.begin(), stretch.end(), 0.0f);
@@ -483,4 +559,211 @@ void AdvancedGridLayout::computeLayout(NVGcontext *ctx, const Widget *widget,
     }
 }
 
+FlexLayout::FlexLayout(Orientation orientation, bool wrap, int margin,
+                       int spacing)
+    : mOrientation(orientation), mWrap(wrap), mMargin(margin),
+      mSpacing(Vector2i::Constant(spacing)),
+      mJustification(Alignment::Minimum), mAlignment(Alignment::Middle) {
+}
+
+void FlexLayout::invalidate() {
+    mMainSizes.clear();
+    Layout::invalidate();
+}
+
+int FlexLayout::headerHeight(const Widget *widget) const {
+    const Window *window = dynamic_cast<const Window *>(widget);
+    if (window && !window->title().empty())
+        return widget->theme()->mWindowHeaderHeight - mMargin/2;
+    return 0;
+}
+
+void FlexLayout::computeLines(NVGcontext *ctx, const Widget *widget,
+                              int mainSize, std::vector<Entry> &entries,
+                              std::vector<size_t> &lines) const {
+    int axis1 = (int) mOrientation;
+
+    entries.clear();
+    lines.clear();
+    int lineSize = 0;
+    for (auto w : widget->children()) {
+        if (!w->visible())
+            continue;
+        Entry entry;
+        entry.widget = w;
+        entry.item = item(w);
+        Vector2i ps = w->cachedPreferredSize(ctx), fs = w->fixedSize();
+        entry.size = Vector2i(
+            fs[0] ? fs[0] : ps[0],
+            fs[1] ? fs[1] : ps[1]
+        );
+        entry.basis = (fs[axis1] || entry.item.basis < 0)
+            ? entry.size[axis1] : entry.item.basis;
+
+        /* Start a new line when the widget does not fit anymore */
+        if (lines.empty() || (mWrap && mainSize > 0 &&
+                lineSize + mSpacing[axis1] + entry.basis > mainSize)) {
+            lines.push_back(entries.size());
+            lineSize = entry.basis;
+        } else {
+            lineSize += mSpacing[axis1] + entry.basis;
+        }
+        entries.push_back(entry);
+    }
+    lines.push_back(entries.size());
+}
+
+Vector2i FlexLayout::preferredSize(NVGcontext *ctx, const Widget *widget) const {
+    int axis1 = (int) mOrientation, axis2 = (axis1 + 1) % 2;
+    Vector2i extra(2*mMargin, 2*mMargin + headerHeight(widget));
+
+    /* When wrapping, the preferred size depends on the available space */
+    int mainSize = 0;
+    if (mWrap) {
+        int fs = widget->fixedSize()[axis1];
+        mainSize = (fs ? fs : widget->size()[axis1]) - extra[axis1];
+        mMainSizes[widget] = mainSize;
+    }
+
+    std::vector<Entry> entries;
+    std::vector<size_t> lines;
+    computeLines(ctx, widget, mainSize, entries, lines);
+
+    Vector2i size = Vector2i::Zero();
+    for (size_t l = 0; l + 1 < lines.size(); ++l) {
+        int main = 0, cross = 0;
+        for (size_t i = lines[l]; i < lines[l + 1]; ++i) {
+            main += entries[i].basis + (i > lines[l] ? mSpacing[axis1] : 0);
+            cross = std::max(cross, entries[i].size[axis2]);
+        }
+        size[axis1] = std::max(size[axis1], main);
+        size[axis2] += cross + (l > 0 ? mSpacing[axis2] : 0);
+    }
+
+    return size + extra;
+}
+
+void FlexLayout::performLayout(NVGcontext *ctx, Widget *widget) const {
+    int axis1 = (int) mOrientation, axis2 = (axis1 + 1) % 2;
+
+    Vector2i fs_w = widget->fixedSize();
+    Vector2i containerSize(
+        fs_w[0] ? fs_w[0] : widget->width(),
+        fs_w[1] ? fs_w[1] : widget->height()
+    );
+    Vector2i start(mMargin, mMargin + headerHeight(widget));
+    containerSize -= start + Vector2i::Constant(mMargin);
+
+    if (mWrap) {
+        /* The cached preferred size of the widget was computed for a
+           different width. Measure it again in the next layout pass, so
+           that the parent can adjust the cross size. */
+        auto it = mMainSizes.find(widget);
+        if (it != mMainSizes.end() && it->second != containerSize[axis1]) {
+            it->second = containerSize[axis1];
+            widget->invalidateLayout();
+        }
+        if (mMainSizes.size() > mOwners.size()) {
+            for (auto it2 = mMainSizes.begin(); it2 != mMainSizes.end(); ) {
+                if (std::find(mOwners.begin(), mOwners.end(), it2->first) == mOwners.end())
+                    it2 = mMainSizes.erase(it2);
+                else
+                    ++it2;
+            }
+        }
+    }
+
+    std::vector<Entry> entries;
+    std::vector<size_t> lines;
+    computeLines(ctx, widget, containerSize[axis1], entries, lines);
+    size_t lineCount = lines.size() - 1;
+
+    std::vector<float> sizes;
+    int crossPos = start[axis2];
+    for (size_t l = 0; l < lineCount; ++l) {
+        size_t first = lines[l], last = lines[l + 1];
+
+        /* A single line occupies the entire container */
+        int lineCross = 0;
+        if (lineCount == 1) {
+            lineCross = containerSize[axis2];
+        } else {
+            for (size_t i = first; i < last; ++i)
+                lineCross = std::max(lineCross, entries[i].size[axis2]);
+        }
+
+        float totalGrow = 0.f, totalShrink = 0.f;
+        int free = containerSize[axis1] - (int) (last - first - 1) * mSpacing[axis1];
+        for (size_t i = first; i < last; ++i) {
+            const Entry &e = entries[i];
+            free -= e.basis;
+            if (e.widget->fixedSize()[axis1])
+                continue;
+            totalGrow += e.item.grow;
+            totalShrink += e.item.shrink * e.basis;
+        }
+
+        /* Distribute the free space (or the overflow) */
+        sizes.resize(last - first);
+        float offset = 0.f;
+        for (size_t i = first; i < last; ++i) {
+            const Entry &e = entries[i];
+            float size = (float) e.basis;
+            if (!e.widget->fixedSize()[axis1]) {
+                if (free > 0 && totalGrow > 0)
+                    size += free * e.item.grow / totalGrow;
+                else if (free < 0 && totalShrink > 0)
+                    size += free * e.item.shrink * e.basis / totalShrink;
+            }
+            sizes[i - first] = std::max(size, 0.f);
+        }
+        if (free > 0 && totalGrow == 0) {
+            if (mJustification == Alignment::Middle)
+                offset = free / 2.f;
+            else if (mJustification == Alignment::Maximum)
+                offset = (float) free;
+        }
+
+        float mainPos = start[axis1] + offset;
+        for (size_t i = first; i < last; ++i) {
+            const Entry &e = entries[i];
+            Widget *w = e.widget;
+
+            /* Round the edges rather than the sizes so that no gaps accumulate */
+            int p0 = (int) std::round(mainPos);
+            mainPos += sizes[i - first];
+            int p1 = (int) std::round(mainPos);
+            mainPos += mSpacing[axis1];
+
+            Vector2i pos, size;
+            pos[axis1] = p0;
+            size[axis1] = p1 - p0;
+            pos[axis2] = crossPos;
+            size[axis2] = e.size[axis2];
+
+            switch (mAlignment) {
+                case Alignment::Minimum:
+                    break;
+                case Alignment::Middle:
+                    pos[axis2] += (lineCross - size[axis2]) / 2;
+                    break;
+                case Alignment::Maximum:
+                    pos[axis2] += lineCross - size[axis2];
+                    break;
+                case Alignment::Fill: {
+                        int fs = w->fixedSize()[axis2];
+                        size[axis2] = fs ? fs : lineCross;
+                    }
+                    break;
+            }
+
+            w->setPosition(pos);
+            w->setSize(size);
+            w->performLayout(ctx);
+        }
+
+        crossPos += lineCross + mSpacing[axis2];
+    }
+}
+
 NAMESPACE_END(nanogui)
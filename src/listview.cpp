@@ -0,0 +1,303 @@
+/*
+    src/listview.cpp -- Virtualized list which only instantiates widgets
+    for the rows that are currently visible
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/listview.h>
+#include <nanogui/label.h>
+#include <nanogui/theme.h>
+#include <nanogui/opengl.h>
+#include <nanogui/serializer/core.h>
+#include <limits>
+
+NAMESPACE_BEGIN(nanogui)
+
+ListView::ListView(Widget *parent)
+    : Widget(parent), mRowCount(0), mRowHeight(25), mOverscan(2),
+      mSelectedIndex(-1), mScroll(0.0), mFirstRow(0), mUpdateRows(false),
+      mRebindRows(false), mUpdatingRows(false) { }
+
+void ListView::setRowCount(int rowCount) {
+    mRowCount = std::max(rowCount, 0);
+    if (mSelectedIndex >= mRowCount)
+        mSelectedIndex = -1;
+    mUpdateRows = true;
+}
+
+void ListView::setRowHeight(int rowHeight) {
+    mRowHeight = std::max(rowHeight, 1);
+    mUpdateRows = true;
+}
+
+void ListView::setScroll(float scroll) {
+    mScroll = std::max(0.0, std::min(1.0, (double) scroll));
+    mUpdateRows = true;
+}
+
+void ListView::scrollToRow(int row) {
+    double range = contentHeight() - mSize.y();
+    if (row < 0 || row >= mRowCount || range <= 0)
+        return;
+    double offset = scrollOffset(),
+           top = (double) row * mRowHeight,
+           bottom = top + mRowHeight;
+    if (top < offset)
+        offset = top;
+    else if (bottom > offset + mSize.y())
+        offset = bottom - mSize.y();
+    mScroll = std::max(0.0, std::min(1.0, offset / range));
+    mUpdateRows = true;
+}
+
+void ListView::refresh() {
+    mRebindRows = true;
+    mUpdateRows = true;
+}
+
+int ListView::rowAt(const Vector2i &p) const {
+    Vector2i d = p - mPos;
+    int scrollbarWidth = contentHeight() > mSize.y() ? 12 : 0;
+    if (d.x() < 0 || d.y() < 0 || d.x() >= mSize.x() - scrollbarWidth ||
+        d.y() >= mSize.y())
+        return -1;
+    int row = (int) ((d.y() + scrollOffset()) / mRowHeight);
+    return row < mRowCount ? row : -1;
+}
+
+Widget *ListView::acquireRow() {
+    Widget *row = nullptr;
+    if (!mFreeRows.empty()) {
+        row = mFreeRows.back();
+        mFreeRows.pop_back();
+    } else {
+        row = mCreateCallback ? mCreateCallback(this) : new Label(this, "");
+        if (!row || row->parent() != this)
+            throw std::runtime_error(
+                "ListView: row widgets must be created as children of the list!");
+    }
+    row->setVisible(true);
+    return row;
+}
+
+void ListView::releaseRow(Widget *row) {
+    row->setVisible(false);
+    mFreeRows.push_back(row);
+}
+
+void ListView::markLayoutDirty() {
+    if (!mUpdatingRows)
+        Widget::markLayoutDirty();
+}
+
+void ListView::updateRows(NVGcontext *ctx) {
+    mUpdateRows = false;
+    mUpdatingRows = true;
+
+    double offset = scrollOffset();
+    int first = 0, last = 0;
+    if (mRowCount > 0 && mSize.y() > 0) {
+        first = std::max(0, (int) (offset / mRowHeight) - mOverscan);
+        last = std::min(mRowCount,
+            (int) std::ceil((offset + mSize.y()) / mRowHeight) + mOverscan);
+    }
+
+    /* Keep rows that are still in range, recycle everything else */
+    std::vector<Widget *> rows(std::max(last - first, 0), nullptr);
+    for (size_t i = 0; i < mRows.size(); ++i) {
+        int row = mFirstRow + (int) i;
+        if (!mRebindRows && row >= first && row < last)
+            rows[row - first] = mRows[i];
+        else
+            releaseRow(mRows[i]);
+    }
+    mRebindRows = false;
+
+    int64_t base = (int64_t) offset;
+    Vector2i rowSize(
+        mSize.x() - (contentHeight() > mSize.y() ? 12 : 0), mRowHeight);
+
+    for (int row = first; row < last; ++row) {
+        Widget *w = rows[row - first];
+        bool bound = w == nullptr;
+        if (bound) {
+            w = rows[row - first] = acquireRow();
+            if (mBindCallback)
+                mBindCallback(w, row);
+        }
+        w->setPosition(Vector2i(0, (int) ((int64_t) row * mRowHeight - base)));
+        if (bound || w->size() != rowSize) {
+            w->setSize(rowSize);
+            w->performLayout(ctx);
+        }
+    }
+
+    mRows.swap(rows);
+    mFirstRow = first;
+    mUpdatingRows = false;
+}
+
+void ListView::performLayout(NVGcontext *ctx) {
+    if (contentHeight() <= mSize.y())
+        mScroll = 0;
+    updateRows(ctx);
+}
+
+Vector2i ListView::preferredSize(NVGcontext *ctx) const {
+    int width = 0;
+    for (auto row : mRows)
+        width = std::max(width, row->cachedPreferredSize(ctx).x());
+    return Vector2i(width + 12,
+        (int) std::min(contentHeight(), (double) std::numeric_limits<int>::max()));
+}
+
+bool ListView::mouseButtonEvent(const Vector2i &p, int button, bool down,
+                                int modifiers) {
+    if (Widget::mouseButtonEvent(p, button, down, modifiers))
+        return true;
+
+    if (down && button == GLFW_MOUSE_BUTTON_1) {
+        int row = rowAt(p);
+        if (row >= 0) {
+            mSelectedIndex = row;
+            if (mCallback)
+                mCallback(row);
+        }
+        return true;
+    }
+    return false;
+}
+
+bool ListView::mouseDragEvent(const Vector2i &p, const Vector2i &rel,
+                              int button, int modifiers) {
+    if (contentHeight() > mSize.y()) {
+        /* Keep the scroll handle grabbable even for millions of rows */
+        float scrollh = std::max(20.0f, (float) (height() *
+            std::min(1.0, height() / contentHeight())));
+
+        mScroll = std::max(0.0, std::min(1.0,
+            mScroll + rel.y() / (double) (mSize.y() - 8 - scrollh)));
+        mUpdateRows = true;
+        return true;
+    } else {
+        return Widget::mouseDragEvent(p, rel, button, modifiers);
+    }
+}
+
+bool ListView::scrollEvent(const Vector2i &p, const Vector2f &rel) {
+    double range = contentHeight() - mSize.y();
+    if (range > 0) {
+        double offset = scrollOffset() - rel.y() * 3 * mRowHeight;
+        mScroll = std::max(0.0, std::min(1.0, offset / range));
+        mUpdateRows = true;
+        return true;
+    } else {
+        return Widget::scrollEvent(p, rel);
+    }
+}
+
+bool ListView::keyboardEvent(int key, int scancode, int action, int modifiers) {
+    if (!mFocused || mRowCount == 0 ||
+        (action != GLFW_PRESS && action != GLFW_REPEAT))
+        return Widget::keyboardEvent(key, scancode, action, modifiers);
+
+    int page = std::max(1, mSize.y() / mRowHeight), index = mSelectedIndex;
+    switch (key) {
+        case GLFW_KEY_UP:        index -= 1; break;
+        case GLFW_KEY_DOWN:      index += 1; break;
+        case GLFW_KEY_PAGE_UP:   index -= page; break;
+        case GLFW_KEY_PAGE_DOWN: index += page; break;
+        case GLFW_KEY_HOME:      index = 0; break;
+        case GLFW_KEY_END:       index = mRowCount - 1; break;
+        default:
+            return Widget::keyboardEvent(key, scancode, action, modifiers);
+    }
+
+    index = std::max(0, std::min(mRowCount - 1, index));
+    if (index != mSelectedIndex) {
+        mSelectedIndex = index;
+        scrollToRow(index);
+        if (mCallback)
+            mCallback(index);
+    }
+    return true;
+}
+
+void ListView::draw(NVGcontext *ctx) {
+    if (mUpdateRows)
+        updateRows(ctx);
+
+    double offset = scrollOffset();
+    bool scrollbar = contentHeight() > mSize.y();
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x(), mPos.y(), mSize.x(), mSize.y());
+
+    if (mSelectedIndex >= 0 && mSelectedIndex < mRowCount) {
+        double y = (double) mSelectedIndex * mRowHeight - offset;
+        if (y + mRowHeight > 0 && y < mSize.y()) {
+            nvgBeginPath(ctx);
+            nvgRect(ctx, mPos.x(), mPos.y() + (float) y,
+                    mSize.x() - (scrollbar ? 12 : 0), mRowHeight);
+            nvgFillColor(ctx, mTheme->mButtonGradientTopFocused);
+            nvgFill(ctx);
+        }
+    }
+
+    Widget::draw(ctx);
+    nvgRestore(ctx);
+
+    if (!scrollbar)
+        return;
+
+    float scrollh = std::max(20.0f, (float) (height() *
+        std::min(1.0, height() / contentHeight())));
+    float scroll = (float) mScroll;
+
+    NVGpaint paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 + 1, mPos.y() + 4 + 1, 8,
+        mSize.y() - 8, 3, 4, Color(0, 32), Color(0, 92));
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12, mPos.y() + 4, 8,
+                   mSize.y() - 8, 3);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+
+    paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 - 1,
+        mPos.y() + 4 + (mSize.y() - 8 - scrollh) * scroll - 1, 8, scrollh,
+        3, 4, Color(220, 100), Color(128, 100));
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12 + 1,
+                   mPos.y() + 4 + 1 + (mSize.y() - 8 - scrollh) * scroll, 8 - 2,
+                   scrollh - 2, 2);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+}
+
+void ListView::save(Serializer &s) const {
+    Widget::save(s);
+    s.set("rowHeight", mRowHeight);
+    s.set("overscan", mOverscan);
+    s.set("selectedIndex", mSelectedIndex);
+    s.set("scroll", mScroll);
+}
+
+bool ListView::load(Serializer &s) {
+    if (!Widget::load(s)) return false;
+    if (!s.get("rowHeight", mRowHeight)) return false;
+    if (!s.get("overscan", mOverscan)) return false;
+    if (!s.get("selectedIndex", mSelectedIndex)) return false;
+    if (!s.get("scroll", mScroll)) return false;
+    mUpdateRows = true;
+    return true;
+}
+
+NAMESPACE_END(nanogui)
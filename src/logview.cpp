@@ -0,0 +1,396 @@
+/*
+    src/logview.cpp -- Scrolling log console backed by a thread-safe
+    ring buffer of lines
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/logview.h>
+#include <nanogui/theme.h>
+#include <nanogui/textmetrics.h>
+#include <nanogui/opengl.h>
+#include <nanogui/serializer/core.h>
+#include <algorithm>
+#include <cmath>
+
+NAMESPACE_BEGIN(nanogui)
+
+extern void __nanogui_post_empty_event();
+
+namespace {
+    constexpr int padding = 4;
+
+    int sansFont() {
+        static int font = TextMetrics::findFont("sans");
+        return font;
+    }
+}
+
+LogView::LogView(Widget *parent, size_t capacity)
+    : Widget(parent), mEntries(std::max<size_t>(capacity, 1)), mTotal(0),
+      mCount(0), mPending(false), mScanned(0), mMinimumLevel(Level::Debug),
+      mAutoScroll(true), mFollow(true), mScrollY(0.0) {
+    mLevelColors[(int) Level::Debug] = Color(255, 100);
+    mLevelColors[(int) Level::Info] = Color(255, 190);
+    mLevelColors[(int) Level::Warning] = Color(255, 200, 60, 255);
+    mLevelColors[(int) Level::Error] = Color(255, 90, 80, 255);
+}
+
+void LogView::append(const std::string &text, Level level) {
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        size_t capacity = mEntries.size(), start = 0;
+        do {
+            size_t newline = text.find('\n', start);
+            size_t stop = newline == std::string::npos ? text.size() : newline;
+            size_t length = stop - start;
+            if (length > 0 && text[stop - 1] == '\r')
+                --length;
+            /* Reuses the storage of the line that is replaced */
+            Entry &entry = mEntries[mTotal % capacity];
+            entry.text.assign(text, start, length);
+            entry.level = level;
+            mTotal++;
+            mCount = std::min(mCount + 1, capacity);
+            start = stop + 1;
+        } while (start < text.size());
+    }
+
+    /* Wake up the main loop once per frame, not once per line */
+    if (!mPending.exchange(true))
+        __nanogui_post_empty_event();
+}
+
+void LogView::clear() {
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        mCount = 0;
+    }
+    if (!mPending.exchange(true))
+        __nanogui_post_empty_event();
+}
+
+size_t LogView::capacity() const {
+    std::lock_guard<std::mutex> guard(mMutex);
+    return mEntries.size();
+}
+
+void LogView::setCapacity(size_t capacity) {
+    capacity = std::max<size_t>(capacity, 1);
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        if (capacity == mEntries.size())
+            return;
+        std::vector<Entry> entries(capacity);
+        size_t count = std::min(mCount, capacity);
+        for (uint64_t seq = mTotal - count; seq < mTotal; ++seq)
+            entries[seq % capacity] = std::move(mEntries[seq % mEntries.size()]);
+        mEntries.swap(entries);
+        mCount = count;
+    }
+    mPending = true;
+}
+
+uint64_t LogView::totalLines() const {
+    std::lock_guard<std::mutex> guard(mMutex);
+    return mTotal;
+}
+
+std::string LogView::lineText(size_t index) const {
+    if (index >= mRows.size())
+        throw std::runtime_error("LogView::lineText(): index out of bounds!");
+    std::lock_guard<std::mutex> guard(mMutex);
+    uint64_t seq = mRows[index];
+    return seq >= mTotal - mCount ? entry(seq).text : std::string();
+}
+
+LogView::Level LogView::lineLevel(size_t index) const {
+    if (index >= mRows.size())
+        throw std::runtime_error("LogView::lineLevel(): index out of bounds!");
+    std::lock_guard<std::mutex> guard(mMutex);
+    uint64_t seq = mRows[index];
+    return seq >= mTotal - mCount ? entry(seq).level : Level::Info;
+}
+
+void LogView::setFilter(const std::string &filter) {
+    if (filter == mFilter)
+        return;
+    mFilter = filter;
+    refilter();
+}
+
+void LogView::setMinimumLevel(Level level) {
+    if (level == mMinimumLevel)
+        return;
+    mMinimumLevel = level;
+    refilter();
+}
+
+void LogView::setAutoScroll(bool autoScroll) {
+    mAutoScroll = autoScroll;
+    if (autoScroll)
+        scrollToBottom();
+    else
+        mFollow = false;
+}
+
+void LogView::scrollToBottom() {
+    setScrollOffset(contentHeight());
+    mFollow = mAutoScroll;
+}
+
+int LogView::lineHeight() const {
+    float height = 0.f;
+    TextMetrics::verticalMetrics(sansFont(), (float) fontSize(), nullptr, nullptr, &height,
+                                 pixelRatio());
+    return std::max(1, (int) std::ceil(height));
+}
+
+bool LogView::matches(const Entry &entry) const {
+    return entry.level >= mMinimumLevel &&
+           (mFilter.empty() || entry.text.find(mFilter) != std::string::npos);
+}
+
+void LogView::refilter() {
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        mRows.clear();
+        for (uint64_t seq = mTotal - mCount; seq < mTotal; ++seq) {
+            if (matches(entry(seq)))
+                mRows.push_back(seq);
+        }
+        mScanned = mTotal;
+    }
+    if (mFollow)
+        scrollToBottom();
+    else
+        setScrollOffset(mScrollY);
+}
+
+void LogView::update() {
+    if (!mPending.exchange(false))
+        return;
+
+    size_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        uint64_t oldest = mTotal - mCount;
+        while (!mRows.empty() && mRows.front() < oldest) {
+            mRows.pop_front();
+            ++dropped;
+        }
+        for (uint64_t seq = std::max(mScanned, oldest); seq < mTotal; ++seq) {
+            if (matches(entry(seq)))
+                mRows.push_back(seq);
+        }
+        mScanned = mTotal;
+    }
+
+    /* Keep the same lines in view unless the view follows the log */
+    if (mFollow)
+        scrollToBottom();
+    else
+        setScrollOffset(mScrollY - (double) dropped * lineHeight());
+}
+
+void LogView::setScrollOffset(double offset) {
+    double range = contentHeight() - (mSize.y() - 2 * padding);
+    mScrollY = std::max(0.0, std::min(offset, range));
+}
+
+Vector2i LogView::preferredSize(NVGcontext *) const {
+    return Vector2i(fontSize() * 30, lineHeight() * 10 + 2 * padding);
+}
+
+bool LogView::mouseButtonEvent(const Vector2i &p, int button, bool down,
+                               int modifiers) {
+    if (Widget::mouseButtonEvent(p, button, down, modifiers))
+        return true;
+    if (down && button == GLFW_MOUSE_BUTTON_1) {
+        requestFocus();
+        return true;
+    }
+    return false;
+}
+
+bool LogView::mouseDragEvent(const Vector2i &p, const Vector2i &rel,
+                             int button, int modifiers) {
+    int height = mSize.y() - 2 * padding;
+    double range = contentHeight() - height;
+    if (range <= 0)
+        return Widget::mouseDragEvent(p, rel, button, modifiers);
+
+    float scrollh = std::max(20.0f, (float) (mSize.y() *
+        std::min(1.0, height / contentHeight())));
+    setScrollOffset(mScrollY + rel.y() * range / (mSize.y() - 8 - scrollh));
+    mFollow = mAutoScroll && mScrollY >= range;
+    return true;
+}
+
+bool LogView::scrollEvent(const Vector2i &p, const Vector2f &rel) {
+    double range = contentHeight() - (mSize.y() - 2 * padding);
+    if (range <= 0)
+        return Widget::scrollEvent(p, rel);
+
+    setScrollOffset(mScrollY - rel.y() * 3 * lineHeight());
+    mFollow = mAutoScroll && mScrollY >= range;
+    return true;
+}
+
+bool LogView::keyboardEvent(int key, int scancode, int action, int modifiers) {
+    if (!mFocused || (action != GLFW_PRESS && action != GLFW_REPEAT))
+        return Widget::keyboardEvent(key, scancode, action, modifiers);
+
+    int lineh = lineHeight(), page = std::max(lineh, mSize.y() - 2 * padding - lineh);
+    switch (key) {
+        case GLFW_KEY_UP:        setScrollOffset(mScrollY - lineh); break;
+        case GLFW_KEY_DOWN:      setScrollOffset(mScrollY + lineh); break;
+        case GLFW_KEY_PAGE_UP:   setScrollOffset(mScrollY - page); break;
+        case GLFW_KEY_PAGE_DOWN: setScrollOffset(mScrollY + page); break;
+        case GLFW_KEY_HOME:      setScrollOffset(0); break;
+        case GLFW_KEY_END:       setScrollOffset(contentHeight()); break;
+        default:
+            return Widget::keyboardEvent(key, scancode, action, modifiers);
+    }
+    double range = contentHeight() - (mSize.y() - 2 * padding);
+    mFollow = mAutoScroll && mScrollY >= range;
+    return true;
+}
+
+void LogView::draw(NVGcontext *ctx) {
+    update();
+    /* The height of the view may have changed since the last frame */
+    if (mFollow)
+        scrollToBottom();
+    else
+        setScrollOffset(mScrollY);
+    Widget::draw(ctx);
+
+    NVGpaint bg = nvgBoxGradient(ctx,
+        mPos.x() + 1, mPos.y() + 1 + 1.0f, mSize.x() - 2, mSize.y() - 2,
+        3, 4, Color(32, 32), Color(0, 32));
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + 1, mPos.y() + 1 + 1.0f, mSize.x() - 2,
+                   mSize.y() - 2, 3);
+    nvgFillPaint(ctx, bg);
+    nvgFill(ctx);
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + 0.5f, mPos.y() + 0.5f, mSize.x() - 1,
+                   mSize.y() - 1, 2.5f);
+    nvgStrokeColor(ctx, Color(0, 48));
+    nvgStroke(ctx);
+
+    int lineh = lineHeight(), height = mSize.y() - 2 * padding;
+    bool scrollbar = contentHeight() > height;
+    int width = std::max(0, mSize.x() - 2 * padding - (scrollbar ? 12 : 0));
+
+    size_t first = (size_t) (mScrollY / lineh),
+           last = std::min(mRows.size(), (size_t) std::ceil((mScrollY + height) / lineh));
+    first = std::min(first, last);
+
+    /* Copy the visible lines, so that appending threads only wait briefly */
+    mVisible.resize(last - first);
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        uint64_t oldest = mTotal - mCount;
+        for (size_t row = first; row < last; ++row) {
+            Entry &visible = mVisible[row - first];
+            uint64_t seq = mRows[row];
+            if (seq >= oldest) {
+                const Entry &e = entry(seq);
+                visible.text.assign(e.text);
+                visible.level = e.level;
+            } else {
+                /* Overwritten since the last update */
+                visible.text.clear();
+            }
+        }
+    }
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x() + padding, mPos.y() + padding, width, height);
+    nvgFontSize(ctx, fontSize());
+    nvgFontFace(ctx, "sans");
+    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+
+    /* Lines are not measured; long lines are cut after the number of bytes
+       that the narrowest glyphs would need to fill the view */
+    size_t maxBytes = (size_t) (width / (fontSize() * 0.15f)) + 1;
+    for (size_t row = first; row < last; ++row) {
+        const Entry &e = mVisible[row - first];
+        if (e.text.empty())
+            continue;
+        size_t length = e.text.size();
+        if (length > maxBytes) {
+            length = maxBytes;
+            while (length > 0 && ((unsigned char) e.text[length] & 0xC0) == 0x80)
+                --length;
+        }
+        float y = mPos.y() + padding + (float) ((double) row * lineh - mScrollY);
+        nvgFillColor(ctx, mEnabled ? mLevelColors[(int) e.level] : mTheme->mDisabledTextColor);
+        nvgText(ctx, mPos.x() + padding, y, e.text.data(), e.text.data() + length);
+    }
+    nvgRestore(ctx);
+
+    if (!scrollbar)
+        return;
+
+    double range = contentHeight() - height;
+    float scrollh = std::max(20.0f, (float) (mSize.y() *
+        std::min(1.0, height / contentHeight())));
+    float scroll = (float) std::min(1.0, mScrollY / range);
+
+    NVGpaint paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 + 1, mPos.y() + 4 + 1, 8,
+        mSize.y() - 8, 3, 4, Color(0, 32), Color(0, 92));
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12, mPos.y() + 4, 8,
+                   mSize.y() - 8, 3);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+
+    paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 - 1,
+        mPos.y() + 4 + (mSize.y() - 8 - scrollh) * scroll - 1, 8, scrollh,
+        3, 4, Color(220, 100), Color(128, 100));
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12 + 1,
+                   mPos.y() + 4 + 1 + (mSize.y() - 8 - scrollh) * scroll, 8 - 2,
+                   scrollh - 2, 2);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+}
+
+void LogView::save(Serializer &s) const {
+    Widget::save(s);
+    s.set("capacity", (uint64_t) capacity());
+    s.set("filter", mFilter);
+    s.set("minimumLevel", (int) mMinimumLevel);
+    s.set("autoScroll", mAutoScroll);
+}
+
+bool LogView::load(Serializer &s) {
+    if (!Widget::load(s)) return false;
+    uint64_t capacity;
+    std::string filter;
+    int minimumLevel;
+    if (!s.get("capacity", capacity)) return false;
+    if (!s.get("filter", filter)) return false;
+    if (!s.get("minimumLevel", minimumLevel)) return false;
+    if (!s.get("autoScroll", mAutoScroll)) return false;
+    setCapacity((size_t) capacity);
+    mFilter = filter;
+    mMinimumLevel = (Level) minimumLevel;
+    refilter();
+    return true;
+}
+
+NAMESPACE_END(nanogui)
@@ -0,0 +1,44 @@
+/*
+    src/nanogui_pack.cpp -- command line tool that bundles fonts, images
+    and other assets into a resource pack
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+/* Only the standard library and the pack format are used, so that the tool
+   builds (and runs on the build machine) independently of the library */
+#include "resourcepack_format.h"
+#include <iostream>
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "Syntax: " << argv[0] << " <output.pack> [[name=]file ...]" << std::endl
+                  << "Resources are named after the file name unless a name is given." << std::endl;
+        return 1;
+    }
+
+    std::vector<std::pair<std::string, std::string>> files;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq != std::string::npos) {
+            files.emplace_back(arg.substr(0, eq), arg.substr(eq + 1));
+        } else {
+            size_t slash = arg.find_last_of("/\\");
+            files.emplace_back(slash == std::string::npos ? arg : arg.substr(slash + 1), arg);
+        }
+    }
+
+    try {
+        nanogui::pack::write(argv[1], files);
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -30,14 +30,17 @@ void Popup::performLayout(NVGcontext *ctx) {
         mChildren[0]->setSize(mSize);
         mChildren[0]->performLayout(ctx);
     }
-    if (mSide == Side::Left)
-        mAnchorPos[0] -= size()[0];
 }
 
 void Popup::refreshRelativePlacement() {
     mParentWindow->refreshRelativePlacement();
     mVisible &= mParentWindow->visibleRecursive();
     mPos = mParentWindow->position() + mAnchorPos - Vector2i(0, mAnchorHeight);
+    /* A popup on the left side ends at the anchor. This is applied here
+       rather than in performLayout(), which may run concurrently with the
+       layout of the parent window that sets the anchor. */
+    if (mSide == Side::Left)
+        mPos.x() -= mSize.x();
 }
 
 void Popup::draw(NVGcontext* ctx) {
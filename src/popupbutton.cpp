@@ -13,6 +13,7 @@
 #include <nanogui/theme.h>
 #include <nanogui/opengl.h>
 #include <nanogui/serializer/core.h>
+#include <nanogui/textmetrics.h>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -56,7 +57,9 @@ void PopupButton::draw(NVGcontext* ctx) {
         nvgFillColor(ctx, mEnabled ? textColor : mTheme->mDisabledTextColor);
         nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
 
-        float iw = nvgTextBounds(ctx, 0, 0, icon.data(), nullptr, nullptr);
+        float iw = TextMetrics::textWidth(
+            ctx, "icons", (mFontSize < 0 ? mTheme->mButtonFontSize : mFontSize) * icon_scale(),
+            icon.data());
         Vector2f iconPos(0, mPos.y() + mSize.y() * 0.5f - 1);
 
         if (mPopup->side() == Popup::Right)
@@ -74,6 +77,8 @@ void PopupButton::performLayout(NVGcontext *ctx) {
     const Window *parentWindow = window();
 
     int posY = absolutePosition().y() - parentWindow->position().y() + mSize.y() /2;
+    /* The popup places itself relative to the anchor when it is drawn, so
+       this does not depend on its size (see Popup::refreshRelativePlacement()) */
     if (mPopup->side() == Popup::Right)
         mPopup->setAnchorPos(Vector2i(parentWindow->width() + 15, posY));
     else
@@ -0,0 +1,253 @@
+/*
+    src/resourcepack.cpp -- Memory-mapped archive of fonts, images
+    and other assets
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/resourcepack.h>
+#include "resourcepack_format.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#if defined(NANOGUI_EMBED_RESOURCES)
+#  include <nanogui_resources.h>
+#endif
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+NAMESPACE_BEGIN(nanogui)
+
+namespace {
+    using pack::headerSize;
+    using pack::entrySize;
+
+    uint64_t readInt(const uint8_t *p, int bytes) {
+        uint64_t value = 0;
+        for (int i = bytes - 1; i >= 0; --i)
+            value = (value << 8) | p[i];
+        return value;
+    }
+
+    void unmap(const uint8_t *data, size_t size, void *mapping) {
+#if defined(_WIN32)
+        (void) size;
+        UnmapViewOfFile(data);
+        CloseHandle((HANDLE) mapping);
+#else
+        (void) data;
+        munmap(mapping, size);
+#endif
+    }
+
+    struct Registry {
+        std::mutex mutex;
+        /* Searched from the back, so that later packs take precedence */
+        std::vector<std::unique_ptr<ResourcePack>> packs;
+        /* Why the built-in pack is missing, if it could not be opened */
+        std::string error;
+
+        Registry() {
+#if defined(NANOGUI_EMBED_RESOURCES)
+            packs.emplace_back(new ResourcePack(nanogui_pack, nanogui_pack_size));
+#elif defined(NANOGUI_RESOURCE_PACK)
+            /* Use the installed pack, or the one in the build tree when running
+               uninstalled. Keep going without either, so that applications can
+               still add their own packs */
+            std::vector<const char *> paths;
+            if (const char *path = getenv("NANOGUI_RESOURCE_PACK"))
+                paths.push_back(path);
+            else if (strcmp(NANOGUI_RESOURCE_PACK, NANOGUI_RESOURCE_PACK_BUILD) != 0)
+                paths = { NANOGUI_RESOURCE_PACK, NANOGUI_RESOURCE_PACK_BUILD };
+            else
+                paths = { NANOGUI_RESOURCE_PACK };
+            for (const char *path : paths) {
+                try {
+                    packs.emplace_back(new ResourcePack(path));
+                    error.clear();
+                    break;
+                } catch (const std::runtime_error &e) {
+                    if (error.empty())
+                        error = e.what();
+                }
+            }
+#endif
+        }
+    };
+
+    Registry &registry() {
+        static Registry registry;
+        return registry;
+    }
+}
+
+ResourcePack::ResourcePack(const std::string &filename)
+    : mData(nullptr), mSize(0), mCount(0), mMapping(nullptr) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("Could not open resource pack \"" + filename + "\"!");
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG) headerSize) {
+        CloseHandle(file);
+        throw std::runtime_error("Invalid resource pack \"" + filename + "\"!");
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    const void *data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!data) {
+        if (mapping)
+            CloseHandle(mapping);
+        throw std::runtime_error("Could not map resource pack \"" + filename + "\"!");
+    }
+    mMapping = mapping;
+    mData = (const uint8_t *) data;
+    mSize = (size_t) size.QuadPart;
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Could not open resource pack \"" + filename + "\"!");
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) headerSize) {
+        close(fd);
+        throw std::runtime_error("Invalid resource pack \"" + filename + "\"!");
+    }
+    void *data = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        throw std::runtime_error("Could not map resource pack \"" + filename + "\"!");
+    mMapping = data;
+    mData = (const uint8_t *) data;
+    mSize = (size_t) st.st_size;
+#endif
+
+    try {
+        parse();
+    } catch (const std::runtime_error &) {
+        unmap(mData, mSize, mMapping);
+        throw std::runtime_error("Invalid resource pack \"" + filename + "\"!");
+    }
+}
+
+ResourcePack::ResourcePack(const uint8_t *data, size_t size)
+    : mData(data), mSize(size), mCount(0), mMapping(nullptr) {
+    parse();
+}
+
+ResourcePack::~ResourcePack() {
+    if (mMapping)
+        unmap(mData, mSize, mMapping);
+}
+
+void ResourcePack::parse() {
+    if (mSize < headerSize || memcmp(mData, pack::magic, 4) != 0 ||
+        readInt(mData + 4, 4) != pack::version)
+        throw std::runtime_error("Invalid resource pack!");
+    uint64_t count = readInt(mData + 8, 4);
+    if (count > (mSize - headerSize) / entrySize)
+        throw std::runtime_error("Invalid resource pack!");
+    mCount = (size_t) count;
+
+    /* Check all ranges once, so that lookups need no bounds checks */
+    for (size_t i = 0; i < mCount; ++i) {
+        const uint8_t *entry = mData + headerSize + i * entrySize;
+        uint64_t offset = readInt(entry, 8), size = readInt(entry + 8, 8),
+                 nameOffset = readInt(entry + 16, 4), nameLength = readInt(entry + 20, 4);
+        if (offset > mSize || size > mSize - offset ||
+            nameOffset > mSize || nameLength > mSize - nameOffset)
+            throw std::runtime_error("Invalid resource pack!");
+    }
+}
+
+void ResourcePack::entryName(size_t index, const char **name, size_t *length) const {
+    const uint8_t *entry = mData + headerSize + index * entrySize;
+    *name = (const char *) mData + readInt(entry + 16, 4);
+    *length = (size_t) readInt(entry + 20, 4);
+}
+
+std::string ResourcePack::name(size_t index) const {
+    if (index >= mCount)
+        throw std::runtime_error("ResourcePack::name(): index out of bounds!");
+    const char *name;
+    size_t length;
+    entryName(index, &name, &length);
+    return std::string(name, length);
+}
+
+ResourcePack::Resource ResourcePack::find(const std::string &name) const {
+    size_t lo = 0, hi = mCount;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const char *entry;
+        size_t length;
+        entryName(mid, &entry, &length);
+        int cmp = memcmp(entry, name.data(), std::min(length, name.size()));
+        if (cmp == 0)
+            cmp = length < name.size() ? -1 : (length > name.size() ? 1 : 0);
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else if (cmp > 0) {
+            hi = mid;
+        } else {
+            const uint8_t *e = mData + headerSize + mid * entrySize;
+            Resource resource;
+            resource.data = mData + readInt(e, 8);
+            resource.size = (size_t) readInt(e + 8, 8);
+            return resource;
+        }
+    }
+    return Resource();
+}
+
+void ResourcePack::write(const std::string &filename,
+                         const std::vector<std::pair<std::string, std::string>> &files) {
+    pack::write(filename, files);
+}
+
+void ResourcePack::addPack(const std::string &filename) {
+    std::unique_ptr<ResourcePack> pack(new ResourcePack(filename));
+    Registry &r = registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    r.packs.push_back(std::move(pack));
+}
+
+bool ResourcePack::hasResource(const std::string &name) {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    for (auto it = r.packs.rbegin(); it != r.packs.rend(); ++it) {
+        if ((*it)->find(name).data)
+            return true;
+    }
+    return false;
+}
+
+ResourcePack::Resource ResourcePack::resource(const std::string &name) {
+    Registry &r = registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    for (auto it = r.packs.rbegin(); it != r.packs.rend(); ++it) {
+        Resource resource = (*it)->find(name);
+        if (resource.data)
+            return resource;
+    }
+    if (!r.error.empty())
+        throw std::runtime_error("Unknown resource \"" + name + "\" (" + r.error + ")!");
+    throw std::runtime_error("Unknown resource \"" + name + "\"!");
+}
+
+NAMESPACE_END(nanogui)
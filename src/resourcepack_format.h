@@ -0,0 +1,104 @@
+/*
+    src/resourcepack_format.h -- File format of resource packs, shared by
+    the library and the nanogui-pack tool
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#pragma once
+
+/* The nanogui-pack tool runs on the build machine, so this header only uses
+   the standard library and does not depend on the (exported) headers or the
+   compile definitions of the library. */
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Layout (all integers are little endian):
+
+     header:  char magic[4] = "NGPK", uint32 version, uint32 count, uint32 reserved
+     index:   count x { uint64 offset, uint64 size, uint32 nameOffset, uint32 nameLength }
+     names:   concatenated resource names, sorted
+     data:    resource contents, each aligned to 16 bytes
+
+   Offsets are relative to the start of the pack. */
+
+namespace nanogui {
+namespace pack {
+    const char magic[4] = { 'N', 'G', 'P', 'K' };
+    const uint32_t version = 1;
+    const size_t headerSize = 16, entrySize = 24, dataAlignment = 16;
+
+    inline void writeInt(std::string &out, uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i)
+            out += (char) ((value >> (8 * i)) & 0xFF);
+    }
+
+    /// Write a pack that contains the given (name, path) pairs, or throw \c std::runtime_error
+    inline void write(const std::string &filename,
+                      const std::vector<std::pair<std::string, std::string>> &files) {
+        std::vector<std::pair<std::string, std::string>> sorted(files);
+        std::sort(sorted.begin(), sorted.end());
+        for (size_t i = 1; i < sorted.size(); ++i) {
+            if (sorted[i].first == sorted[i - 1].first)
+                throw std::runtime_error("ResourcePack::write(): duplicate resource \"" +
+                                         sorted[i].first + "\"!");
+        }
+
+        std::vector<std::string> contents;
+        for (const auto &file : sorted) {
+            std::ifstream is(file.second, std::ios::binary);
+            if (!is)
+                throw std::runtime_error("ResourcePack::write(): could not read \"" +
+                                         file.second + "\"!");
+            std::ostringstream os;
+            os << is.rdbuf();
+            contents.push_back(os.str());
+        }
+
+        std::string names;
+        for (const auto &file : sorted)
+            names += file.first;
+
+        size_t namesOffset = headerSize + sorted.size() * entrySize;
+        size_t offset = namesOffset + names.size();
+
+        std::string out(magic, 4);
+        writeInt(out, version, 4);
+        writeInt(out, sorted.size(), 4);
+        writeInt(out, 0, 4);
+        size_t nameOffset = namesOffset;
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            offset = (offset + dataAlignment - 1) / dataAlignment * dataAlignment;
+            writeInt(out, offset, 8);
+            writeInt(out, contents[i].size(), 8);
+            writeInt(out, nameOffset, 4);
+            writeInt(out, sorted[i].first.size(), 4);
+            offset += contents[i].size();
+            nameOffset += sorted[i].first.size();
+        }
+        out += names;
+        for (const auto &data : contents) {
+            out.resize((out.size() + dataAlignment - 1) / dataAlignment * dataAlignment, '\0');
+            out += data;
+        }
+
+        std::ofstream os(filename, std::ios::binary);
+        os.write(out.data(), (std::streamsize) out.size());
+        os.close();
+        if (!os)
+            throw std::runtime_error("ResourcePack::write(): could not write \"" + filename + "\"!");
+    }
+}
+}
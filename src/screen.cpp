@@ -16,6 +16,8 @@
 #include <nanogui/opengl.h>
 #include <nanogui/window.h>
 #include <nanogui/popup.h>
+#include <nanogui/textmetrics.h>
+#include <nanogui/glyphcache.h>
 #include <map>
 #include <iostream>
 
@@ -342,6 +344,7 @@ void Screen::initialize(GLFWwindow *window, bool shutdownGLFWOnDestruct) {
     mNVGContext = nvgCreateGL3(flags);
     if (mNVGContext == nullptr)
         throw std::runtime_error("Could not initialize NanoVG!");
+    TextMetrics::setPixelRatio(mNVGContext, mPixelRatio);
 
     mVisible = glfwGetWindowAttrib(window, GLFW_VISIBLE) != 0;
     setTheme(new Theme(mNVGContext));
@@ -358,6 +361,9 @@ void Screen::initialize(GLFWwindow *window, bool shutdownGLFWOnDestruct) {
     /// Fixes retina display-related font rendering issue (#185)
     nvgBeginFrame(mNVGContext, mSize[0], mSize[1], mPixelRatio);
     nvgEndFrame(mNVGContext);
+
+    /* Rasterize the glyphs that are known to be needed before the first frame */
+    GlyphCache::prewarm(mNVGContext, mPixelRatio);
 }
 
 Screen::~Screen() {
@@ -366,8 +372,10 @@ Screen::~Screen() {
         if (mCursors[i])
             glfwDestroyCursor(mCursors[i]);
     }
-    if (mNVGContext)
+    if (mNVGContext) {
+        TextMetrics::setPixelRatio(mNVGContext, 0.f);
         nvgDeleteGL3(mNVGContext);
+    }
     if (mGLFWWindow && mShutdownGLFWOnDestruct)
         glfwDestroyWindow(mGLFWWindow);
 }
@@ -427,6 +435,10 @@ void Screen::drawWidgets() {
     if (mSize[0])
         mPixelRatio = (float) mFBSize[0] / (float) mSize[0];
 #endif
+    TextMetrics::setPixelRatio(mNVGContext, mPixelRatio);
+
+    /* Lay out the widgets that changed since the last frame */
+    updateLayout(mNVGContext);
 
     glViewport(0, 0, mFBSize[0], mFBSize[1]);
     glBindSampler(0, 0);
@@ -700,7 +712,7 @@ void Screen::disposeWindow(Window *window) {
 
 void Screen::centerWindow(Window *window) {
     if (window->size() == Vector2i::Zero()) {
-        window->setSize(window->preferredSize(mNVGContext));
+        window->setSize(window->cachedPreferredSize(mNVGContext));
         window->performLayout(mNVGContext);
     }
     window->setPosition((mSize - window->size()) / 2);
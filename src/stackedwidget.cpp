@@ -32,17 +32,18 @@ int StackedWidget::selectedIndex() const {
 }
 
 void StackedWidget::performLayout(NVGcontext *ctx) {
-    for (auto child : mChildren) {
+    /* The pages (e.g. the tabs of a TabWidget) are independent */
+    forEachParallel(mChildren, [this, ctx](Widget *child) {
         child->setPosition(Vector2i::Zero());
         child->setSize(mSize);
         child->performLayout(ctx);
-    }
+    });
 }
 
 Vector2i StackedWidget::preferredSize(NVGcontext *ctx) const {
     Vector2i size = Vector2i::Zero();
     for (auto child : mChildren)
-        size = size.cwiseMax(child->preferredSize(ctx));
+        size = size.cwiseMax(child->cachedPreferredSize(ctx));
     return size;
 }
 
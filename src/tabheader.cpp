@@ -14,6 +14,8 @@
 #include <nanogui/tabheader.h>
 #include <nanogui/theme.h>
 #include <nanogui/opengl.h>
+#include <nanogui/textmetrics.h>
+#include <algorithm>
 #include <numeric>
 
 NAMESPACE_BEGIN(nanogui)
@@ -22,39 +24,52 @@ TabHeader::TabButton::TabButton(TabHeader &header, const std::string &label)
     : mHeader(&header), mLabel(label) { }
 
 Vector2i TabHeader::TabButton::preferredSize(NVGcontext *ctx) const {
-    // No need to call nvg font related functions since this is done by the tab header implementation
     float bounds[4];
-    int labelWidth = nvgTextBounds(ctx, 0, 0, mLabel.c_str(), nullptr, bounds);
+    int labelWidth = TextMetrics::textBounds(ctx, mHeader->font(), mHeader->fontSize(),
+                                             mLabel, bounds);
     int buttonWidth = labelWidth + 2 * mHeader->theme()->mTabButtonHorizontalPadding;
     int buttonHeight = bounds[3] - bounds[1] + 2 * mHeader->theme()->mTabButtonVerticalPadding;
     return Vector2i(buttonWidth, buttonHeight);
 }
 
 void TabHeader::TabButton::calculateVisibleString(NVGcontext *ctx) {
+    // Measure the label only when it or the font has changed.
+    float fontSize = (float) mHeader->fontSize(), pixelRatio = TextMetrics::pixelRatio(ctx);
+    if (mGlyphFont != mHeader->font() || mGlyphFontSize != fontSize ||
+        mGlyphPixelRatio != pixelRatio) {
+        mLabelWidth = TextMetrics::glyphPositions(ctx, mHeader->font(), fontSize,
+                                                  mLabel, mGlyphs);
+        mGlyphFont = mHeader->font();
+        mGlyphFontSize = fontSize;
+        mGlyphPixelRatio = pixelRatio;
+        mVisibleFor = -1;
+    }
+
     // The size must have been set in by the enclosing tab header.
-    NVGtextRow displayedText;
-    nvgTextBreakLines(ctx, mLabel.c_str(), nullptr, mSize.x(), &displayedText, 1);
-
-    // Check to see if the text need to be truncated.
-    if (displayedText.next[0]) {
-        auto truncatedWidth = nvgTextBounds(ctx, 0.0f, 0.0f,
-                                            displayedText.start, displayedText.end, nullptr);
-        auto dotsWidth = nvgTextBounds(ctx, 0.0f, 0.0f, dots, nullptr, nullptr);
-        while ((truncatedWidth + dotsWidth + mHeader->theme()->mTabButtonHorizontalPadding) > mSize.x()
-                && displayedText.end != displayedText.start) {
-            --displayedText.end;
-            truncatedWidth = nvgTextBounds(ctx, 0.0f, 0.0f,
-                                           displayedText.start, displayedText.end, nullptr);
-        }
+    if (mVisibleFor == mSize.x())
+        return;
+    mVisibleFor = mSize.x();
 
-        // Remember the truncated width to know where to display the dots.
-        mVisibleWidth = truncatedWidth;
-        mVisibleText.last = displayedText.end;
-    } else {
-        mVisibleText.last = nullptr;
+    int padding = mHeader->theme()->mTabButtonHorizontalPadding;
+    mTruncated = mLabelWidth + 2 * padding > mSize.x();
+    if (!mTruncated) {
+        mVisibleLength = mLabel.size();
         mVisibleWidth = 0;
+        return;
     }
-    mVisibleText.first = displayedText.start;
+
+    // Keep the longest prefix of whole glyphs that fits together with the dots.
+    float available = mSize.x() - padding -
+        TextMetrics::textWidth(ctx, mHeader->font(), fontSize, dots);
+    auto fitting = std::upper_bound(mGlyphs.begin(), mGlyphs.end(), available,
+        [](float width, const TextMetrics::GlyphPosition &g) { return width < g.x; });
+    size_t count = (size_t) std::distance(mGlyphs.begin(), fitting);
+    if (count > 0 && (count < mGlyphs.size() || mLabelWidth > available))
+        --count;
+
+    // Remember the truncated width to know where to display the dots.
+    mVisibleLength = count < mGlyphs.size() ? mGlyphs[count].offset : mLabel.size();
+    mVisibleWidth = count < mGlyphs.size() ? (int) mGlyphs[count].x : (int) mLabelWidth;
 }
 
 void TabHeader::TabButton::drawAtPosition(NVGcontext *ctx, const Vector2i& position, bool active) {
@@ -110,8 +125,8 @@ void TabHeader::TabButton::drawAtPosition(NVGcontext *ctx, const Vector2i& posit
     NVGcolor textColor = mHeader->theme()->mTextColor;
     nvgBeginPath(ctx);
     nvgFillColor(ctx, textColor);
-    nvgText(ctx, textX, textY, mVisibleText.first, mVisibleText.last);
-    if (mVisibleText.last != nullptr)
+    nvgText(ctx, textX, textY, mLabel.data(), mLabel.data() + mVisibleLength);
+    if (mTruncated)
         nvgText(ctx, textX + mVisibleWidth, textY, dots, nullptr);
 }
 
@@ -172,6 +187,7 @@ void TabHeader::addTab(int index, const std::string &label) {
     assert(index <= tabCount());
     mTabButtons.insert(std::next(mTabButtons.begin(), index), TabButton(*this, label));
     setActiveTab(index);
+    invalidateLayout();
 }
 
 int TabHeader::removeTab(const std::string &label) {
@@ -183,6 +199,7 @@ int TabHeader::removeTab(const std::string &label) {
     mTabButtons.erase(element);
     if (index == mActiveTab && index != 0)
         setActiveTab(index - 1);
+    invalidateLayout();
     return index;
 }
 
@@ -191,6 +208,7 @@ void TabHeader::removeTab(int index) {
     mTabButtons.erase(std::next(mTabButtons.begin(), index));
     if (index == mActiveTab && index != 0)
         setActiveTab(index - 1);
+    invalidateLayout();
 }
 
 const std::string& TabHeader::tabLabelAt(int index) const {
@@ -294,16 +312,12 @@ void TabHeader::performLayout(NVGcontext* ctx) {
         tab.calculateVisibleString(ctx);
         currentPosition.x() += tabPreferred.x();
     }
+    mVisibleStart = std::max(0, std::min(mVisibleStart, tabCount() - 1));
     calculateVisibleEnd();
-    if (mVisibleStart != 0 || mVisibleEnd != tabCount())
-        mOverflowing = true;
+    mOverflowing = mVisibleStart != 0 || mVisibleEnd != tabCount();
 }
 
 Vector2i TabHeader::preferredSize(NVGcontext* ctx) const {
-    // Set up the nvg context for measuring the text inside the tab buttons.
-    nvgFontFace(ctx, mFont.c_str());
-    nvgFontSize(ctx, fontSize());
-    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
     Vector2i size = Vector2i(2*theme()->mTabControlWidth, 0);
     for (auto& tab : mTabButtons) {
         auto tabPreferred = tab.preferredSize(ctx);
@@ -350,6 +364,17 @@ bool TabHeader::mouseButtonEvent(const Vector2i &p, int button, bool down, int m
     return false;
 }
 
+bool TabHeader::scrollEvent(const Vector2i &p, const Vector2f &rel) {
+    // Scrolling moves the visible range of tabs by one tab.
+    if (!mOverflowing || rel.y() == 0)
+        return Widget::scrollEvent(p, rel);
+    if (rel.y() > 0)
+        onArrowLeft();
+    else
+        onArrowRight();
+    return true;
+}
+
 void TabHeader::draw(NVGcontext* ctx) {
     // Draw controls.
     Widget::draw(ctx);
@@ -434,7 +459,7 @@ void TabHeader::drawControls(NVGcontext* ctx) {
     ih *= icon_scale();
     nvgFontSize(ctx, ih);
     nvgFontFace(ctx, "icons");
-    float rightWidth = nvgTextBounds(ctx, 0, 0, iconRight.data(), nullptr, nullptr);
+    float rightWidth = TextMetrics::textWidth(ctx, "icons", ih, iconRight.data());
     if (active)
         arrowColor = mTheme->mTextColor;
     else
@@ -0,0 +1,831 @@
+/*
+    src/tableview.cpp -- Virtualized table which draws its cells directly
+    and only instantiates widgets for the cell that is being edited
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/tableview.h>
+#include <nanogui/textbox.h>
+#include <nanogui/theme.h>
+#include <nanogui/opengl.h>
+#include <nanogui/serializer/core.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+NAMESPACE_BEGIN(nanogui)
+
+std::string TableModel::headerText(int) const { return ""; }
+
+bool TableModel::editable(int, int) const { return false; }
+
+bool TableModel::setText(int, int, const std::string &) { return false; }
+
+static bool parseNumber(const std::string &str, double &value) {
+    if (str.empty())
+        return false;
+    char *end = nullptr;
+    value = std::strtod(str.c_str(), &end);
+    return end == str.c_str() + str.length();
+}
+
+bool TableModel::lessThan(int column, int rowA, int rowB) const {
+    std::string a = text(rowA, column), b = text(rowB, column);
+    double va, vb;
+    if (parseNumber(a, va) && parseNumber(b, vb))
+        return va < vb;
+    return a < b;
+}
+
+bool TableModel::accept(int row, const std::string &filter) const {
+    for (int column = 0; column < columnCount(); ++column)
+        if (text(row, column).find(filter) != std::string::npos)
+            return true;
+    return false;
+}
+
+extern void __nanogui_post_empty_event();
+
+/**
+ * Worker thread that computes the sort/filter index of a table. Requests
+ * that arrive while it is busy replace each other, so only the most recent
+ * one is computed after the current one, which is cancelled as well.
+ */
+struct TableView::IndexTask {
+    /// Thrown by the sort comparator to abandon an outdated request
+    struct Cancelled { };
+
+    struct Request {
+        ref<TableModel> model;
+        int column;
+        bool ascending;
+        std::string filter;
+        int generation;
+    };
+
+    std::thread thread;
+    std::mutex mutex;
+    /// Signals a new request or the end of the worker
+    std::condition_variable wakeup;
+    /// Signals that the worker has finished a request
+    std::condition_variable finished;
+    /// Incremented for every request, which cancels all older ones
+    std::atomic<int> generation { 0 };
+    /* The following members are protected by \c mutex */
+    Request request;
+    bool requested = false, busy = false, stop = false;
+    /// Generation of the index stored in \c result
+    int readyGeneration = -1;
+    std::vector<int> result, resultInverse;
+
+    ~IndexTask() {
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            stop = true;
+            ++generation;
+        }
+        wakeup.notify_all();
+        if (thread.joinable())
+            thread.join();
+    }
+
+    /// Queue a request, replacing the pending one (if any), and start the worker if needed
+    void submit(Request r) {
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            request = std::move(r);
+            requested = true;
+        }
+        wakeup.notify_all();
+        if (!thread.joinable())
+            thread = std::thread([this]() { run(); });
+    }
+
+    /// Cancel all requests and wait until the worker no longer reads the model
+    void cancel() {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++generation;
+        requested = false;
+        request.model = nullptr;
+        finished.wait(lock, [this]() { return !busy; });
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wakeup.wait(lock, [this]() { return stop || requested; });
+            if (stop)
+                return;
+            Request r = std::move(request);
+            requested = false;
+            busy = true;
+            lock.unlock();
+
+            std::vector<int> index, inverse;
+            bool complete = compute(r, index, inverse);
+            r.model = nullptr;
+
+            lock.lock();
+            busy = false;
+            complete = complete && r.generation == generation;
+            if (complete) {
+                result.swap(index);
+                resultInverse.swap(inverse);
+                readyGeneration = r.generation;
+            }
+            finished.notify_all();
+
+            /* Wake up the main loop so that the result is shown right away */
+            if (complete) {
+                lock.unlock();
+                __nanogui_post_empty_event();
+                lock.lock();
+            }
+        }
+    }
+
+    /**
+     * Filter and sort the rows, or return \c false if the request was cancelled.
+     * \c inverse maps each model row to its position in \c index (or -1).
+     */
+    bool compute(const Request &r, std::vector<int> &index, std::vector<int> &inverse) {
+        auto cancelled = [&]() { return generation != r.generation; };
+        const TableModel *model = r.model.get();
+
+        int rowCount = model->rowCount();
+        index.reserve(rowCount);
+        for (int row = 0; row < rowCount; ++row) {
+            if ((row & 1023) == 0 && cancelled())
+                return false;
+            if (r.filter.empty() || model->accept(row, r.filter))
+                index.push_back(row);
+        }
+
+        if (r.column >= 0) {
+            /* A large sort can take a while, so the comparator checks for
+               newer requests every few comparisons */
+            size_t comparisons = 0;
+            try {
+                std::stable_sort(index.begin(), index.end(), [&](int a, int b) {
+                    if ((++comparisons & 1023) == 0 && cancelled())
+                        throw Cancelled();
+                    return r.ascending ? model->lessThan(r.column, a, b)
+                                       : model->lessThan(r.column, b, a);
+                });
+            } catch (const Cancelled &) {
+                return false;
+            }
+        }
+
+        inverse.assign(rowCount, -1);
+        for (size_t i = 0; i < index.size(); ++i)
+            inverse[index[i]] = (int) i;
+        return true;
+    }
+};
+
+TableView::TableView(Widget *parent)
+    : Widget(parent), mRowHeight(25), mHeaderHeight(25),
+      mDefaultColumnWidth(100), mColumnsDirty(true), mFixedRowCount(0),
+      mFixedColumnCount(0), mSortColumn(-1), mSortAscending(true),
+      mIndexed(false), mIndexPending(false), mIndexTask(new IndexTask()),
+      mSelectedRow(-1), mScrollX(0.0), mScrollY(0.0), mDragMode(0),
+      mLastClick(0.0), mEditor(nullptr), mEditRow(-1), mEditColumn(-1) { }
+
+TableView::~TableView() { }
+
+void TableView::setModel(TableModel *model) {
+    closeEditor(false);
+    mModel = model;
+    mSelectedRow = -1;
+    mScrollX = mScrollY = 0.0;
+    modelChanged();
+}
+
+void TableView::modelChanged() {
+    closeEditor(false);
+    mColumnsDirty = true;
+    if (mModel && mSelectedRow >= mModel->rowCount())
+        mSelectedRow = -1;
+    updateIndex();
+}
+
+void TableView::setDefaultColumnWidth(int width) {
+    mDefaultColumnWidth = std::max(width, 1);
+    mColumnsDirty = true;
+}
+
+int TableView::columnWidth(int column) const {
+    if (column >= 0 && column < (int) mColumnWidths.size() &&
+        mColumnWidths[column] > 0)
+        return mColumnWidths[column];
+    return mDefaultColumnWidth;
+}
+
+void TableView::setColumnWidth(int column, int width) {
+    if (column < 0)
+        return;
+    if (column >= (int) mColumnWidths.size())
+        mColumnWidths.resize(column + 1, 0);
+    mColumnWidths[column] = std::max(width, 1);
+    mColumnsDirty = true;
+}
+
+void TableView::setFixedColumnCount(int count) {
+    mFixedColumnCount = std::max(count, 0);
+}
+
+int TableView::fixedColumns() const {
+    return mModel ? std::min(mFixedColumnCount, mModel->columnCount()) : 0;
+}
+
+void TableView::sortByColumn(int column, bool ascending) {
+    mSortColumn = mModel ? std::min(column, mModel->columnCount() - 1) : column;
+    mSortAscending = ascending;
+    updateIndex();
+}
+
+void TableView::setFilter(const std::string &filter) {
+    if (filter == mFilter)
+        return;
+    mFilter = filter;
+    updateIndex();
+}
+
+void TableView::updateIndex() {
+    int generation = ++mIndexTask->generation;
+
+    if (!mModel || (mSortColumn < 0 && mFilter.empty())) {
+        /* Identity mapping, nothing to compute */
+        std::vector<int>().swap(mIndex);
+        std::vector<int>().swap(mInverseIndex);
+        mIndexed = false;
+        mIndexPending = false;
+        return;
+    }
+
+    mIndexPending = true;
+    mIndexTask->submit(IndexTask::Request { mModel, mSortColumn, mSortAscending,
+                                            mFilter, generation });
+}
+
+void TableView::fetchIndex() {
+    if (!mIndexPending)
+        return;
+    std::lock_guard<std::mutex> guard(mIndexTask->mutex);
+    if (mIndexTask->readyGeneration != mIndexTask->generation)
+        return;
+    mIndex.swap(mIndexTask->result);
+    mInverseIndex.swap(mIndexTask->resultInverse);
+    std::vector<int>().swap(mIndexTask->result);
+    std::vector<int>().swap(mIndexTask->resultInverse);
+    mIndexed = true;
+    mIndexPending = false;
+}
+
+int TableView::rowCount() const {
+    if (!mModel)
+        return 0;
+    return mIndexed ? (int) mIndex.size() : mModel->rowCount();
+}
+
+int TableView::modelRow(int viewRow) const {
+    if (viewRow < 0 || viewRow >= rowCount())
+        return -1;
+    return mIndexed ? mIndex[viewRow] : viewRow;
+}
+
+int TableView::viewRow(int modelRow) const {
+    if (!mModel || modelRow < 0)
+        return -1;
+    if (!mIndexed)
+        return modelRow < mModel->rowCount() ? modelRow : -1;
+    return modelRow < (int) mInverseIndex.size() ? mInverseIndex[modelRow] : -1;
+}
+
+void TableView::updateColumns() const {
+    int columns = mModel ? mModel->columnCount() : 0;
+    if (!mColumnsDirty && (int) mColumnOffsets.size() == columns + 1)
+        return;
+    mColumnOffsets.resize(columns + 1);
+    mColumnOffsets[0] = 0;
+    for (int i = 0; i < columns; ++i)
+        mColumnOffsets[i + 1] = mColumnOffsets[i] + columnWidth(i);
+    mColumnsDirty = false;
+}
+
+int TableView::columnAtOffset(int x) const {
+    updateColumns();
+    int columns = (int) mColumnOffsets.size() - 1;
+    if (columns <= 0)
+        return -1;
+    int column = (int) (std::upper_bound(mColumnOffsets.begin(),
+                                         mColumnOffsets.end(), x) -
+                        mColumnOffsets.begin()) - 1;
+    return std::max(0, std::min(columns - 1, column));
+}
+
+Vector2i TableView::viewSize() const {
+    double width = mModel ? columnOffset(mModel->columnCount()) : 0,
+           height = fixedHeight() + contentHeight();
+    bool vscroll = height > mSize.y();
+    bool hscroll = width > mSize.x() - (vscroll ? 12 : 0);
+    vscroll = height > mSize.y() - (hscroll ? 12 : 0);
+    return Vector2i(mSize.x() - (vscroll ? 12 : 0),
+                    mSize.y() - (hscroll ? 12 : 0));
+}
+
+double TableView::contentWidth() const {
+    if (!mModel)
+        return 0;
+    return columnOffset(mModel->columnCount()) - fixedWidth();
+}
+
+double TableView::scrollOffsetX() const {
+    return mScrollX * std::max(0.0, contentWidth() - (viewSize().x() - fixedWidth()));
+}
+
+double TableView::scrollOffsetY() const {
+    return mScrollY * std::max(0.0, contentHeight() - (viewSize().y() - fixedHeight()));
+}
+
+void TableView::scrollToRow(int viewRow) {
+    int fixed = fixedRows();
+    double range = contentHeight() - (viewSize().y() - fixedHeight());
+    if (viewRow < fixed || viewRow >= rowCount() || range <= 0)
+        return;
+    double offset = scrollOffsetY(),
+           top = (double) (viewRow - fixed) * mRowHeight,
+           bottom = top + mRowHeight,
+           height = viewSize().y() - fixedHeight();
+    if (top < offset)
+        offset = top;
+    else if (bottom > offset + height)
+        offset = bottom - height;
+    mScrollY = std::max(0.0, std::min(1.0, offset / range));
+}
+
+Vector2i TableView::cellAt(const Vector2i &p) const {
+    Vector2i d = p - mPos, view = viewSize();
+    if (!mModel || d.x() < 0 || d.y() < 0 || d.x() >= view.x() || d.y() >= view.y())
+        return Vector2i(-2, -2);
+
+    int fw = fixedWidth(), fh = fixedHeight();
+    double x = d.x() < fw ? d.x() : d.x() + scrollOffsetX();
+    if (x >= columnOffset(mModel->columnCount()))
+        return Vector2i(-2, -2);
+    int column = columnAtOffset((int) x);
+
+    int row;
+    if (d.y() < mHeaderHeight)
+        row = -1;
+    else if (d.y() < fh)
+        row = (d.y() - mHeaderHeight) / mRowHeight;
+    else
+        row = fixedRows() + (int) ((d.y() - fh + scrollOffsetY()) / mRowHeight);
+    if (row >= rowCount())
+        return Vector2i(-2, -2);
+
+    return Vector2i(row, column);
+}
+
+void TableView::editCell(int viewRow, int column) {
+    int row = modelRow(viewRow);
+    if (row < 0 || column < 0 || column >= mModel->columnCount() ||
+        !mModel->editable(row, column))
+        return;
+
+    closeEditor(true);
+    scrollToRow(viewRow);
+
+    if (!mEditor) {
+        mEditor = new TextBox(this);
+        mEditor->setEditable(true);
+        mEditor->setAlignment(TextBox::Alignment::Left);
+        mEditor->setCallback([this](const std::string &value) {
+            /* Invoked when the editor loses the focus. The model may only be
+               written while the worker does not read it. */
+            bool changed = false;
+            if (mEditRow >= 0 && mModel) {
+                mIndexTask->cancel();
+                changed = mModel->setText(mEditRow, mEditColumn, value);
+            }
+            mEditRow = mEditColumn = -1;
+            mEditor->setVisible(false);
+            if (changed)
+                modelChanged();
+            else if (mIndexPending)
+                updateIndex();
+            return true;
+        });
+    }
+
+    mEditRow = row;
+    mEditColumn = column;
+    mEditor->setValue(mModel->text(row, column));
+    mEditor->setVisible(true);
+    mEditor->requestFocus();
+}
+
+void TableView::closeEditor(bool commit) {
+    if (!mEditor || !mEditor->visible())
+        return;
+    if (commit && mEditor->focused()) {
+        /* Moving the focus away makes the editor invoke its callback */
+        requestFocus();
+    } else {
+        mEditRow = mEditColumn = -1;
+        mEditor->setVisible(false);
+    }
+}
+
+void TableView::performLayout(NVGcontext *) {
+    /* The cells are not widgets, and the editor is placed in draw() */
+}
+
+Vector2i TableView::preferredSize(NVGcontext *) const {
+    double width = (mModel ? columnOffset(mModel->columnCount()) : 0) + 12,
+           height = fixedHeight() + contentHeight() + 12;
+    double limit = (double) std::numeric_limits<int>::max();
+    return Vector2i((int) std::min(width, limit), (int) std::min(height, limit));
+}
+
+bool TableView::mouseButtonEvent(const Vector2i &p, int button, bool down,
+                                 int modifiers) {
+    if (Widget::mouseButtonEvent(p, button, down, modifiers))
+        return true;
+
+    if (button != GLFW_MOUSE_BUTTON_1)
+        return false;
+    if (!down) {
+        mDragMode = 0;
+        return true;
+    }
+
+    Vector2i d = p - mPos, view = viewSize();
+    if (d.x() >= view.x() && d.y() < view.y()) {
+        mDragMode = 1;
+        return true;
+    } else if (d.y() >= view.y() && d.x() < view.x()) {
+        mDragMode = 2;
+        return true;
+    }
+
+    Vector2i cell = cellAt(p);
+    if (cell.y() < 0)
+        return true;
+
+    if (cell.x() == -1) {
+        if (cell.y() == mSortColumn)
+            sortByColumn(cell.y(), !mSortAscending);
+        else
+            sortByColumn(cell.y(), true);
+        return true;
+    }
+
+    int row = modelRow(cell.x());
+    double time = glfwGetTime();
+    if (row == mSelectedRow && time - mLastClick < 0.25) {
+        editCell(cell.x(), cell.y());
+    } else if (row != mSelectedRow) {
+        mSelectedRow = row;
+        if (mCallback)
+            mCallback(row);
+    }
+    mLastClick = time;
+    return true;
+}
+
+bool TableView::mouseDragEvent(const Vector2i &p, const Vector2i &rel,
+                               int button, int modifiers) {
+    Vector2i view = viewSize();
+    if (mDragMode == 1) {
+        double height = view.y() - fixedHeight(), content = contentHeight();
+        float scrollh = std::max(20.0f, (float) (height *
+            std::min(1.0, height / content)));
+        mScrollY = std::max(0.0, std::min(1.0,
+            mScrollY + rel.y() / (double) (height - 8 - scrollh)));
+        return true;
+    } else if (mDragMode == 2) {
+        double width = view.x() - fixedWidth(), content = contentWidth();
+        float scrollw = std::max(20.0f, (float) (width *
+            std::min(1.0, width / content)));
+        mScrollX = std::max(0.0, std::min(1.0,
+            mScrollX + rel.x() / (double) (width - 8 - scrollw)));
+        return true;
+    }
+    return Widget::mouseDragEvent(p, rel, button, modifiers);
+}
+
+bool TableView::scrollEvent(const Vector2i &p, const Vector2f &rel) {
+    Vector2i view = viewSize();
+    double rangeX = contentWidth() - (view.x() - fixedWidth()),
+           rangeY = contentHeight() - (view.y() - fixedHeight());
+    if (rangeX <= 0 && rangeY <= 0)
+        return Widget::scrollEvent(p, rel);
+
+    closeEditor(true);
+    if (rangeY > 0)
+        mScrollY = std::max(0.0, std::min(1.0,
+            (scrollOffsetY() - rel.y() * 3 * mRowHeight) / rangeY));
+    if (rangeX > 0)
+        mScrollX = std::max(0.0, std::min(1.0,
+            (scrollOffsetX() - rel.x() * 3 * mRowHeight) / rangeX));
+    return true;
+}
+
+bool TableView::keyboardEvent(int key, int scancode, int action, int modifiers) {
+    if (!mFocused || rowCount() == 0 ||
+        (action != GLFW_PRESS && action != GLFW_REPEAT))
+        return Widget::keyboardEvent(key, scancode, action, modifiers);
+
+    int page = std::max(1, (viewSize().y() - fixedHeight()) / mRowHeight),
+        index = viewRow(mSelectedRow);
+    switch (key) {
+        case GLFW_KEY_UP:        index -= 1; break;
+        case GLFW_KEY_DOWN:      index += 1; break;
+        case GLFW_KEY_PAGE_UP:   index -= page; break;
+        case GLFW_KEY_PAGE_DOWN: index += page; break;
+        case GLFW_KEY_HOME:      index = 0; break;
+        case GLFW_KEY_END:       index = rowCount() - 1; break;
+        default:
+            return Widget::keyboardEvent(key, scancode, action, modifiers);
+    }
+
+    index = std::max(0, std::min(rowCount() - 1, index));
+    int row = modelRow(index);
+    if (row != mSelectedRow) {
+        mSelectedRow = row;
+        scrollToRow(index);
+        if (mCallback)
+            mCallback(row);
+    }
+    return true;
+}
+
+void TableView::drawHeader(NVGcontext *ctx, int c0, int c1, float x) {
+    if (mHeaderHeight == 0 || c0 >= c1)
+        return;
+
+    float y = mPos.y(), h = mHeaderHeight;
+    nvgFontSize(ctx, fontSize());
+    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+
+    for (int c = c0; c < c1; ++c) {
+        float cx = x + columnOffset(c) - columnOffset(c0), cw = columnWidth(c);
+
+        NVGpaint bg = nvgLinearGradient(ctx, cx, y, cx, y + h,
+                                        mTheme->mButtonGradientTopUnfocused,
+                                        mTheme->mButtonGradientBotUnfocused);
+        nvgBeginPath(ctx);
+        nvgRect(ctx, cx, y, cw, h);
+        nvgFillPaint(ctx, bg);
+        nvgFill(ctx);
+
+        nvgBeginPath(ctx);
+        nvgMoveTo(ctx, cx + cw - 0.5f, y);
+        nvgLineTo(ctx, cx + cw - 0.5f, y + h);
+        nvgMoveTo(ctx, cx, y + h - 0.5f);
+        nvgLineTo(ctx, cx + cw, y + h - 0.5f);
+        nvgStrokeColor(ctx, mTheme->mBorderDark);
+        nvgStroke(ctx);
+
+        float iw = 0;
+        if (c == mSortColumn) {
+            auto icon = utf8(mSortAscending ? mTheme->mTextBoxUpIcon
+                                            : mTheme->mTextBoxDownIcon);
+            nvgFontFace(ctx, "icons");
+            nvgFontSize(ctx, fontSize() * icon_scale());
+            iw = nvgTextBounds(ctx, 0, 0, icon.data(), nullptr, nullptr);
+            nvgFillColor(ctx, mTheme->mIconColor);
+            nvgText(ctx, cx + cw - iw - 5, y + h * 0.5f, icon.data(), nullptr);
+            nvgFontSize(ctx, fontSize());
+            iw += 5;
+        }
+
+        nvgSave(ctx);
+        nvgIntersectScissor(ctx, cx, y, std::max(0.f, cw - iw - 4), h);
+        nvgFontFace(ctx, "sans-bold");
+        nvgFillColor(ctx, mTheme->mTextColor);
+        nvgText(ctx, cx + 5, y + h * 0.5f, mModel->headerText(c).c_str(), nullptr);
+        nvgRestore(ctx);
+    }
+}
+
+void TableView::drawCells(NVGcontext *ctx, int r0, int r1, float y, int c0,
+                          int c1, float x) {
+    if (r0 >= r1 || c0 >= c1)
+        return;
+
+    float width = columnOffset(c1) - columnOffset(c0),
+          height = (float) (r1 - r0) * mRowHeight;
+
+    for (int r = r0; r < r1; ++r) {
+        if (mSelectedRow < 0 || modelRow(r) != mSelectedRow)
+            continue;
+        nvgBeginPath(ctx);
+        nvgRect(ctx, x, y + (r - r0) * mRowHeight, width, mRowHeight);
+        nvgFillColor(ctx, mTheme->mButtonGradientTopFocused);
+        nvgFill(ctx);
+    }
+
+    nvgBeginPath(ctx);
+    for (int c = c0 + 1; c <= c1; ++c) {
+        float cx = x + columnOffset(c) - columnOffset(c0) - 0.5f;
+        nvgMoveTo(ctx, cx, y);
+        nvgLineTo(ctx, cx, y + height);
+    }
+    nvgStrokeColor(ctx, mTheme->mBorderMedium);
+    nvgStroke(ctx);
+
+    nvgFontSize(ctx, fontSize());
+    nvgFontFace(ctx, "sans");
+    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+    nvgFillColor(ctx, mEnabled ? mTheme->mTextColor : mTheme->mDisabledTextColor);
+
+    int rows = mModel->rowCount();
+    for (int c = c0; c < c1; ++c) {
+        float cx = x + columnOffset(c) - columnOffset(c0), cw = columnWidth(c);
+        nvgSave(ctx);
+        nvgIntersectScissor(ctx, cx, y, std::max(0.f, cw - 4), height);
+        for (int r = r0; r < r1; ++r) {
+            int row = modelRow(r);
+            if (row < 0 || row >= rows || (row == mEditRow && c == mEditColumn))
+                continue;
+            nvgText(ctx, cx + 5, y + (r - r0 + 0.5f) * mRowHeight,
+                    mModel->text(row, c).c_str(), nullptr);
+        }
+        nvgRestore(ctx);
+    }
+}
+
+void TableView::drawScrollBars(NVGcontext *ctx) {
+    Vector2i view = viewSize();
+    int fw = fixedWidth(), fh = fixedHeight();
+
+    auto drawBar = [&](float x, float y, float w, float h, float pos,
+                       float length, bool vertical) {
+        NVGpaint paint = nvgBoxGradient(ctx, x + 1, y + 1, w, h, 3, 4,
+                                        Color(0, 32), Color(0, 92));
+        nvgBeginPath(ctx);
+        nvgRoundedRect(ctx, x, y, w, h, 3);
+        nvgFillPaint(ctx, paint);
+        nvgFill(ctx);
+
+        float tx = vertical ? x : x + pos, ty = vertical ? y + pos : y,
+              tw = vertical ? w : length, th = vertical ? length : h;
+        paint = nvgBoxGradient(ctx, tx - 1, ty - 1, tw, th, 3, 4,
+                               Color(220, 100), Color(128, 100));
+        nvgBeginPath(ctx);
+        nvgRoundedRect(ctx, tx + 1, ty + 1, tw - 2, th - 2, 2);
+        nvgFillPaint(ctx, paint);
+        nvgFill(ctx);
+    };
+
+    if (view.x() < mSize.x()) {
+        float height = view.y() - fh;
+        float scrollh = std::max(20.0f, (float) (height *
+            std::min(1.0, height / contentHeight())));
+        drawBar(mPos.x() + mSize.x() - 12, mPos.y() + fh + 4, 8, height - 8,
+                (height - 8 - scrollh) * (float) mScrollY, scrollh, true);
+    }
+
+    if (view.y() < mSize.y()) {
+        float width = view.x() - fw;
+        float scrollw = std::max(20.0f, (float) (width *
+            std::min(1.0, width / contentWidth())));
+        drawBar(mPos.x() + fw + 4, mPos.y() + mSize.y() - 12, width - 8, 8,
+                (width - 8 - scrollw) * (float) mScrollX, scrollw, false);
+    }
+}
+
+void TableView::draw(NVGcontext *ctx) {
+    fetchIndex();
+
+    if (!mModel) {
+        Widget::draw(ctx);
+        return;
+    }
+
+    Vector2i view = viewSize();
+    int fw = fixedWidth(), fh = fixedHeight(), fixedR = fixedRows(),
+        fixedC = fixedColumns(), columns = mModel->columnCount(),
+        rows = rowCount();
+    double offX = scrollOffsetX(), offY = scrollOffsetY();
+
+    /* Visible range of the scrolling rows and columns */
+    int r0 = fixedR + (int) (offY / mRowHeight),
+        r1 = std::min(rows, fixedR + (int) std::ceil(
+                 (offY + view.y() - fh) / mRowHeight));
+    int c0 = std::max(fixedC, columnAtOffset((int) (fw + offX))),
+        c1 = columns == 0 ? 0 : columnAtOffset((int) (offX + view.x() - 1)) + 1;
+    float y0 = (float) (mPos.y() + fh + (double) (r0 - fixedR) * mRowHeight - offY),
+          x0 = (float) (mPos.x() + columnOffset(c0) - offX);
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x(), mPos.y(), view.x(), view.y());
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x() + fw, mPos.y() + fh, view.x() - fw, view.y() - fh);
+    drawCells(ctx, r0, r1, y0, c0, c1, x0);
+    nvgRestore(ctx);
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x(), mPos.y() + fh, fw, view.y() - fh);
+    drawCells(ctx, r0, r1, y0, 0, fixedC, mPos.x());
+    nvgRestore(ctx);
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x() + fw, mPos.y() + mHeaderHeight, view.x() - fw, fh - mHeaderHeight);
+    drawCells(ctx, 0, fixedR, mPos.y() + mHeaderHeight, c0, c1, x0);
+    nvgRestore(ctx);
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x() + fw, mPos.y(), view.x() - fw, mHeaderHeight);
+    drawHeader(ctx, c0, c1, x0);
+    nvgRestore(ctx);
+
+    drawCells(ctx, 0, fixedR, mPos.y() + mHeaderHeight, 0, fixedC, mPos.x());
+    drawHeader(ctx, 0, fixedC, mPos.x());
+
+    /* Separate the non-scrolling rows and columns from the rest */
+    if (fixedR > 0 || fixedC > 0) {
+        nvgBeginPath(ctx);
+        if (fixedR > 0) {
+            nvgMoveTo(ctx, mPos.x(), mPos.y() + fh - 0.5f);
+            nvgLineTo(ctx, mPos.x() + view.x(), mPos.y() + fh - 0.5f);
+        }
+        if (fixedC > 0) {
+            nvgMoveTo(ctx, mPos.x() + fw - 0.5f, mPos.y());
+            nvgLineTo(ctx, mPos.x() + fw - 0.5f, mPos.y() + view.y());
+        }
+        nvgStrokeColor(ctx, mTheme->mBorderLight);
+        nvgStroke(ctx);
+    }
+
+    /* Place the editor on top of the cell that is being edited */
+    if (mEditor && mEditor->visible()) {
+        int r = viewRow(mEditRow);
+        if (r < 0) {
+            closeEditor(false);
+        } else {
+            double ey = r < fixedR ? mHeaderHeight + r * mRowHeight
+                                   : fh + (double) (r - fixedR) * mRowHeight - offY;
+            double ex = columnOffset(mEditColumn) - (mEditColumn < fixedC ? 0 : offX);
+            mEditor->setPosition(Vector2i((int) ex, (int) ey));
+            mEditor->setSize(Vector2i(columnWidth(mEditColumn), mRowHeight));
+        }
+    }
+
+    Widget::draw(ctx);
+    nvgRestore(ctx);
+
+    drawScrollBars(ctx);
+}
+
+void TableView::save(Serializer &s) const {
+    Widget::save(s);
+    s.set("rowHeight", mRowHeight);
+    s.set("headerHeight", mHeaderHeight);
+    s.set("defaultColumnWidth", mDefaultColumnWidth);
+    s.set("columnWidths", mColumnWidths);
+    s.set("fixedRowCount", mFixedRowCount);
+    s.set("fixedColumnCount", mFixedColumnCount);
+    s.set("sortColumn", mSortColumn);
+    s.set("sortAscending", mSortAscending);
+    s.set("filter", mFilter);
+    s.set("selectedRow", mSelectedRow);
+    s.set("scrollX", mScrollX);
+    s.set("scrollY", mScrollY);
+}
+
+bool TableView::load(Serializer &s) {
+    if (!Widget::load(s)) return false;
+    if (!s.get("rowHeight", mRowHeight)) return false;
+    if (!s.get("headerHeight", mHeaderHeight)) return false;
+    if (!s.get("defaultColumnWidth", mDefaultColumnWidth)) return false;
+    if (!s.get("columnWidths", mColumnWidths)) return false;
+    if (!s.get("fixedRowCount", mFixedRowCount)) return false;
+    if (!s.get("fixedColumnCount", mFixedColumnCount)) return false;
+    if (!s.get("sortColumn", mSortColumn)) return false;
+    if (!s.get("sortAscending", mSortAscending)) return false;
+    if (!s.get("filter", mFilter)) return false;
+    if (!s.get("selectedRow", mSelectedRow)) return false;
+    if (!s.get("scrollX", mScrollX)) return false;
+    if (!s.get("scrollY", mScrollY)) return false;
+    mColumnsDirty = true;
+    updateIndex();
+    return true;
+}
+
+NAMESPACE_END(nanogui)
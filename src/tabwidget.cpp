@@ -147,7 +147,7 @@ const std::string &TabWidget::tabLabelAt(int index) const {
 }
 
 void TabWidget::performLayout(NVGcontext* ctx) {
-    int headerHeight = mHeader->preferredSize(ctx).y();
+    int headerHeight = mHeader->cachedPreferredSize(ctx).y();
     int margin = mTheme->mTabInnerMargin;
     mHeader->setPosition({ 0, 0 });
     mHeader->setSize({ mSize.x(), headerHeight });
@@ -158,8 +158,8 @@ void TabWidget::performLayout(NVGcontext* ctx) {
 }
 
 Vector2i TabWidget::preferredSize(NVGcontext* ctx) const {
-    auto contentSize = mContent->preferredSize(ctx);
-    auto headerSize = mHeader->preferredSize(ctx);
+    auto contentSize = mContent->cachedPreferredSize(ctx);
+    auto headerSize = mHeader->cachedPreferredSize(ctx);
     int margin = mTheme->mTabInnerMargin;
     auto borderSize = Vector2i(2 * margin, 2 * margin);
     Vector2i tabPreferredSize = contentSize + borderSize + Vector2i(0, headerSize.y());
@@ -167,7 +167,7 @@ Vector2i TabWidget::preferredSize(NVGcontext* ctx) const {
 }
 
 void TabWidget::draw(NVGcontext* ctx) {
-    int tabHeight = mHeader->preferredSize(ctx).y();
+    int tabHeight = mHeader->cachedPreferredSize(ctx).y();
     auto activeArea = mHeader->activeButtonArea();
 
 
@@ -0,0 +1,730 @@
+/*
+    src/textarea.cpp -- Multi-line text editor for large documents,
+    backed by a piece table with a line index
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/textarea.h>
+#include <nanogui/screen.h>
+#include <nanogui/theme.h>
+#include <nanogui/opengl.h>
+#include <nanogui/serializer/core.h>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+NAMESPACE_BEGIN(nanogui)
+
+namespace {
+    /// Space between the border and the text
+    constexpr int padding = 4;
+
+    /// The cache of line layouts is trimmed to the lines around the view when it exceeds this size
+    constexpr size_t maxLineLayouts = 2048;
+
+    /// Edits are compacted into a single piece when the piece table exceeds this size
+    constexpr size_t maxPieces = 8192;
+
+    int sansFont() {
+        static int font = TextMetrics::findFont("sans");
+        return font;
+    }
+
+    bool isWordCharacter(char c) {
+        return std::isalnum((unsigned char) c) || c == '_' || (unsigned char) c >= 0x80;
+    }
+}
+
+TextBuffer::TextBuffer(const std::string &text) {
+    setText(text);
+}
+
+void TextBuffer::setText(const std::string &text) {
+    mOriginal = text;
+    mAdded.clear();
+    mOriginalNewlines.clear();
+    mAddedNewlines.clear();
+    for (size_t i = 0; i < mOriginal.size(); ++i)
+        if (mOriginal[i] == '\n')
+            mOriginalNewlines.push_back(i);
+    mPieces.clear();
+    if (!mOriginal.empty())
+        mPieces.push_back({ false, 0, mOriginal.size() });
+    update(0);
+}
+
+std::string TextBuffer::text(size_t pos, size_t length) const {
+    std::string result;
+    if (pos >= mSize)
+        return result;
+    length = std::min(length, mSize - pos);
+    result.reserve(length);
+    for (size_t i = findPiece(pos); i < mPieces.size() && length > 0; ++i) {
+        const Piece &piece = mPieces[i];
+        size_t offset = pos - mOffsets[i], count = std::min(length, piece.length - offset);
+        result.append(source(piece), piece.start + offset, count);
+        pos += count;
+        length -= count;
+    }
+    return result;
+}
+
+size_t TextBuffer::lineStart(size_t line) const {
+    if (line == 0)
+        return 0;
+    if (line > mNewlines)
+        return mSize;
+
+    /* The piece containing the newline with index 'line - 1' */
+    size_t index = line - 1;
+    size_t i = (size_t) (std::upper_bound(mLines.begin(), mLines.end(), index) - mLines.begin()) - 1;
+    const Piece &piece = mPieces[i];
+    const std::vector<size_t> &nl = newlines(piece);
+    size_t first = (size_t) (std::lower_bound(nl.begin(), nl.end(), piece.start) - nl.begin());
+    return mOffsets[i] + (nl[first + index - mLines[i]] - piece.start) + 1;
+}
+
+size_t TextBuffer::lineEnd(size_t line) const {
+    return line >= mNewlines ? mSize : lineStart(line + 1) - 1;
+}
+
+std::string TextBuffer::line(size_t line) const {
+    size_t start = lineStart(line);
+    return text(start, lineEnd(line) - start);
+}
+
+size_t TextBuffer::lineOf(size_t pos) const {
+    if (mPieces.empty())
+        return 0;
+    pos = std::min(pos, mSize);
+    size_t i = findPiece(pos);
+    return mLines[i] + countNewlines(mPieces[i], pos - mOffsets[i]);
+}
+
+void TextBuffer::insert(size_t pos, const std::string &text) {
+    if (text.empty())
+        return;
+    pos = std::min(pos, mSize);
+
+    size_t start = mAdded.size();
+    for (size_t i = 0; i < text.size(); ++i)
+        if (text[i] == '\n')
+            mAddedNewlines.push_back(start + i);
+    mAdded += text;
+
+    size_t i = pos == mSize ? mPieces.size() : findPiece(pos);
+    bool boundary = i == mPieces.size() || mOffsets[i] == pos;
+
+    /* Typing continues the piece that ends at the insertion point */
+    if (boundary && i > 0) {
+        Piece &previous = mPieces[i - 1];
+        if (previous.added && previous.start + previous.length == start) {
+            previous.length += text.size();
+            update(i - 1);
+            return;
+        }
+    }
+
+    Piece piece { true, start, text.size() };
+    if (boundary) {
+        mPieces.insert(mPieces.begin() + i, piece);
+    } else {
+        Piece left = mPieces[i], right = mPieces[i];
+        left.length = pos - mOffsets[i];
+        right.start += left.length;
+        right.length -= left.length;
+        mPieces[i] = left;
+        mPieces.insert(mPieces.begin() + i + 1, { piece, right });
+    }
+
+    update(i);
+    if (mPieces.size() > maxPieces)
+        setText(this->text());
+}
+
+void TextBuffer::erase(size_t pos, size_t length) {
+    if (pos >= mSize)
+        return;
+    length = std::min(length, mSize - pos);
+    if (length == 0)
+        return;
+
+    size_t end = pos + length, first = findPiece(pos), last = first;
+    std::vector<Piece> remainder;
+    for (; last < mPieces.size() && mOffsets[last] < end; ++last) {
+        const Piece &piece = mPieces[last];
+        size_t pieceStart = mOffsets[last], pieceEnd = pieceStart + piece.length;
+        if (pieceStart < pos)
+            remainder.push_back({ piece.added, piece.start, pos - pieceStart });
+        if (pieceEnd > end)
+            remainder.push_back({ piece.added, piece.start + (end - pieceStart), pieceEnd - end });
+    }
+    mPieces.erase(mPieces.begin() + first, mPieces.begin() + last);
+    mPieces.insert(mPieces.begin() + first, remainder.begin(), remainder.end());
+    update(first);
+}
+
+size_t TextBuffer::countNewlines(const Piece &piece, size_t length) const {
+    const std::vector<size_t> &nl = newlines(piece);
+    return (size_t) (std::lower_bound(nl.begin(), nl.end(), piece.start + length) -
+                     std::lower_bound(nl.begin(), nl.end(), piece.start));
+}
+
+size_t TextBuffer::findPiece(size_t pos) const {
+    return (size_t) (std::upper_bound(mOffsets.begin(), mOffsets.end(), pos) - mOffsets.begin()) - 1;
+}
+
+void TextBuffer::update(size_t first) {
+    mOffsets.resize(mPieces.size());
+    mLines.resize(mPieces.size());
+    size_t offset = 0, lines = 0;
+    if (first > 0 && first <= mPieces.size()) {
+        offset = mOffsets[first - 1] + mPieces[first - 1].length;
+        lines = mLines[first - 1] + countNewlines(mPieces[first - 1], mPieces[first - 1].length);
+    } else {
+        first = 0;
+    }
+    for (size_t i = first; i < mPieces.size(); ++i) {
+        mOffsets[i] = offset;
+        mLines[i] = lines;
+        offset += mPieces[i].length;
+        lines += countNewlines(mPieces[i], mPieces[i].length);
+    }
+    mSize = offset;
+    mNewlines = lines;
+}
+
+TextArea::TextArea(Widget *parent, const std::string &value)
+    : Widget(parent), mBuffer(value), mEditable(true), mCursorPos(0),
+      mSelection(std::string::npos), mPreferredX(-1.f), mScrollY(0.0),
+      mScrollX(0.f), mDragScrollbar(false), mLastClick(0.0),
+      mLayoutFontSize(0.f), mLayoutPixelRatio(0.f) {
+    setCursor(Cursor::IBeam);
+}
+
+void TextArea::setValue(const std::string &value) {
+    mBuffer.setText(value);
+    mLineLayouts.clear();
+    mCursorPos = 0;
+    mSelection = std::string::npos;
+    mPreferredX = -1.f;
+    mScrollY = 0.0;
+    mScrollX = 0.f;
+}
+
+void TextArea::setEditable(bool editable) {
+    mEditable = editable;
+    setCursor(editable ? Cursor::IBeam : Cursor::Arrow);
+}
+
+void TextArea::setCursorPosition(size_t position) {
+    mSelection = std::string::npos;
+    mCursorPos = std::min(position, mBuffer.size());
+    mPreferredX = -1.f;
+}
+
+void TextArea::select(size_t start, size_t end) {
+    mSelection = std::min(start, mBuffer.size());
+    mCursorPos = std::min(end, mBuffer.size());
+    mPreferredX = -1.f;
+}
+
+std::string TextArea::selectedText() const {
+    if (mSelection == std::string::npos)
+        return "";
+    size_t begin = std::min(mSelection, mCursorPos), end = std::max(mSelection, mCursorPos);
+    return mBuffer.text(begin, end - begin);
+}
+
+void TextArea::insert(const std::string &text) {
+    if (mSelection != std::string::npos)
+        replace(std::min(mSelection, mCursorPos), std::max(mSelection, mCursorPos), text);
+    else
+        replace(mCursorPos, mCursorPos, text);
+}
+
+void TextArea::append(const std::string &text) {
+    size_t line = mBuffer.lineCount() - 1;
+    mBuffer.insert(mBuffer.size(), text);
+    invalidateLines(line, text.find('\n') != std::string::npos);
+}
+
+int TextArea::lineHeight() const {
+    float height = 0.f;
+    TextMetrics::verticalMetrics(sansFont(), (float) fontSize(), nullptr, nullptr, &height,
+                                 pixelRatio());
+    return std::max(1, (int) std::ceil(height));
+}
+
+void TextArea::scrollToCursor() {
+    size_t line = mBuffer.lineOf(mCursorPos);
+    scrollToLine(line);
+
+    float x = offsetToX(lineLayout(line), mCursorPos - mBuffer.lineStart(line));
+    int width = viewWidth();
+    if (x < mScrollX)
+        mScrollX = std::max(0.f, x - width * 0.25f);
+    else if (x > mScrollX + width - 1)
+        mScrollX = x - width * 0.75f;
+}
+
+void TextArea::scrollToLine(size_t line) {
+    int lineh = lineHeight(), height = mSize.y() - 2 * padding;
+    double top = (double) line * lineh;
+    if (top < mScrollY)
+        mScrollY = top;
+    else if (top + lineh > mScrollY + height)
+        mScrollY = top + lineh - height;
+    mScrollY = std::max(0.0, std::min(mScrollY, contentHeight() - height));
+}
+
+size_t TextArea::positionAt(const Vector2i &p) const {
+    double y = p.y() - mPos.y() - padding + mScrollY;
+    size_t line = y <= 0 ? 0 : std::min(mBuffer.lineCount() - 1, (size_t) (y / lineHeight()));
+    float x = p.x() - mPos.x() - padding + mScrollX;
+    return mBuffer.lineStart(line) + xToOffset(lineLayout(line), x);
+}
+
+Vector2i TextArea::preferredSize(NVGcontext *) const {
+    return Vector2i(fontSize() * 20, lineHeight() * 10 + 2 * padding);
+}
+
+bool TextArea::mouseButtonEvent(const Vector2i &p, int button, bool down,
+                                int modifiers) {
+    if (Widget::mouseButtonEvent(p, button, down, modifiers))
+        return true;
+
+    if (button != GLFW_MOUSE_BUTTON_1)
+        return false;
+
+    if (!down) {
+        mDragScrollbar = false;
+        return true;
+    }
+
+    mDragScrollbar = contentHeight() > mSize.y() - 2 * padding &&
+                     p.x() >= mPos.x() + mSize.x() - 12;
+    if (mDragScrollbar)
+        return true;
+
+    size_t pos = positionAt(p);
+    double time = glfwGetTime();
+    if (time - mLastClick < 0.25 && pos == mCursorPos) {
+        /* Double-click: select the word under the cursor */
+        size_t line = mBuffer.lineOf(pos), start = mBuffer.lineStart(line);
+        const std::string &text = lineLayout(line).text;
+        size_t begin = pos - start, end = begin;
+        while (begin > 0 && isWordCharacter(text[begin - 1]))
+            --begin;
+        while (end < text.size() && isWordCharacter(text[end]))
+            ++end;
+        select(start + begin, start + end);
+    } else {
+        moveCursor(pos, (modifiers & GLFW_MOD_SHIFT) != 0);
+        mPreferredX = -1.f;
+    }
+    mLastClick = time;
+    return true;
+}
+
+bool TextArea::mouseDragEvent(const Vector2i &p, const Vector2i &rel, int, int) {
+    if (mDragScrollbar) {
+        int height = mSize.y() - 2 * padding;
+        double range = contentHeight() - height;
+        float scrollh = std::max(20.0f, (float) (mSize.y() *
+            std::min(1.0, height / contentHeight())));
+        mScrollY = std::max(0.0, std::min(range,
+            mScrollY + rel.y() * range / (mSize.y() - 8 - scrollh)));
+        return true;
+    }
+
+    moveCursor(positionAt(p), true);
+    mPreferredX = -1.f;
+    return true;
+}
+
+bool TextArea::scrollEvent(const Vector2i &p, const Vector2f &rel) {
+    int lineh = lineHeight(), height = mSize.y() - 2 * padding;
+    double range = contentHeight() - height;
+
+    /* Only the lines that are visible limit horizontal scrolling */
+    float width = 0.f;
+    size_t first = (size_t) (mScrollY / lineh),
+           last = std::min(mBuffer.lineCount(), (size_t) std::ceil((mScrollY + height) / lineh));
+    for (size_t line = first; line < last; ++line)
+        width = std::max(width, lineLayout(line).width);
+    float rangeX = width - viewWidth() + 1;
+
+    if (range <= 0 && rangeX <= 0 && mScrollX == 0)
+        return Widget::scrollEvent(p, rel);
+
+    if (range > 0)
+        mScrollY = std::max(0.0, std::min(range, mScrollY - rel.y() * 3 * lineh));
+    mScrollX = std::max(0.f, std::min(std::max(rangeX, 0.f), mScrollX - rel.x() * 3 * lineh));
+    return true;
+}
+
+bool TextArea::keyboardEvent(int key, int scancode, int action, int modifiers) {
+    if (!mFocused || (action != GLFW_PRESS && action != GLFW_REPEAT))
+        return Widget::keyboardEvent(key, scancode, action, modifiers);
+
+    bool shift = (modifiers & GLFW_MOD_SHIFT) != 0,
+         command = (modifiers & SYSTEM_COMMAND_MOD) != 0,
+         selection = mSelection != std::string::npos && mSelection != mCursorPos;
+    size_t begin = std::min(mSelection, mCursorPos), end = std::max(mSelection, mCursorPos);
+    size_t line = mBuffer.lineOf(mCursorPos);
+    long page = std::max(1, (mSize.y() - 2 * padding) / lineHeight()), lines = 0;
+
+    switch (key) {
+        case GLFW_KEY_LEFT:
+            moveCursor(selection && !shift ? begin : previousCharacter(mCursorPos), shift);
+            mPreferredX = -1.f;
+            break;
+        case GLFW_KEY_RIGHT:
+            moveCursor(selection && !shift ? end : nextCharacter(mCursorPos), shift);
+            mPreferredX = -1.f;
+            break;
+        case GLFW_KEY_UP:        lines = -1; break;
+        case GLFW_KEY_DOWN:      lines = 1; break;
+        case GLFW_KEY_PAGE_UP:   lines = -page; break;
+        case GLFW_KEY_PAGE_DOWN: lines = page; break;
+        case GLFW_KEY_HOME:
+            moveCursor(command ? 0 : mBuffer.lineStart(line), shift);
+            mPreferredX = -1.f;
+            break;
+        case GLFW_KEY_END:
+            moveCursor(command ? mBuffer.size() : mBuffer.lineEnd(line), shift);
+            mPreferredX = -1.f;
+            break;
+        case GLFW_KEY_BACKSPACE:
+            if (mEditable && selection)
+                replace(begin, end, "");
+            else if (mEditable && mCursorPos > 0)
+                replace(previousCharacter(mCursorPos), mCursorPos, "");
+            break;
+        case GLFW_KEY_DELETE:
+            if (mEditable && selection)
+                replace(begin, end, "");
+            else if (mEditable && mCursorPos < mBuffer.size())
+                replace(mCursorPos, nextCharacter(mCursorPos), "");
+            break;
+        case GLFW_KEY_ENTER:
+        case GLFW_KEY_KP_ENTER:
+            if (mEditable)
+                insert("\n");
+            break;
+        case GLFW_KEY_TAB:
+            if (!mEditable)
+                return Widget::keyboardEvent(key, scancode, action, modifiers);
+            insert("    ");
+            break;
+        case GLFW_KEY_A:
+            if (modifiers != SYSTEM_COMMAND_MOD)
+                return Widget::keyboardEvent(key, scancode, action, modifiers);
+            select(0, mBuffer.size());
+            break;
+        case GLFW_KEY_C:
+            if (modifiers != SYSTEM_COMMAND_MOD)
+                return Widget::keyboardEvent(key, scancode, action, modifiers);
+            copySelection();
+            break;
+        case GLFW_KEY_X:
+            if (modifiers != SYSTEM_COMMAND_MOD)
+                return Widget::keyboardEvent(key, scancode, action, modifiers);
+            if (copySelection() && mEditable)
+                replace(begin, end, "");
+            break;
+        case GLFW_KEY_V:
+            if (modifiers != SYSTEM_COMMAND_MOD)
+                return Widget::keyboardEvent(key, scancode, action, modifiers);
+            if (mEditable)
+                pasteFromClipboard();
+            break;
+        default:
+            return Widget::keyboardEvent(key, scancode, action, modifiers);
+    }
+
+    if (lines != 0) {
+        /* Vertical movement keeps the horizontal position of the cursor */
+        if (mPreferredX < 0)
+            mPreferredX = offsetToX(lineLayout(line), mCursorPos - mBuffer.lineStart(line));
+        long target = std::max(0l, std::min((long) mBuffer.lineCount() - 1, (long) line + lines));
+        float preferredX = mPreferredX;
+        moveCursor(mBuffer.lineStart((size_t) target) +
+                   xToOffset(lineLayout((size_t) target), preferredX), shift);
+        mPreferredX = preferredX;
+    }
+    return true;
+}
+
+bool TextArea::keyboardCharacterEvent(unsigned int codepoint) {
+    if (!mFocused || !mEditable)
+        return false;
+    insert(utf8((int) codepoint).data());
+    return true;
+}
+
+void TextArea::draw(NVGcontext *ctx) {
+    Widget::draw(ctx);
+
+    NVGpaint bg = nvgBoxGradient(ctx,
+        mPos.x() + 1, mPos.y() + 1 + 1.0f, mSize.x() - 2, mSize.y() - 2,
+        3, 4, Color(255, 32), Color(32, 32));
+    NVGpaint fg = nvgBoxGradient(ctx,
+        mPos.x() + 1, mPos.y() + 1 + 1.0f, mSize.x() - 2, mSize.y() - 2,
+        3, 4, Color(150, 32), Color(32, 32));
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + 1, mPos.y() + 1 + 1.0f, mSize.x() - 2,
+                   mSize.y() - 2, 3);
+    nvgFillPaint(ctx, mEditable && focused() ? fg : bg);
+    nvgFill(ctx);
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + 0.5f, mPos.y() + 0.5f, mSize.x() - 1,
+                   mSize.y() - 1, 2.5f);
+    nvgStrokeColor(ctx, Color(0, 48));
+    nvgStroke(ctx);
+
+    int lineh = lineHeight(), width = viewWidth(), height = mSize.y() - 2 * padding;
+    bool scrollbar = contentHeight() > height;
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x() + padding, mPos.y() + padding, width, height);
+
+    size_t first = (size_t) (mScrollY / lineh),
+           last = std::min(mBuffer.lineCount(), (size_t) std::ceil((mScrollY + height) / lineh));
+    bool selection = focused() && mSelection != std::string::npos && mSelection != mCursorPos;
+    size_t begin = std::min(mSelection, mCursorPos), end = std::max(mSelection, mCursorPos);
+    float x0 = mPos.x() + padding - mScrollX;
+
+    nvgFontSize(ctx, fontSize());
+    nvgFontFace(ctx, "sans");
+    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+
+    size_t start = first < last ? mBuffer.lineStart(first) : 0;
+    for (size_t line = first; line < last; ++line) {
+        const LineLayout &layout = lineLayout(line);
+        const auto &glyphs = layout.glyphs;
+        float y = mPos.y() + padding + (float) ((double) line * lineh - mScrollY);
+
+        if (selection && begin <= start + layout.text.size() && end > start) {
+            float selx0 = begin > start ? offsetToX(layout, begin - start) : 0.f,
+                  selx1 = end <= start + layout.text.size()
+                              ? offsetToX(layout, end - start)
+                              : layout.width + fontSize() * 0.3f;
+            nvgBeginPath(ctx);
+            nvgFillColor(ctx, nvgRGBA(255, 255, 255, 80));
+            nvgRect(ctx, x0 + selx0, y, selx1 - selx0, lineh);
+            nvgFill(ctx);
+        }
+
+        /* Only draw the glyphs that intersect the view */
+        if (!glyphs.empty()) {
+            auto byX = [](float x, const TextMetrics::GlyphPosition &g) { return x < g.x; };
+            size_t a = (size_t) (std::upper_bound(glyphs.begin(), glyphs.end(),
+                                                  mScrollX - fontSize(), byX) - glyphs.begin());
+            size_t b = (size_t) (std::upper_bound(glyphs.begin(), glyphs.end(),
+                                                  mScrollX + width, byX) - glyphs.begin());
+            a = a > 0 ? a - 1 : 0;
+            size_t to = b < glyphs.size() ? glyphs[b].offset : layout.text.size();
+            nvgFillColor(ctx, mEnabled ? mTheme->mTextColor : mTheme->mDisabledTextColor);
+            nvgText(ctx, x0 + glyphs[a].x, y, layout.text.data() + glyphs[a].offset,
+                    layout.text.data() + to);
+        }
+
+        if (focused() && mCursorPos >= start && mCursorPos <= start + layout.text.size()) {
+            float caretx = x0 + offsetToX(layout, mCursorPos - start);
+            nvgBeginPath(ctx);
+            nvgMoveTo(ctx, caretx, y);
+            nvgLineTo(ctx, caretx, y + lineh);
+            nvgStrokeColor(ctx, nvgRGBA(255, 192, 0, 255));
+            nvgStrokeWidth(ctx, 1.0f);
+            nvgStroke(ctx);
+        }
+
+        start += layout.text.size() + 1;
+    }
+
+    nvgRestore(ctx);
+
+    if (!scrollbar)
+        return;
+
+    double range = contentHeight() - height;
+    float scrollh = std::max(20.0f, (float) (mSize.y() *
+        std::min(1.0, height / contentHeight())));
+    float scroll = (float) std::min(1.0, mScrollY / range);
+
+    NVGpaint paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 + 1, mPos.y() + 4 + 1, 8,
+        mSize.y() - 8, 3, 4, Color(0, 32), Color(0, 92));
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12, mPos.y() + 4, 8,
+                   mSize.y() - 8, 3);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+
+    paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 - 1,
+        mPos.y() + 4 + (mSize.y() - 8 - scrollh) * scroll - 1, 8, scrollh,
+        3, 4, Color(220, 100), Color(128, 100));
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12 + 1,
+                   mPos.y() + 4 + 1 + (mSize.y() - 8 - scrollh) * scroll, 8 - 2,
+                   scrollh - 2, 2);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+}
+
+void TextArea::save(Serializer &s) const {
+    Widget::save(s);
+    s.set("value", value());
+    s.set("editable", mEditable);
+    s.set("scroll", mScrollY);
+}
+
+bool TextArea::load(Serializer &s) {
+    if (!Widget::load(s)) return false;
+    std::string value;
+    if (!s.get("value", value)) return false;
+    if (!s.get("editable", mEditable)) return false;
+    setValue(value);
+    if (!s.get("scroll", mScrollY)) return false;
+    return true;
+}
+
+const TextArea::LineLayout &TextArea::lineLayout(size_t line) const {
+    float size = (float) fontSize(), ratio = pixelRatio();
+    if (size != mLayoutFontSize || ratio != mLayoutPixelRatio) {
+        mLineLayouts.clear();
+        mLayoutFontSize = size;
+        mLayoutPixelRatio = ratio;
+    }
+
+    auto it = mLineLayouts.find(line);
+    if (it != mLineLayouts.end())
+        return it->second;
+
+    /* Forget the layouts of lines far away from the view */
+    if (mLineLayouts.size() >= maxLineLayouts) {
+        size_t window = maxLineLayouts / 4;
+        mLineLayouts.erase(mLineLayouts.begin(),
+            mLineLayouts.lower_bound(line > window ? line - window : 0));
+        mLineLayouts.erase(mLineLayouts.upper_bound(line + window), mLineLayouts.end());
+    }
+
+    LineLayout &layout = mLineLayouts[line];
+    layout.text = mBuffer.line(line);
+    layout.width = TextMetrics::glyphPositions(
+        sansFont(), size, layout.text.data(),
+        layout.text.data() + layout.text.size(), layout.glyphs, 0.f, ratio);
+    return layout;
+}
+
+void TextArea::invalidateLines(size_t line, bool following) {
+    if (following)
+        mLineLayouts.erase(mLineLayouts.lower_bound(line), mLineLayouts.end());
+    else
+        mLineLayouts.erase(line);
+}
+
+float TextArea::offsetToX(const LineLayout &layout, size_t offset) const {
+    auto it = std::lower_bound(layout.glyphs.begin(), layout.glyphs.end(), offset,
+        [](const TextMetrics::GlyphPosition &g, size_t o) { return g.offset < o; });
+    return it == layout.glyphs.end() ? layout.width : it->x;
+}
+
+size_t TextArea::xToOffset(const LineLayout &layout, float x) const {
+    /* The first glyph whose center lies to the right of x */
+    const auto &glyphs = layout.glyphs;
+    size_t lo = 0, hi = glyphs.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        float next = mid + 1 < glyphs.size() ? glyphs[mid + 1].x : layout.width;
+        if (x < (glyphs[mid].x + next) * 0.5f)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo < glyphs.size() ? glyphs[lo].offset : layout.text.size();
+}
+
+size_t TextArea::previousCharacter(size_t pos) const {
+    if (pos == 0)
+        return 0;
+    size_t line = mBuffer.lineOf(pos), start = mBuffer.lineStart(line);
+    if (pos == start)
+        return pos - 1;
+    const std::string &text = lineLayout(line).text;
+    size_t i = pos - start - 1;
+    while (i > 0 && (text[i] & 0xC0) == 0x80)
+        --i;
+    return start + i;
+}
+
+size_t TextArea::nextCharacter(size_t pos) const {
+    if (pos >= mBuffer.size())
+        return mBuffer.size();
+    size_t line = mBuffer.lineOf(pos), start = mBuffer.lineStart(line);
+    const std::string &text = lineLayout(line).text;
+    size_t i = pos - start;
+    if (i >= text.size())
+        return pos + 1;
+    ++i;
+    while (i < text.size() && (text[i] & 0xC0) == 0x80)
+        ++i;
+    return start + i;
+}
+
+void TextArea::replace(size_t begin, size_t end, const std::string &text) {
+    size_t line = mBuffer.lineOf(begin);
+    bool following = text.find('\n') != std::string::npos ||
+                     (end > begin && mBuffer.lineOf(end) != line);
+    mBuffer.erase(begin, end - begin);
+    mBuffer.insert(begin, text);
+    invalidateLines(line, following);
+
+    mCursorPos = begin + text.size();
+    mSelection = std::string::npos;
+    mPreferredX = -1.f;
+    scrollToCursor();
+    if (mCallback)
+        mCallback();
+}
+
+void TextArea::moveCursor(size_t pos, bool extend) {
+    if (!extend)
+        mSelection = std::string::npos;
+    else if (mSelection == std::string::npos)
+        mSelection = mCursorPos;
+    mCursorPos = std::min(pos, mBuffer.size());
+    scrollToCursor();
+}
+
+bool TextArea::copySelection() {
+    if (mSelection == std::string::npos || mSelection == mCursorPos)
+        return false;
+    glfwSetClipboardString(screen()->glfwWindow(), selectedText().c_str());
+    return true;
+}
+
+void TextArea::pasteFromClipboard() {
+    const char *cbstr = glfwGetClipboardString(screen()->glfwWindow());
+    if (cbstr)
+        insert(std::string(cbstr));
+}
+
+int TextArea::viewWidth() const {
+    bool scrollbar = contentHeight() > mSize.y() - 2 * padding;
+    return std::max(0, mSize.x() - 2 * padding - (scrollbar ? 12 : 0));
+}
+
+NAMESPACE_END(nanogui)
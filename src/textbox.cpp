@@ -18,8 +18,11 @@
 #include <nanogui/opengl.h>
 #include <nanogui/theme.h>
 #include <nanogui/serializer/core.h>
+#include <nanogui/textmetrics.h>
 #include <regex>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -43,7 +46,10 @@ TextBox::TextBox(Widget *parent,const std::string &value)
       mMouseDragPos(Vector2i(-1,-1)),
       mMouseDownModifier(0),
       mTextOffset(0),
-      mLastClick(0) {
+      mLastClick(0),
+      mGlyphWidth(0),
+      mGlyphFontSize(0),
+      mGlyphPixelRatio(0) {
     if (mTheme) mFontSize = mTheme->mTextBoxFontSize;
     mIconExtraScale = 0.8f;// widget override
 }
@@ -65,18 +71,22 @@ Vector2i TextBox::preferredSize(NVGcontext *ctx) const {
     float uw = 0;
     if (mUnitsImage > 0) {
         int w, h;
-        nvgImageSize(ctx, mUnitsImage, &w, &h);
+        {
+            /* Queries the shared NanoVG context */
+            LayoutLock lock;
+            nvgImageSize(ctx, mUnitsImage, &w, &h);
+        }
         float uh = size(1) * 0.4f;
         uw = w * uh / h;
     } else if (!mUnits.empty()) {
-        uw = nvgTextBounds(ctx, 0, 0, mUnits.c_str(), nullptr, nullptr);
+        uw = TextMetrics::textWidth(ctx, "sans", fontSize(), mUnits);
     }
     float sw = 0;
     if (mSpinnable) {
         sw = 14.f;
     }
 
-    float ts = nvgTextBounds(ctx, 0, 0, mValue.c_str(), nullptr, nullptr);
+    float ts = TextMetrics::textWidth(ctx, "sans", fontSize(), mValue);
     size(0) = size(1) + ts + uw + sw;
     return size;
 }
@@ -137,7 +147,7 @@ void TextBox::draw(NVGcontext* ctx) {
         nvgFill(ctx);
         unitWidth += 2;
     } else if (!mUnits.empty()) {
-        unitWidth = nvgTextBounds(ctx, 0, 0, mUnits.c_str(), nullptr, nullptr);
+        unitWidth = TextMetrics::textWidth(ctx, "sans", fontSize(), mUnits);
         nvgFillColor(ctx, Color(255, mEnabled ? 64 : 32));
         nvgTextAlign(ctx, NVG_ALIGN_RIGHT | NVG_ALIGN_MIDDLE);
         nvgText(ctx, mPos.x() + mSize.x() - xSpacing, drawPos.y(),
@@ -215,24 +225,23 @@ void TextBox::draw(NVGcontext* ctx) {
         nvgText(ctx, drawPos.x(), drawPos.y(),
             mValue.empty() ? mPlaceholder.c_str() : mValue.c_str(), nullptr);
     } else {
-        const int maxGlyphs = 1024;
-        NVGglyphPosition glyphs[maxGlyphs];
-        float textBound[4];
-        nvgTextBounds(ctx, drawPos.x(), drawPos.y(), mValueTemp.c_str(),
-                      nullptr, textBound);
-        float lineh = textBound[3] - textBound[1];
-
-        // find cursor positions
-        int nglyphs =
-            nvgTextGlyphPositions(ctx, drawPos.x(), drawPos.y(),
-                                  mValueTemp.c_str(), nullptr, glyphs, maxGlyphs);
-        updateCursor(ctx, textBound[2], glyphs, nglyphs);
+        float lineh;
+        TextMetrics::verticalMetrics(TextMetrics::findFont("sans"), fontSize(),
+                                     nullptr, nullptr, &lineh, TextMetrics::pixelRatio(ctx));
+
+        // glyph positions are cached and only updated around edits
+        updateGlyphPositions();
+        int nglyphs = (int) mGlyphs.size();
+        float alignOffset = mAlignment == Alignment::Left ? 0.f :
+            (mAlignment == Alignment::Right ? mGlyphWidth : mGlyphWidth * 0.5f);
+        float originx = drawPos.x() - alignOffset;
+        updateCursor(originx);
 
         // compute text offset
         int prevCPos = mCursorPos > 0 ? mCursorPos - 1 : 0;
         int nextCPos = mCursorPos < nglyphs ? mCursorPos + 1 : nglyphs;
-        float prevCX = cursorIndex2Position(prevCPos, textBound[2], glyphs, nglyphs);
-        float nextCX = cursorIndex2Position(nextCPos, textBound[2], glyphs, nglyphs);
+        float prevCX = cursorIndex2Position(prevCPos, originx);
+        float nextCX = cursorIndex2Position(nextCPos, originx);
 
         if (nextCX > clipX + clipWidth)
             mTextOffset -= nextCX - (clipX + clipWidth) + 1;
@@ -240,22 +249,27 @@ void TextBox::draw(NVGcontext* ctx) {
             mTextOffset += clipX - prevCX + 1;
 
         drawPos.x() = oldDrawPos.x() + mTextOffset;
-
-        // draw text with offset
-        nvgText(ctx, drawPos.x(), drawPos.y(), mValueTemp.c_str(), nullptr);
-        nvgTextBounds(ctx, drawPos.x(), drawPos.y(), mValueTemp.c_str(),
-                      nullptr, textBound);
-
-        // recompute cursor positions
-        nglyphs = nvgTextGlyphPositions(ctx, drawPos.x(), drawPos.y(),
-                mValueTemp.c_str(), nullptr, glyphs, maxGlyphs);
+        originx = drawPos.x() - alignOffset;
+
+        // draw only the glyphs that intersect the clip rectangle
+        if (nglyphs > 0) {
+            auto byX = [](float x, const TextMetrics::GlyphPosition &g) { return x < g.x; };
+            int first = (int) (std::upper_bound(mGlyphs.begin(), mGlyphs.end(),
+                                                clipX - originx - fontSize(), byX) - mGlyphs.begin());
+            int last = (int) (std::upper_bound(mGlyphs.begin(), mGlyphs.end(),
+                                               clipX + clipWidth - originx, byX) - mGlyphs.begin());
+            first = std::max(first - 1, 0);
+            const char *begin = mValueTemp.data() + mGlyphs[first].offset;
+            const char *end = last < nglyphs ? mValueTemp.data() + mGlyphs[last].offset
+                                             : mValueTemp.data() + mValueTemp.size();
+            nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+            nvgText(ctx, originx + mGlyphs[first].x, drawPos.y(), begin, end);
+        }
 
         if (mCursorPos > -1) {
             if (mSelectionPos > -1) {
-                float caretx = cursorIndex2Position(mCursorPos, textBound[2],
-                                                    glyphs, nglyphs);
-                float selx = cursorIndex2Position(mSelectionPos, textBound[2],
-                                                  glyphs, nglyphs);
+                float caretx = cursorIndex2Position(mCursorPos, originx);
+                float selx = cursorIndex2Position(mSelectionPos, originx);
 
                 if (caretx > selx)
                     std::swap(caretx, selx);
@@ -268,7 +282,7 @@ void TextBox::draw(NVGcontext* ctx) {
                 nvgFill(ctx);
             }
 
-            float caretx = cursorIndex2Position(mCursorPos, textBound[2], glyphs, nglyphs);
+            float caretx = cursorIndex2Position(mCursorPos, originx);
 
             // draw cursor
             nvgBeginPath(ctx);
@@ -318,6 +332,7 @@ bool TextBox::mouseButtonEvent(const Vector2i &p, int button, bool down,
                 if (time - mLastClick < 0.25) {
                     /* Double-click: reset to default value */
                     mValue = mDefaultValue;
+                    invalidateLayout();
                     if (mCallback)
                         mCallback(mValue);
 
@@ -386,6 +401,8 @@ bool TextBox::focusEvent(bool focused) {
 
             if (mCallback && !mCallback(mValue))
                 mValue = backup;
+            if (mValue != backup)
+                invalidateLayout();
 
             mValidFormat = true;
             mCommitted = true;
@@ -496,20 +513,116 @@ bool TextBox::keyboardCharacterEvent(unsigned int codepoint) {
     return false;
 }
 
-bool TextBox::checkFormat(const std::string &input, const std::string &format) {
+struct TextBox::Validator {
+    enum class Kind { Regex, Unsigned, Signed, Float };
+
+    Kind kind = Kind::Regex;
+    std::regex regex;
+    /// Set if the regular expression could not be compiled
+    bool unsupported = false;
+
+    static size_t digits(const std::string &s, size_t &i) {
+        size_t start = i;
+        while (i < s.size() && s[i] >= '0' && s[i] <= '9')
+            ++i;
+        return i - start;
+    }
+
+    bool match(const std::string &s) const {
+        size_t i = 0;
+        switch (kind) {
+            case Kind::Unsigned: /* [0-9]* */
+                digits(s, i);
+                return i == s.size();
+
+            case Kind::Signed: /* [-]?[0-9]* */
+                if (i < s.size() && s[i] == '-')
+                    ++i;
+                digits(s, i);
+                return i == s.size();
+
+            case Kind::Float: { /* [-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)? */
+                if (i < s.size() && (s[i] == '-' || s[i] == '+'))
+                    ++i;
+                size_t mantissa = digits(s, i);
+                if (i < s.size() && s[i] == '.') {
+                    ++i;
+                    mantissa = digits(s, i);
+                }
+                if (mantissa == 0)
+                    return false;
+                if (i < s.size() && (s[i] == 'e' || s[i] == 'E')) {
+                    ++i;
+                    if (i < s.size() && (s[i] == '-' || s[i] == '+'))
+                        ++i;
+                    if (digits(s, i) == 0)
+                        return false;
+                }
+                return i == s.size();
+            }
+
+            default:
+                return unsupported || std::regex_match(s, regex);
+        }
+    }
+};
+
+std::shared_ptr<const TextBox::Validator> TextBox::validator(const std::string &format) {
     if (format.empty())
-        return true;
-    try {
-        std::regex regex(format);
-        return regex_match(input, regex);
-    } catch (const std::regex_error &) {
+        return nullptr;
+
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<const Validator>> validators;
+
+    std::lock_guard<std::mutex> guard(mutex);
+    auto it = validators.find(format);
+    if (it != validators.end()) {
+        if (auto result = it->second.lock())
+            return result;
+    }
+
+    std::shared_ptr<Validator> result = std::make_shared<Validator>();
+    if (format == "[0-9]*") {
+        result->kind = Validator::Kind::Unsigned;
+    } else if (format == "[-]?[0-9]*") {
+        result->kind = Validator::Kind::Signed;
+    } else if (format == "[-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?") {
+        result->kind = Validator::Kind::Float;
+    } else {
+        try {
+            result->regex = std::regex(format, std::regex::optimize);
+        } catch (const std::regex_error &) {
 #if __GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ < 9)
-        std::cerr << "Warning: cannot validate text field due to lacking regular expression support. please compile with GCC >= 4.9" << std::endl;
-        return true;
+            std::cerr << "Warning: cannot validate text field due to lacking regular expression support. please compile with GCC >= 4.9" << std::endl;
+            result->unsupported = true;
 #else
-        throw;
+            throw;
 #endif
+        }
     }
+
+    /* Drop the entries of formats that are no longer used */
+    for (auto it2 = validators.begin(); it2 != validators.end(); ) {
+        if (it2->second.expired())
+            it2 = validators.erase(it2);
+        else
+            ++it2;
+    }
+    validators[format] = result;
+    return result;
+}
+
+void TextBox::setFormat(const std::string &format) {
+    mValidator = validator(format);
+    mFormat = format;
+}
+
+bool TextBox::checkFormat(const std::string &input, const std::string &format) {
+    if (format.empty())
+        return true;
+    if (format == mFormat && mValidator)
+        return mValidator->match(input);
+    return validator(format)->match(input);
 }
 
 bool TextBox::copySelection() {
@@ -563,8 +676,90 @@ bool TextBox::deleteSelection() {
     return false;
 }
 
-void TextBox::updateCursor(NVGcontext *, float lastx,
-                           const NVGglyphPosition *glyphs, int size) {
+void TextBox::updateGlyphPositions() {
+    typedef TextMetrics::GlyphPosition GlyphPosition;
+    int font = TextMetrics::findFont("sans");
+    float size = (float) fontSize(), ratio = pixelRatio();
+    const std::string &text = mValueTemp, &old = mGlyphText;
+
+    if (size != mGlyphFontSize || ratio != mGlyphPixelRatio) {
+        mGlyphWidth = TextMetrics::glyphPositions(
+            font, size, text.data(), text.data() + text.size(), mGlyphs, 0.f, ratio);
+        mGlyphText = text;
+        mGlyphFontSize = size;
+        mGlyphPixelRatio = ratio;
+        return;
+    }
+    if (text == old)
+        return;
+
+    /* Common prefix and suffix, shortened to character boundaries */
+    auto continuation = [](const std::string &s, size_t i) {
+        return i < s.size() && (s[i] & 0xC0) == 0x80;
+    };
+    size_t oldSize = old.size(), newSize = text.size(),
+           limit = std::min(oldSize, newSize), prefix = 0, suffix = 0;
+    while (prefix < limit && old[prefix] == text[prefix])
+        ++prefix;
+    while (prefix > 0 && (continuation(old, prefix) || continuation(text, prefix)))
+        --prefix;
+    while (suffix < limit - prefix && old[oldSize - 1 - suffix] == text[newSize - 1 - suffix])
+        ++suffix;
+    while (suffix > 0 && continuation(old, oldSize - suffix))
+        --suffix;
+
+    /* Glyphs [changed, unchanged) of the old text are replaced */
+    auto byOffset = [](const GlyphPosition &g, size_t offset) { return g.offset < offset; };
+    size_t count = mGlyphs.size();
+    size_t changed = (size_t) (std::lower_bound(mGlyphs.begin(), mGlyphs.end(), prefix, byOffset) - mGlyphs.begin());
+    size_t unchanged = (size_t) (std::lower_bound(mGlyphs.begin(), mGlyphs.end(), oldSize - suffix, byOffset) - mGlyphs.begin());
+
+    /* Measure from the preceding glyph to the first glyph of the suffix, so
+       that the kerning against both neighbors is included */
+    size_t start = changed > 0 ? mGlyphs[changed - 1].offset : 0, end = newSize;
+    if (unchanged < count)
+        end = (unchanged + 1 < count ? mGlyphs[unchanged + 1].offset : oldSize) + newSize - oldSize;
+    std::vector<GlyphPosition> middle;
+    float advance = TextMetrics::glyphPositions(font, size, text.data() + start,
+                                                text.data() + end, middle, 0.f, ratio);
+
+    /* Align the measurement with the pen position after the preceding glyph */
+    float shift = 0.f;
+    size_t skip = 0;
+    if (changed > 0) {
+        float pen = changed < count ? mGlyphs[changed].x : mGlyphWidth;
+        shift = pen - (middle.size() > 1 ? middle[1].x : advance);
+        skip = 1;
+    }
+
+    std::vector<GlyphPosition> glyphs(mGlyphs.begin(), mGlyphs.begin() + changed);
+    glyphs.reserve(count + middle.size());
+    for (size_t i = skip; i < middle.size(); ++i) {
+        GlyphPosition g = middle[i];
+        g.offset += start;
+        g.x += shift; g.minx += shift; g.maxx += shift;
+        glyphs.push_back(g);
+    }
+    float width = advance + shift;
+
+    /* The rest of the suffix keeps its layout and moves as a whole */
+    if (unchanged < count) {
+        float dx = width - (unchanged + 1 < count ? mGlyphs[unchanged + 1].x : mGlyphWidth);
+        for (size_t i = unchanged + 1; i < count; ++i) {
+            GlyphPosition g = mGlyphs[i];
+            g.offset = g.offset + newSize - oldSize;
+            g.x += dx; g.minx += dx; g.maxx += dx;
+            glyphs.push_back(g);
+        }
+        width = mGlyphWidth + dx;
+    }
+
+    mGlyphs.swap(glyphs);
+    mGlyphWidth = width;
+    mGlyphText = text;
+}
+
+void TextBox::updateCursor(float originx) {
     // handle mouse cursor events
     if (mMouseDownPos.x() != -1) {
         if (mMouseDownModifier == GLFW_MOD_SHIFT) {
@@ -573,51 +768,45 @@ void TextBox::updateCursor(NVGcontext *, float lastx,
         } else
             mSelectionPos = -1;
 
-        mCursorPos =
-            position2CursorIndex(mMouseDownPos.x(), lastx, glyphs, size);
+        mCursorPos = position2CursorIndex(mMouseDownPos.x(), originx);
 
         mMouseDownPos = Vector2i(-1, -1);
     } else if (mMouseDragPos.x() != -1) {
         if (mSelectionPos == -1)
             mSelectionPos = mCursorPos;
 
-        mCursorPos =
-            position2CursorIndex(mMouseDragPos.x(), lastx, glyphs, size);
+        mCursorPos = position2CursorIndex(mMouseDragPos.x(), originx);
     } else {
         // set cursor to last character
         if (mCursorPos == -2)
-            mCursorPos = size;
+            mCursorPos = (int) mGlyphs.size();
     }
 
     if (mCursorPos == mSelectionPos)
         mSelectionPos = -1;
 }
 
-float TextBox::cursorIndex2Position(int index, float lastx,
-                                    const NVGglyphPosition *glyphs, int size) {
-    float pos = 0;
-    if (index == size)
-        pos = lastx; // last character
-    else
-        pos = glyphs[index].x;
-
-    return pos;
+float TextBox::cursorIndex2Position(int index, float originx) const {
+    if (index < 0 || index >= (int) mGlyphs.size())
+        return originx + mGlyphWidth; // last character
+    return originx + mGlyphs[index].x;
 }
 
-int TextBox::position2CursorIndex(float posx, float lastx,
-                                  const NVGglyphPosition *glyphs, int size) {
-    int mCursorId = 0;
-    float caretx = glyphs[mCursorId].x;
-    for (int j = 1; j < size; j++) {
-        if (std::abs(caretx - posx) > std::abs(glyphs[j].x - posx)) {
-            mCursorId = j;
-            caretx = glyphs[mCursorId].x;
-        }
+int TextBox::position2CursorIndex(float posx, float originx) const {
+    /* The glyph positions are sorted, so the closest one is found by bisection */
+    posx -= originx;
+    int size = (int) mGlyphs.size(), lo = 0, hi = size;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (mGlyphs[mid].x < posx)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
-    if (std::abs(caretx - posx) > std::abs(lastx - posx))
-        mCursorId = size;
-
-    return mCursorId;
+    auto x = [&](int index) { return index < size ? mGlyphs[index].x : mGlyphWidth; };
+    if (lo > 0 && std::abs(x(lo - 1) - posx) <= std::abs(x(lo) - posx))
+        return lo - 1;
+    return lo;
 }
 
 TextBox::SpinArea TextBox::spinArea(const Vector2i & pos) {
@@ -657,7 +846,9 @@ bool TextBox::load(Serializer &s) {
     if (!s.get("defaultValue", mDefaultValue)) return false;
     if (!s.get("alignment", mAlignment)) return false;
     if (!s.get("units", mUnits)) return false;
-    if (!s.get("format", mFormat)) return false;
+    std::string format;
+    if (!s.get("format", format)) return false;
+    setFormat(format);
     if (!s.get("unitsImage", mUnitsImage)) return false;
     if (!s.get("validFormat", mValidFormat)) return false;
     if (!s.get("valueTemp", mValueTemp)) return false;
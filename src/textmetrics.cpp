@@ -0,0 +1,603 @@
+/*
+    src/textmetrics.cpp -- Measurement of text without an OpenGL or
+    NanoVG context
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/textmetrics.h>
+#include <nanogui/glyphcache.h>
+#include <nanogui/opengl.h>
+#include <nanogui/resourcepack.h>
+#include <nanogui/widget.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/* NanoVG links its own copy of stb_truetype, so keep this one private */
+#if defined(__GNUG__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+#define STB_TRUETYPE_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_truetype.h>
+#if defined(__GNUG__)
+#  pragma GCC diagnostic pop
+#endif
+
+NAMESPACE_BEGIN(nanogui)
+
+namespace {
+    /// Unscaled metrics of a glyph
+    struct Glyph {
+        int index = 0;
+        int advance = 0;
+        int x0 = 0, x1 = 0;
+    };
+
+    struct Face {
+        std::string name;
+        /* Built-in faces are read from the resource pack on first use */
+        std::string resource;
+        std::once_flag loadFlag;
+        stbtt_fontinfo info;
+        size_t dataSize;
+        /* Hash of the font data, computed on first use */
+        std::once_flag hashFlag;
+        uint64_t hash;
+        /* Vertical metrics relative to the font height, as used by fontstash */
+        float ascender, descender, lineHeight;
+        /* Glyphs of the first 128 code points, immutable after construction */
+        Glyph ascii[128];
+        /* Glyphs of all other code points, filled on demand */
+        std::mutex mutex;
+        std::unordered_map<uint32_t, Glyph> glyphs;
+
+        bool load(const unsigned char *data, size_t size) {
+            dataSize = size;
+            if (size == 0 || !stbtt_InitFont(&info, data, stbtt_GetFontOffsetForIndex(data, 0)))
+                return false;
+
+            int ascent, descent, lineGap;
+            stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+            float height = (float) (ascent - descent);
+            ascender = ascent / height;
+            descender = descent / height;
+            lineHeight = (height + lineGap) / height;
+            for (uint32_t c = 0; c < 128; ++c)
+                ascii[c] = lookup(c);
+            return true;
+        }
+
+        Glyph lookup(uint32_t codepoint) const {
+            Glyph glyph;
+            int y0, y1;
+            glyph.index = stbtt_FindGlyphIndex(&info, (int) codepoint);
+            stbtt_GetGlyphHMetrics(&info, glyph.index, &glyph.advance, nullptr);
+            if (!stbtt_GetGlyphBox(&info, glyph.index, &glyph.x0, &y0, &glyph.x1, &y1))
+                glyph.x0 = glyph.x1 = 0;
+            return glyph;
+        }
+
+        Glyph glyph(uint32_t codepoint) {
+            if (codepoint < 128)
+                return ascii[codepoint];
+            std::lock_guard<std::mutex> guard(mutex);
+            auto it = glyphs.find(codepoint);
+            if (it == glyphs.end())
+                it = glyphs.emplace(codepoint, lookup(codepoint)).first;
+            return it->second;
+        }
+    };
+
+    /* Faces are never removed, so handles can be resolved without locking */
+    struct Registry {
+        static const int maxFaces = 64;
+
+        std::mutex mutex;
+        std::atomic<Face *> faces[maxFaces];
+        std::atomic<int> count;
+        std::atomic<float> pixelRatio;
+        /* Pixel ratios of the NanoVG contexts, which are only written with
+           the mutex held (the ratio before the context) */
+        static const int maxContexts = 64;
+        std::atomic<NVGcontext *> contexts[maxContexts];
+        std::atomic<float> contextRatios[maxContexts];
+
+        Registry() : count(0), pixelRatio(1.f) {
+            for (int i = 0; i < maxFaces; ++i)
+                faces[i] = nullptr;
+            for (int i = 0; i < maxContexts; ++i) {
+                contexts[i] = nullptr;
+                contextRatios[i] = 1.f;
+            }
+            addResource("sans", "Roboto-Regular.ttf");
+            addResource("sans-bold", "Roboto-Bold.ttf");
+            addResource("icons", "entypo.ttf");
+        }
+
+        ~Registry() {
+            for (int i = 0; i < maxFaces; ++i)
+                delete faces[i].load();
+        }
+
+        int add(const std::string &name, const unsigned char *data, size_t size) {
+            std::unique_ptr<Face> face(new Face());
+            face->name = name;
+            bool loaded = false;
+            std::call_once(face->loadFlag, [&]() { loaded = face->load(data, size); });
+            if (!loaded)
+                return -1;
+            return publish(std::move(face));
+        }
+
+        int addResource(const std::string &name, const std::string &resource) {
+            std::unique_ptr<Face> face(new Face());
+            face->name = name;
+            face->resource = resource;
+            return publish(std::move(face));
+        }
+
+        int publish(std::unique_ptr<Face> face) {
+            std::lock_guard<std::mutex> guard(mutex);
+            int id = count;
+            if (id == maxFaces)
+                throw std::runtime_error("TextMetrics: too many fonts!");
+            faces[id] = face.release();
+            count = id + 1;
+            return id;
+        }
+
+        /// Return the given ratio, or the default one if it is not positive
+        float ratio(float pixelRatio) const {
+            return pixelRatio > 0.f ? pixelRatio : this->pixelRatio.load();
+        }
+
+        Face *face(int id) {
+            if (id < 0 || id >= count)
+                throw std::runtime_error("TextMetrics: invalid font handle!");
+            Face *f = faces[id];
+            std::call_once(f->loadFlag, [f]() {
+                ResourcePack::Resource r = ResourcePack::resource(f->resource);
+                if (!f->load(r.data, r.size))
+                    throw std::runtime_error("TextMetrics: could not load \"" + f->resource + "\"!");
+            });
+            return f;
+        }
+    };
+
+    Registry &registry() {
+        static Registry registry;
+        return registry;
+    }
+
+    /* Decode the next code point, or return -1 and skip an invalid byte */
+    int decodeUtf8(const char *&p, const char *end) {
+        const unsigned char *s = (const unsigned char *) p;
+        int length, codepoint;
+        if (s[0] < 0x80) {
+            length = 1; codepoint = s[0];
+        } else if ((s[0] & 0xE0) == 0xC0) {
+            length = 2; codepoint = s[0] & 0x1F;
+        } else if ((s[0] & 0xF0) == 0xE0) {
+            length = 3; codepoint = s[0] & 0x0F;
+        } else if ((s[0] & 0xF8) == 0xF0) {
+            length = 4; codepoint = s[0] & 0x07;
+        } else {
+            ++p;
+            return -1;
+        }
+        if (end - p < length) {
+            ++p;
+            return -1;
+        }
+        for (int i = 1; i < length; ++i) {
+            if ((s[i] & 0xC0) != 0x80) {
+                ++p;
+                return -1;
+            }
+            codepoint = (codepoint << 6) | (s[i] & 0x3F);
+        }
+        p += length;
+        return codepoint;
+    }
+
+    /* Lay out the glyphs the same way as fontstash, in framebuffer pixels */
+    float measure(Face *face, float size, const char *string, const char *end,
+                  float letterSpacing, float ratio, float *bounds,
+                  std::vector<TextMetrics::GlyphPosition> *positions = nullptr) {
+        float isize = (short) (size * ratio * 10.f) / 10.f;
+        float scale = stbtt_ScaleForPixelHeight(&face->info, isize);
+        float spacing = letterSpacing * ratio;
+
+        float x = 0.f, minx = 0.f, maxx = 0.f;
+        int prev = -1;
+        for (const char *p = string; p < end; ) {
+            const char *start = p;
+            int codepoint = decodeUtf8(p, end);
+            if (codepoint < 0)
+                continue;
+            Glyph glyph = face->glyph((uint32_t) codepoint);
+            float pen = x;
+            if (prev != -1) {
+                float kern = stbtt_GetGlyphKernAdvance(&face->info, prev, glyph.index) * scale;
+                x += (int) (kern + spacing + 0.5f);
+            }
+
+            /* Quads cover the glyph bitmap plus one pixel of padding */
+            int bx0 = (int) std::floor(glyph.x0 * scale),
+                bx1 = (int) std::ceil(glyph.x1 * scale);
+            float qx0 = std::floor(x + bx0 - 1), qx1 = qx0 + (bx1 - bx0) + 2;
+            minx = std::min(minx, qx0);
+            maxx = std::max(maxx, qx1);
+
+            x += (int) ((short) (scale * glyph.advance * 10.f) / 10.f + 0.5f);
+            prev = glyph.index;
+
+            if (positions)
+                positions->push_back({ (size_t) (start - string), pen / ratio,
+                                       std::min(pen, qx0) / ratio,
+                                       std::max(x, qx1) / ratio });
+        }
+
+        if (bounds) {
+            float miny = -face->ascender * isize;
+            bounds[0] = minx / ratio;
+            bounds[1] = miny / ratio;
+            bounds[2] = maxx / ratio;
+            bounds[3] = (miny + face->lineHeight * isize) / ratio;
+        }
+        return x / ratio;
+    }
+
+    /* Strings are identified by their length and 64 bit FNV-1a hash */
+    struct CacheKey {
+        int font;
+        float size, letterSpacing, ratio;
+        size_t length;
+        uint64_t hash;
+
+        bool operator==(const CacheKey &k) const {
+            return font == k.font && size == k.size &&
+                   letterSpacing == k.letterSpacing && ratio == k.ratio &&
+                   length == k.length && hash == k.hash;
+        }
+    };
+
+    struct CacheKeyHash {
+        size_t operator()(const CacheKey &k) const {
+            uint64_t h = k.hash ^ ((uint64_t) k.font << 56);
+            h ^= std::hash<float>()(k.size) * 0x9E3779B97F4A7C15ull;
+            h ^= std::hash<float>()(k.letterSpacing) + (h << 6) + (h >> 2);
+            h ^= std::hash<float>()(k.ratio) + (h << 6) + (h >> 2);
+            return (size_t) h;
+        }
+    };
+
+    struct CacheEntry {
+        CacheKey key;
+        float advance;
+        float bounds[4];
+    };
+
+    /* Sharded so that parallel layout threads rarely contend for a lock */
+    struct CacheShard {
+        std::mutex mutex;
+        /* Most recently used entries first */
+        std::list<CacheEntry> entries;
+        std::unordered_map<CacheKey, std::list<CacheEntry>::iterator, CacheKeyHash> index;
+
+        void evict(size_t capacity) {
+            while (entries.size() > capacity) {
+                index.erase(entries.back().key);
+                entries.pop_back();
+            }
+        }
+    };
+
+    struct Cache {
+        static const size_t shardCount = 16;
+
+        CacheShard shards[shardCount];
+        std::atomic<size_t> capacity;
+        std::atomic<uint64_t> hits, misses;
+
+        Cache() : capacity(4096), hits(0), misses(0) { }
+
+        size_t shardCapacity() const {
+            size_t c = capacity;
+            return c == 0 ? 0 : std::max<size_t>(c / shardCount, 1);
+        }
+    };
+
+    Cache &cache() {
+        static Cache cache;
+        return cache;
+    }
+
+    uint64_t hashString(const char *string, const char *end) {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char *p = string; p < end; ++p)
+            hash = (hash ^ (unsigned char) *p) * 0x100000001b3ull;
+        return hash;
+    }
+
+    float cachedMeasure(int font, float size, const char *string, const char *end,
+                        float letterSpacing, float pixelRatio, float *bounds) {
+        Face *face = registry().face(font);
+        float ratio = registry().ratio(pixelRatio);
+        if (!end)
+            end = string + strlen(string);
+
+        Cache &c = cache();
+        size_t capacity = c.shardCapacity();
+        if (capacity == 0) {
+            if (GlyphCache::recording())
+                GlyphCache::addGlyphs(font, size, string, end, ratio);
+            return measure(face, size, string, end, letterSpacing, ratio, bounds);
+        }
+
+        CacheKey key { font, size, letterSpacing, ratio, (size_t) (end - string),
+                       hashString(string, end) };
+        CacheShard &shard = c.shards[CacheKeyHash()(key) % Cache::shardCount];
+        {
+            std::lock_guard<std::mutex> guard(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                const CacheEntry &entry = *it->second;
+                if (bounds)
+                    std::copy(entry.bounds, entry.bounds + 4, bounds);
+                c.hits++;
+                return entry.advance;
+            }
+        }
+        c.misses++;
+        if (GlyphCache::recording())
+            GlyphCache::addGlyphs(font, size, string, end, ratio);
+
+        /* Measure without holding the lock */
+        CacheEntry entry;
+        entry.key = key;
+        entry.advance = measure(face, size, string, end, letterSpacing, ratio, entry.bounds);
+        if (bounds)
+            std::copy(entry.bounds, entry.bounds + 4, bounds);
+
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        if (shard.index.find(key) == shard.index.end()) {
+            shard.entries.push_front(entry);
+            shard.index[key] = shard.entries.begin();
+            shard.evict(capacity);
+        }
+        return entry.advance;
+    }
+}
+
+int TextMetrics::addFont(const std::string &name, const unsigned char *data, size_t size) {
+    return registry().add(name, data, size);
+}
+
+int TextMetrics::findFont(const std::string &name) {
+    Registry &r = registry();
+    int count = r.count;
+    for (int i = 0; i < count; ++i) {
+        if (r.faces[i].load()->name == name)
+            return i;
+    }
+    return -1;
+}
+
+std::string TextMetrics::fontName(int font) {
+    return registry().face(font)->name;
+}
+
+uint64_t TextMetrics::fontHash(int font) {
+    Face *face = registry().face(font);
+    std::call_once(face->hashFlag, [face]() {
+        const char *data = (const char *) face->info.data;
+        face->hash = hashString(data, data + face->dataSize);
+    });
+    return face->hash;
+}
+
+float TextMetrics::pixelRatio() {
+    return registry().pixelRatio;
+}
+
+void TextMetrics::setPixelRatio(float ratio) {
+    registry().pixelRatio = ratio > 0.f ? ratio : 1.f;
+}
+
+float TextMetrics::pixelRatio(NVGcontext *ctx) {
+    Registry &r = registry();
+    for (int i = 0; ctx && i < Registry::maxContexts; ++i) {
+        if (r.contexts[i] == ctx)
+            return r.contextRatios[i];
+    }
+    return r.pixelRatio;
+}
+
+void TextMetrics::setPixelRatio(NVGcontext *ctx, float ratio) {
+    if (!ctx)
+        throw std::runtime_error("TextMetrics::setPixelRatio(): invalid context!");
+    Registry &r = registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    int slot = -1;
+    for (int i = 0; i < Registry::maxContexts; ++i) {
+        if (r.contexts[i] == ctx)
+            slot = i;
+        else if (slot < 0 && r.contexts[i] == nullptr && ratio > 0.f)
+            slot = i;
+    }
+    if (slot < 0) {
+        if (ratio > 0.f)
+            throw std::runtime_error("TextMetrics: too many NanoVG contexts!");
+        return;
+    }
+    if (ratio > 0.f) {
+        r.contextRatios[slot] = ratio;
+        r.contexts[slot] = ctx;
+    } else {
+        r.contexts[slot] = nullptr;
+    }
+}
+
+float TextMetrics::textWidth(int font, float size, const char *string,
+                             const char *end, float letterSpacing, float pixelRatio) {
+    return cachedMeasure(font, size, string, end, letterSpacing, pixelRatio, nullptr);
+}
+
+float TextMetrics::textBounds(int font, float size, const char *string,
+                              const char *end, float *bounds, float letterSpacing,
+                              float pixelRatio) {
+    return cachedMeasure(font, size, string, end, letterSpacing, pixelRatio, bounds);
+}
+
+float TextMetrics::glyphPositions(int font, float size, const char *string,
+                                  const char *end, std::vector<GlyphPosition> &positions,
+                                  float letterSpacing, float pixelRatio) {
+    if (!end)
+        end = string + strlen(string);
+    positions.clear();
+    float ratio = registry().ratio(pixelRatio);
+    if (GlyphCache::recording())
+        GlyphCache::addGlyphs(font, size, string, end, ratio);
+    return measure(registry().face(font), size, string, end, letterSpacing,
+                   ratio, nullptr, &positions);
+}
+
+float TextMetrics::quantizeFontSize(float size, int stepsPerOctave, float pixelRatio) {
+    float ratio = registry().ratio(pixelRatio);
+    float pixels = size * ratio;
+    if (!(pixels > 0.f) || stepsPerOctave <= 0)
+        return size;
+    float step = std::round(std::log2(pixels) * stepsPerOctave);
+    /* Round to the precision of fontstash, plus a margin that keeps the
+       truncation in NanoVG from selecting the next lower size */
+    float snapped = std::round(std::exp2(step / stepsPerOctave) * 10.f) / 10.f;
+    return (snapped + 0.01f) / ratio;
+}
+
+void TextMetrics::verticalMetrics(int font, float size, float *ascender,
+                                  float *descender, float *lineHeight, float pixelRatio) {
+    Face *face = registry().face(font);
+    float ratio = registry().ratio(pixelRatio);
+    float isize = (short) (size * ratio * 10.f) / 10.f;
+    if (ascender)
+        *ascender = face->ascender * isize / ratio;
+    if (descender)
+        *descender = face->descender * isize / ratio;
+    if (lineHeight)
+        *lineHeight = face->lineHeight * isize / ratio;
+}
+
+size_t TextMetrics::cacheCapacity() {
+    return cache().capacity;
+}
+
+void TextMetrics::setCacheCapacity(size_t capacity) {
+    Cache &c = cache();
+    c.capacity = capacity;
+    size_t shardCapacity = c.shardCapacity();
+    for (auto &shard : c.shards) {
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        shard.evict(shardCapacity);
+    }
+}
+
+void TextMetrics::clearCache() {
+    for (auto &shard : cache().shards) {
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        shard.evict(0);
+    }
+}
+
+uint64_t TextMetrics::cacheHits() {
+    return cache().hits;
+}
+
+uint64_t TextMetrics::cacheMisses() {
+    return cache().misses;
+}
+
+void TextMetrics::resetCacheStatistics() {
+    cache().hits = 0;
+    cache().misses = 0;
+}
+
+float TextMetrics::textWidth(NVGcontext *ctx, const std::string &face,
+                             float size, const std::string &text) {
+    int font = findFont(face);
+    if (font >= 0)
+        return textWidth(font, size, text.data(), text.data() + text.size(), 0.f,
+                         pixelRatio(ctx));
+    LayoutLock lock;
+    nvgFontFace(ctx, face.c_str());
+    nvgFontSize(ctx, size);
+    return nvgTextBounds(ctx, 0, 0, text.c_str(), nullptr, nullptr);
+}
+
+float TextMetrics::textBounds(NVGcontext *ctx, const std::string &face,
+                              float size, const std::string &text, float *bounds) {
+    int font = findFont(face);
+    if (font >= 0)
+        return textBounds(font, size, text.data(), text.data() + text.size(), bounds, 0.f,
+                          pixelRatio(ctx));
+    LayoutLock lock;
+    nvgFontFace(ctx, face.c_str());
+    nvgFontSize(ctx, size);
+    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_BASELINE);
+    return nvgTextBounds(ctx, 0, 0, text.c_str(), nullptr, bounds);
+}
+
+float TextMetrics::glyphPositions(NVGcontext *ctx, const std::string &face, float size,
+                                  const std::string &text,
+                                  std::vector<GlyphPosition> &positions) {
+    int font = findFont(face);
+    if (font >= 0)
+        return glyphPositions(font, size, text.data(), text.data() + text.size(), positions,
+                              0.f, pixelRatio(ctx));
+
+    LayoutLock lock;
+    nvgFontFace(ctx, face.c_str());
+    nvgFontSize(ctx, size);
+    nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_BASELINE);
+    positions.clear();
+
+    /* NanoVG reports a bounded number of glyphs per call, so continue from
+       the last glyph of each batch */
+    const int batch = 256;
+    NVGglyphPosition glyphs[batch];
+    const char *string = text.data(), *end = string + text.size();
+    float x = 0.f;
+    while (string < end) {
+        int count = nvgTextGlyphPositions(ctx, x, 0.f, string, end, glyphs, batch);
+        if (count <= 0)
+            break;
+        int keep = count < batch ? count : count - 1;
+        for (int i = 0; i < keep; ++i)
+            positions.push_back({ (size_t) (glyphs[i].str - text.data()), glyphs[i].x,
+                                  glyphs[i].minx, glyphs[i].maxx });
+        if (count < batch)
+            break;
+        string = glyphs[count - 1].str;
+        x = glyphs[count - 1].x;
+    }
+    float start = positions.empty() ? 0.f : positions.back().x;
+    const char *last = positions.empty() ? text.data() : text.data() + positions.back().offset;
+    return start + nvgTextBounds(ctx, 0, 0, last, end, nullptr);
+}
+
+NAMESPACE_END(nanogui)
@@ -14,7 +14,7 @@
 #include <nanogui/theme.h>
 #include <nanogui/opengl.h>
 #include <nanogui/entypo.h>
-#include <nanogui_resources.h>
+#include <nanogui/resourcepack.h>
 
 NAMESPACE_BEGIN(nanogui)
 
@@ -80,12 +80,14 @@ Theme::Theme(NVGcontext *ctx) {
     mTextBoxUpIcon                    = ENTYPO_ICON_CHEVRON_UP;
     mTextBoxDownIcon                  = ENTYPO_ICON_CHEVRON_DOWN;
 
-    mFontNormal = nvgCreateFontMem(ctx, "sans", roboto_regular_ttf,
-                                   roboto_regular_ttf_size, 0);
-    mFontBold = nvgCreateFontMem(ctx, "sans-bold", roboto_bold_ttf,
-                                 roboto_bold_ttf_size, 0);
-    mFontIcons = nvgCreateFontMem(ctx, "icons", entypo_ttf,
-                                  entypo_ttf_size, 0);
+    /* The font data stays in the resource pack; NanoVG does not copy it */
+    auto createFont = [ctx](const char *name, const char *resource) {
+        ResourcePack::Resource r = ResourcePack::resource(resource);
+        return nvgCreateFontMem(ctx, name, (unsigned char *) r.data, (int) r.size, 0);
+    };
+    mFontNormal = createFont("sans", "Roboto-Regular.ttf");
+    mFontBold = createFont("sans-bold", "Roboto-Bold.ttf");
+    mFontIcons = createFont("icons", "entypo.ttf");
     if (mFontNormal == -1 || mFontBold == -1 || mFontIcons == -1)
         throw std::runtime_error("Could not load fonts!");
 }
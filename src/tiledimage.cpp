@@ -0,0 +1,268 @@
+/*
+    src/tiledimage.cpp -- Images that are split into a pyramid of tiles,
+    for displaying images larger than a texture in an ImageView
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/tiledimage.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+NAMESPACE_BEGIN(nanogui)
+
+/* Layout of pyramid files (all integers are little endian):
+
+     header:  char magic[4] = "NGTI", uint32 version, uint32 width, uint32 height,
+              uint32 tileSize, uint32 levelCount, uint32 reserved[2]
+     tiles:   all tiles of level 0, then of level 1 and so on, each level row
+              by row; every tile holds tileSize x tileSize RGBA pixels, and
+              the pixels outside of the image are zero
+
+   Since all tiles have the same size, the offset of a tile follows from
+   its position and no index is needed. */
+
+namespace {
+    const char tileMagic[4] = { 'N', 'G', 'T', 'I' };
+    const uint32_t tileVersion = 1;
+    const size_t tileHeaderSize = 32;
+
+    uint32_t readInt(const uint8_t *p) {
+        return (uint32_t) p[0] | ((uint32_t) p[1] << 8) |
+               ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+    }
+
+    void writeInt(std::string &out, uint32_t value) {
+        for (int i = 0; i < 4; ++i)
+            out += (char) ((value >> (8 * i)) & 0xFF);
+    }
+
+    /// Return the width, height and tile size stored in the header of a pyramid file
+    Vector3i readHeader(const std::string &filename) {
+        std::ifstream is(filename, std::ios::binary);
+        uint8_t header[tileHeaderSize];
+        if (!is.read((char *) header, tileHeaderSize) ||
+            memcmp(header, tileMagic, 4) != 0 || readInt(header + 4) != tileVersion ||
+            readInt(header + 16) > 16384)
+            throw std::runtime_error("Invalid tiled image \"" + filename + "\"!");
+        return Vector3i((int) readInt(header + 8), (int) readInt(header + 12),
+                        (int) readInt(header + 16));
+    }
+
+    void unmap(const uint8_t *data, size_t size, void *mapping) {
+#if defined(_WIN32)
+        (void) size;
+        UnmapViewOfFile(data);
+        CloseHandle((HANDLE) mapping);
+#else
+        (void) data;
+        munmap(mapping, size);
+#endif
+    }
+}
+
+TiledImage::TiledImage(const Vector2i &size, int tileSize)
+    : mSize(size), mTileSize(tileSize), mLevelCount(1) {
+    if (size.minCoeff() <= 0 || tileSize <= 0)
+        throw std::runtime_error("TiledImage: invalid size!");
+    while (levelSize(mLevelCount - 1).maxCoeff() > mTileSize)
+        mLevelCount++;
+}
+
+Vector2i TiledImage::levelSize(int level) const {
+    int64_t scale = (int64_t) 1 << level;
+    return Vector2i((int) std::max<int64_t>((mSize.x() + scale - 1) / scale, 1),
+                    (int) std::max<int64_t>((mSize.y() + scale - 1) / scale, 1));
+}
+
+Vector2i TiledImage::tileCount(int level) const {
+    Vector2i size = levelSize(level);
+    return Vector2i((size.x() + mTileSize - 1) / mTileSize,
+                    (size.y() + mTileSize - 1) / mTileSize);
+}
+
+Vector2i TiledImage::tilePixels(int level, const Vector2i &tile) const {
+    Vector2i size = levelSize(level);
+    return Vector2i(std::min(mTileSize, size.x() - tile.x() * mTileSize),
+                    std::min(mTileSize, size.y() - tile.y() * mTileSize));
+}
+
+MemoryTiledImage::MemoryTiledImage(const Vector2i &size, std::vector<uint8_t> pixels,
+                                   int tileSize)
+    : TiledImage(size, tileSize), mLevels(mLevelCount), mLevelFlags(mLevelCount) {
+    if (pixels.size() != (size_t) size.x() * size.y() * 4)
+        throw std::runtime_error("MemoryTiledImage: pixel data does not match the size!");
+    mLevels[0] = std::move(pixels);
+}
+
+const std::vector<uint8_t> &MemoryTiledImage::level(int l) const {
+    /* Level 0 never changes, and every other level is written exactly once
+       before call_once() returns, so readers need no lock */
+    if (l == 0)
+        return mLevels[0];
+    const std::vector<uint8_t> &src = level(l - 1);
+    std::call_once(mLevelFlags[l], [&]() {
+        /* Average 2x2 blocks of the previous level (fewer at odd edges) */
+        Vector2i srcSize = levelSize(l - 1), dstSize = levelSize(l);
+        std::vector<uint8_t> dst((size_t) dstSize.x() * dstSize.y() * 4);
+        for (int y = 0; y < dstSize.y(); ++y) {
+            int y0 = 2 * y, y1 = std::min(2 * y + 1, srcSize.y() - 1);
+            for (int x = 0; x < dstSize.x(); ++x) {
+                int x0 = 2 * x, x1 = std::min(2 * x + 1, srcSize.x() - 1);
+                const uint8_t *p[4] = {
+                    &src[((size_t) y0 * srcSize.x() + x0) * 4],
+                    &src[((size_t) y0 * srcSize.x() + x1) * 4],
+                    &src[((size_t) y1 * srcSize.x() + x0) * 4],
+                    &src[((size_t) y1 * srcSize.x() + x1) * 4]
+                };
+                uint8_t *out = &dst[((size_t) y * dstSize.x() + x) * 4];
+                for (int c = 0; c < 4; ++c)
+                    out[c] = (uint8_t) ((p[0][c] + p[1][c] + p[2][c] + p[3][c] + 2) / 4);
+            }
+        }
+        mLevels[l].swap(dst);
+    });
+    return mLevels[l];
+}
+
+bool MemoryTiledImage::readTile(int l, const Vector2i &tile, uint8_t *pixels) const {
+    if (l < 0 || l >= mLevelCount || (tile.array() < 0).any() ||
+        (tile.array() >= tileCount(l).array()).any())
+        return false;
+    const std::vector<uint8_t> &data = level(l);
+    Vector2i size = levelSize(l), valid = tilePixels(l, tile);
+    for (int y = 0; y < valid.y(); ++y) {
+        size_t row = (size_t) tile.y() * mTileSize + y;
+        memcpy(pixels + (size_t) y * mTileSize * 4,
+               &data[(row * size.x() + (size_t) tile.x() * mTileSize) * 4],
+               (size_t) valid.x() * 4);
+    }
+    return true;
+}
+
+FileTiledImage::FileTiledImage(const std::string &filename)
+    : FileTiledImage(filename, readHeader(filename)) { }
+
+FileTiledImage::FileTiledImage(const std::string &filename, const Vector3i &header)
+    : TiledImage(header.head<2>(), header.z()), mData(nullptr), mSize(0),
+      mMapping(nullptr) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    LARGE_INTEGER size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size)) {
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+        throw std::runtime_error("Could not open tiled image \"" + filename + "\"!");
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    const void *data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!data) {
+        if (mapping)
+            CloseHandle(mapping);
+        throw std::runtime_error("Could not map tiled image \"" + filename + "\"!");
+    }
+    mMapping = mapping;
+    mData = (const uint8_t *) data;
+    mSize = (size_t) size.QuadPart;
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        if (fd >= 0)
+            close(fd);
+        throw std::runtime_error("Could not open tiled image \"" + filename + "\"!");
+    }
+    void *data = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        throw std::runtime_error("Could not map tiled image \"" + filename + "\"!");
+    mMapping = data;
+    mData = (const uint8_t *) data;
+    mSize = (size_t) st.st_size;
+#endif
+
+    /* Check the file size once, so that reading a tile needs no bounds checks */
+    if (mSize < tileHeaderSize || readInt(mData + 20) != (uint32_t) mLevelCount ||
+        mSize < tileOffset(mLevelCount, Vector2i::Zero())) {
+        unmap(mData, mSize, mMapping);
+        throw std::runtime_error("Invalid tiled image \"" + filename + "\"!");
+    }
+}
+
+FileTiledImage::~FileTiledImage() {
+    unmap(mData, mSize, mMapping);
+}
+
+uint64_t FileTiledImage::tileOffset(int level, const Vector2i &tile) const {
+    uint64_t index = 0;
+    for (int l = 0; l < level; ++l)
+        index += (uint64_t) tileCount(l).prod();
+    index += (uint64_t) tile.y() * tileCount(level).x() + tile.x();
+    return tileHeaderSize + index * mTileSize * mTileSize * 4;
+}
+
+bool FileTiledImage::readTile(int level, const Vector2i &tile, uint8_t *pixels) const {
+    if (level < 0 || level >= mLevelCount || (tile.array() < 0).any() ||
+        (tile.array() >= tileCount(level).array()).any())
+        return false;
+    memcpy(pixels, mData + tileOffset(level, tile), (size_t) mTileSize * mTileSize * 4);
+    return true;
+}
+
+void FileTiledImage::write(const std::string &filename, const TiledImage &image) {
+    std::string header(tileMagic, 4);
+    writeInt(header, tileVersion);
+    writeInt(header, (uint32_t) image.size().x());
+    writeInt(header, (uint32_t) image.size().y());
+    writeInt(header, (uint32_t) image.tileSize());
+    writeInt(header, (uint32_t) image.levelCount());
+    writeInt(header, 0);
+    writeInt(header, 0);
+
+    std::ofstream os(filename, std::ios::binary);
+    os.write(header.data(), (std::streamsize) header.size());
+
+    size_t tileBytes = (size_t) image.tileSize() * image.tileSize() * 4;
+    std::vector<uint8_t> pixels(tileBytes);
+    for (int level = 0; level < image.levelCount() && os; ++level) {
+        Vector2i count = image.tileCount(level);
+        for (int y = 0; y < count.y(); ++y) {
+            for (int x = 0; x < count.x(); ++x) {
+                std::fill(pixels.begin(), pixels.end(), 0);
+                if (!image.readTile(level, Vector2i(x, y), pixels.data()))
+                    throw std::runtime_error("FileTiledImage::write(): could not read a tile!");
+                Vector2i valid = image.tilePixels(level, Vector2i(x, y));
+                /* Clear whatever the source left outside of the image */
+                for (int row = 0; row < image.tileSize(); ++row) {
+                    size_t start = (size_t) row * image.tileSize() * 4;
+                    size_t stop = start + (size_t) image.tileSize() * 4;
+                    std::fill(pixels.begin() + (row < valid.y() ? start + (size_t) valid.x() * 4 : start),
+                              pixels.begin() + stop, 0);
+                }
+                os.write((const char *) pixels.data(), (std::streamsize) tileBytes);
+            }
+        }
+    }
+    os.close();
+    if (!os)
+        throw std::runtime_error("FileTiledImage::write(): could not write \"" + filename + "\"!");
+}
+
+NAMESPACE_END(nanogui)
@@ -0,0 +1,423 @@
+/*
+    src/treeview.cpp -- Virtualized tree which only queries the nodes
+    that are expanded and visible
+
+    NanoGUI was developed by Wenzel Jakob <wenzel.jakob@epfl.ch>.
+    The widget drawing code is based on the NanoVG demo application
+    by Mikko Mononen.
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE.txt file.
+*/
+
+#include <nanogui/treeview.h>
+#include <nanogui/theme.h>
+#include <nanogui/opengl.h>
+#include <nanogui/entypo.h>
+#include <nanogui/serializer/core.h>
+#include <algorithm>
+#include <limits>
+
+NAMESPACE_BEGIN(nanogui)
+
+int TreeModel::icon(uint64_t) const { return 0; }
+
+bool TreeModel::hasChildren(uint64_t node) const { return childCount(node) > 0; }
+
+TreeView::TreeView(Widget *parent)
+    : Widget(parent), mRowHeight(25), mIndent(20), mSelectedRow(-1),
+      mScroll(0.0), mLastClick(0.0) { }
+
+TreeView::~TreeView() { }
+
+void TreeView::setModel(TreeModel *model) {
+    mModel = model;
+    mRoot.reset();
+    if (mModel) {
+        mRoot.reset(new ExpandedNode());
+        mRoot->node = 0;
+        mRoot->index = -1;
+        mRoot->childCount = mRoot->rowCount = mModel->childCount(0);
+        mRoot->parent = nullptr;
+    }
+    mSelectedRow = -1;
+    mScroll = 0.0;
+}
+
+void TreeView::modelChanged() {
+    if (!mRoot)
+        return;
+    validate(mRoot.get());
+    if (mSelectedRow >= rowCount())
+        mSelectedRow = -1;
+}
+
+int TreeView::validate(ExpandedNode *node) {
+    node->childCount = mModel->childCount(node->node);
+
+    auto &children = node->children;
+    children.erase(std::remove_if(children.begin(), children.end(),
+        [&](const std::unique_ptr<ExpandedNode> &child) {
+            return child->index >= node->childCount ||
+                   mModel->child(node->node, child->index) != child->node;
+        }), children.end());
+
+    node->offsets.resize(children.size());
+    int rows = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+        node->offsets[i] = rows;
+        rows += validate(children[i].get());
+    }
+    node->rowCount = node->childCount + rows;
+    return node->rowCount;
+}
+
+void TreeView::updateCounts(ExpandedNode *node) {
+    while (node) {
+        node->offsets.resize(node->children.size());
+        int rows = 0;
+        for (size_t i = 0; i < node->children.size(); ++i) {
+            node->offsets[i] = rows;
+            rows += node->children[i]->rowCount;
+        }
+        node->rowCount = node->childCount + rows;
+        node = node->parent;
+    }
+}
+
+int TreeView::rowCount() const {
+    return mRoot ? mRoot->rowCount : 0;
+}
+
+TreeView::Row TreeView::lookup(int row) const {
+    Row result;
+    if (row < 0 || row >= rowCount())
+        return result;
+
+    ExpandedNode *node = mRoot.get();
+    int base = 0, depth = 0, parentRow = -1;
+
+    while (true) {
+        /* Find the last expanded child that starts at or before 'row' */
+        const auto &children = node->children;
+        int rel = row - base, lo = 0, hi = (int) children.size();
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (children[mid]->index + node->offsets[mid] <= rel)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        int index = rel;
+        if (lo > 0) {
+            ExpandedNode *child = children[lo - 1].get();
+            int pos = child->index + node->offsets[lo - 1];
+            if (rel == pos) {
+                result.node = child->node;
+                result.index = child->index;
+                result.expanded = child;
+                break;
+            } else if (rel <= pos + child->rowCount) {
+                /* The row is a descendant of this child */
+                parentRow = base + pos;
+                base += pos + 1;
+                node = child;
+                depth++;
+                continue;
+            }
+            index = rel - node->offsets[lo - 1] - child->rowCount;
+        }
+
+        result.node = mModel->child(node->node, index);
+        result.index = index;
+        break;
+    }
+
+    result.depth = depth;
+    result.parentRow = parentRow;
+    result.parent = node;
+    return result;
+}
+
+void TreeView::setExpanded(int row, bool expanded) {
+    Row info = lookup(row);
+    if (info.depth < 0 || (info.expanded != nullptr) == expanded)
+        return;
+
+    /* Keep the rows above the changed node in place */
+    double offset = scrollOffset();
+    ExpandedNode *parent = info.parent;
+    auto &children = parent->children;
+
+    if (expanded) {
+        if (!mModel->hasChildren(info.node))
+            return;
+        ExpandedNode *node = new ExpandedNode();
+        node->node = info.node;
+        node->index = info.index;
+        node->childCount = node->rowCount = mModel->childCount(info.node);
+        node->parent = parent;
+        auto it = std::upper_bound(children.begin(), children.end(), info.index,
+            [](int index, const std::unique_ptr<ExpandedNode> &child) {
+                return index < child->index;
+            });
+        children.emplace(it, node);
+        updateCounts(parent);
+        if (mSelectedRow > row)
+            mSelectedRow += node->rowCount;
+    } else {
+        int removed = info.expanded->rowCount;
+        children.erase(std::find_if(children.begin(), children.end(),
+            [&](const std::unique_ptr<ExpandedNode> &child) {
+                return child.get() == info.expanded;
+            }));
+        updateCounts(parent);
+        if (mSelectedRow > row + removed)
+            mSelectedRow -= removed;
+        else if (mSelectedRow > row)
+            mSelectedRow = row;
+    }
+
+    double range = contentHeight() - mSize.y();
+    mScroll = range > 0 ? std::max(0.0, std::min(1.0, offset / range)) : 0.0;
+}
+
+void TreeView::collapseAll() {
+    if (!mRoot)
+        return;
+    mRoot->children.clear();
+    updateCounts(mRoot.get());
+    mSelectedRow = -1;
+    mScroll = 0.0;
+}
+
+void TreeView::scrollToRow(int row) {
+    double range = contentHeight() - mSize.y();
+    if (row < 0 || row >= rowCount() || range <= 0)
+        return;
+    double offset = scrollOffset(),
+           top = (double) row * mRowHeight,
+           bottom = top + mRowHeight;
+    if (top < offset)
+        offset = top;
+    else if (bottom > offset + mSize.y())
+        offset = bottom - mSize.y();
+    mScroll = std::max(0.0, std::min(1.0, offset / range));
+}
+
+int TreeView::rowAt(const Vector2i &p) const {
+    Vector2i d = p - mPos;
+    int scrollbarWidth = contentHeight() > mSize.y() ? 12 : 0;
+    if (d.x() < 0 || d.y() < 0 || d.x() >= mSize.x() - scrollbarWidth ||
+        d.y() >= mSize.y())
+        return -1;
+    int row = (int) ((d.y() + scrollOffset()) / mRowHeight);
+    return row < rowCount() ? row : -1;
+}
+
+void TreeView::selectRow(int row) {
+    if (row == mSelectedRow)
+        return;
+    mSelectedRow = row;
+    scrollToRow(row);
+    if (mCallback && row >= 0)
+        mCallback(node(row));
+}
+
+Vector2i TreeView::preferredSize(NVGcontext *) const {
+    return Vector2i(mIndent * 8 + 12,
+        (int) std::min(contentHeight(), (double) std::numeric_limits<int>::max()));
+}
+
+bool TreeView::mouseButtonEvent(const Vector2i &p, int button, bool down,
+                                int modifiers) {
+    if (Widget::mouseButtonEvent(p, button, down, modifiers))
+        return true;
+
+    if (!down || button != GLFW_MOUSE_BUTTON_1)
+        return false;
+
+    int row = rowAt(p);
+    if (row < 0)
+        return true;
+
+    Row info = lookup(row);
+    int x = p.x() - mPos.x() - info.depth * mIndent;
+    double time = glfwGetTime();
+    if (x >= 0 && x < mIndent) {
+        setExpanded(row, info.expanded == nullptr);
+    } else if (row == mSelectedRow && time - mLastClick < 0.25) {
+        setExpanded(row, info.expanded == nullptr);
+    } else {
+        selectRow(row);
+    }
+    mLastClick = time;
+    return true;
+}
+
+bool TreeView::mouseDragEvent(const Vector2i &p, const Vector2i &rel,
+                              int button, int modifiers) {
+    if (contentHeight() > mSize.y()) {
+        float scrollh = std::max(20.0f, (float) (height() *
+            std::min(1.0, height() / contentHeight())));
+
+        mScroll = std::max(0.0, std::min(1.0,
+            mScroll + rel.y() / (double) (mSize.y() - 8 - scrollh)));
+        return true;
+    } else {
+        return Widget::mouseDragEvent(p, rel, button, modifiers);
+    }
+}
+
+bool TreeView::scrollEvent(const Vector2i &p, const Vector2f &rel) {
+    double range = contentHeight() - mSize.y();
+    if (range > 0) {
+        double offset = scrollOffset() - rel.y() * 3 * mRowHeight;
+        mScroll = std::max(0.0, std::min(1.0, offset / range));
+        return true;
+    } else {
+        return Widget::scrollEvent(p, rel);
+    }
+}
+
+bool TreeView::keyboardEvent(int key, int scancode, int action, int modifiers) {
+    int rows = rowCount();
+    if (!mFocused || rows == 0 ||
+        (action != GLFW_PRESS && action != GLFW_REPEAT))
+        return Widget::keyboardEvent(key, scancode, action, modifiers);
+
+    int page = std::max(1, mSize.y() / mRowHeight), index = mSelectedRow;
+    switch (key) {
+        case GLFW_KEY_UP:        index -= 1; break;
+        case GLFW_KEY_DOWN:      index += 1; break;
+        case GLFW_KEY_PAGE_UP:   index -= page; break;
+        case GLFW_KEY_PAGE_DOWN: index += page; break;
+        case GLFW_KEY_HOME:      index = 0; break;
+        case GLFW_KEY_END:       index = rows - 1; break;
+        case GLFW_KEY_RIGHT:
+            if (index >= 0) {
+                if (!expanded(index))
+                    setExpanded(index, true);
+                else if (index + 1 < rowCount() && depth(index + 1) > depth(index))
+                    index += 1;
+            }
+            break;
+        case GLFW_KEY_LEFT:
+            if (index >= 0) {
+                if (expanded(index))
+                    setExpanded(index, false);
+                else if (parentRow(index) >= 0)
+                    index = parentRow(index);
+            }
+            break;
+        default:
+            return Widget::keyboardEvent(key, scancode, action, modifiers);
+    }
+
+    selectRow(std::max(0, std::min(rowCount() - 1, index)));
+    return true;
+}
+
+void TreeView::draw(NVGcontext *ctx) {
+    Widget::draw(ctx);
+
+    int rows = rowCount();
+    double offset = scrollOffset();
+    bool scrollbar = contentHeight() > mSize.y();
+    int width = mSize.x() - (scrollbar ? 12 : 0);
+
+    nvgSave(ctx);
+    nvgIntersectScissor(ctx, mPos.x(), mPos.y(), width, mSize.y());
+
+    int first = (int) (offset / mRowHeight),
+        last = std::min(rows, (int) std::ceil((offset + mSize.y()) / mRowHeight));
+
+    if (mSelectedRow >= first && mSelectedRow < last) {
+        nvgBeginPath(ctx);
+        nvgRect(ctx, mPos.x(), mPos.y() + (float) ((double) mSelectedRow * mRowHeight - offset),
+                width, mRowHeight);
+        nvgFillColor(ctx, mTheme->mButtonGradientTopFocused);
+        nvgFill(ctx);
+    }
+
+    auto expandIcon = utf8(ENTYPO_ICON_CHEVRON_SMALL_RIGHT),
+         collapseIcon = utf8(ENTYPO_ICON_CHEVRON_SMALL_DOWN);
+    Color textColor = mEnabled ? mTheme->mTextColor : mTheme->mDisabledTextColor;
+
+    for (int row = first; row < last; ++row) {
+        Row info = lookup(row);
+        float x = mPos.x() + info.depth * mIndent,
+              y = mPos.y() + (float) ((double) row * mRowHeight - offset) + mRowHeight * 0.5f;
+
+        nvgFontFace(ctx, "icons");
+        nvgFontSize(ctx, fontSize() * icon_scale());
+        nvgTextAlign(ctx, NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
+        nvgFillColor(ctx, mTheme->mIconColor);
+        if (info.expanded)
+            nvgText(ctx, x + mIndent * 0.5f, y, collapseIcon.data(), nullptr);
+        else if (mModel->hasChildren(info.node))
+            nvgText(ctx, x + mIndent * 0.5f, y, expandIcon.data(), nullptr);
+        x += mIndent;
+
+        if (int icon = mModel->icon(info.node)) {
+            auto iconStr = utf8(icon);
+            nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+            nvgText(ctx, x, y, iconStr.data(), nullptr);
+            x += nvgTextBounds(ctx, 0, 0, iconStr.data(), nullptr, nullptr) + 4;
+        }
+
+        nvgFontFace(ctx, "sans");
+        nvgFontSize(ctx, fontSize());
+        nvgTextAlign(ctx, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+        nvgFillColor(ctx, textColor);
+        nvgText(ctx, x, y, mModel->text(info.node).c_str(), nullptr);
+    }
+
+    nvgRestore(ctx);
+
+    if (!scrollbar)
+        return;
+
+    float scrollh = std::max(20.0f, (float) (height() *
+        std::min(1.0, height() / contentHeight())));
+    float scroll = (float) mScroll;
+
+    NVGpaint paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 + 1, mPos.y() + 4 + 1, 8,
+        mSize.y() - 8, 3, 4, Color(0, 32), Color(0, 92));
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12, mPos.y() + 4, 8,
+                   mSize.y() - 8, 3);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+
+    paint = nvgBoxGradient(
+        ctx, mPos.x() + mSize.x() - 12 - 1,
+        mPos.y() + 4 + (mSize.y() - 8 - scrollh) * scroll - 1, 8, scrollh,
+        3, 4, Color(220, 100), Color(128, 100));
+
+    nvgBeginPath(ctx);
+    nvgRoundedRect(ctx, mPos.x() + mSize.x() - 12 + 1,
+                   mPos.y() + 4 + 1 + (mSize.y() - 8 - scrollh) * scroll, 8 - 2,
+                   scrollh - 2, 2);
+    nvgFillPaint(ctx, paint);
+    nvgFill(ctx);
+}
+
+void TreeView::save(Serializer &s) const {
+    Widget::save(s);
+    s.set("rowHeight", mRowHeight);
+    s.set("indent", mIndent);
+    s.set("scroll", mScroll);
+}
+
+bool TreeView::load(Serializer &s) {
+    if (!Widget::load(s)) return false;
+    if (!s.get("rowHeight", mRowHeight)) return false;
+    if (!s.get("indent", mIndent)) return false;
+    if (!s.get("scroll", mScroll)) return false;
+    return true;
+}
+
+NAMESPACE_END(nanogui)
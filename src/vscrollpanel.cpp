@@ -18,34 +18,41 @@
 NAMESPACE_BEGIN(nanogui)
 
 VScrollPanel::VScrollPanel(Widget *parent)
-    : Widget(parent), mChildPreferredHeight(0), mScroll(0.0f), mUpdateLayout(false) { }
-
-void VScrollPanel::performLayout(NVGcontext *ctx) {
-    Widget::performLayout(ctx);
-
-    if (mChildren.empty())
-        return;
-    if (mChildren.size() > 1)
-        throw std::runtime_error("VScrollPanel should have one child.");
+    : Widget(parent), mChildPreferredHeight(0), mScroll(0.0f),
+      mScrollTarget(0.0f), mLastFrame(0.0), mSmoothScrolling(true),
+      mUpdateLayout(false) { }
 
+void VScrollPanel::layoutChild(NVGcontext *ctx) {
     Widget *child = mChildren[0];
-    mChildPreferredHeight = child->preferredSize(ctx).y();
+    mChildPreferredHeight = child->cachedPreferredSize(ctx).y();
 
     if (mChildPreferredHeight > mSize.y()) {
-        child->setPosition(Vector2i(0, -mScroll*(mChildPreferredHeight - mSize.y())));
+        child->setPosition(Vector2i(0, childOffset()));
         child->setSize(Vector2i(mSize.x()-12, mChildPreferredHeight));
     } else {
         child->setPosition(Vector2i::Zero());
         child->setSize(mSize);
-        mScroll = 0;
+        mScroll = mScrollTarget = 0;
     }
     child->performLayout(ctx);
+    mUpdateLayout = false;
+}
+
+void VScrollPanel::performLayout(NVGcontext *ctx) {
+    Widget::performLayout(ctx);
+
+    if (mChildren.empty())
+        return;
+    if (mChildren.size() > 1)
+        throw std::runtime_error("VScrollPanel should have one child.");
+
+    layoutChild(ctx);
 }
 
 Vector2i VScrollPanel::preferredSize(NVGcontext *ctx) const {
     if (mChildren.empty())
         return Vector2i::Zero();
-    return mChildren[0]->preferredSize(ctx) + Vector2i(12, 0);
+    return mChildren[0]->cachedPreferredSize(ctx) + Vector2i(12, 0);
 }
 
 bool VScrollPanel::mouseDragEvent(const Vector2i &p, const Vector2i &rel,
@@ -54,9 +61,8 @@ bool VScrollPanel::mouseDragEvent(const Vector2i &p, const Vector2i &rel,
         float scrollh = height() *
             std::min(1.0f, height() / (float)mChildPreferredHeight);
 
-        mScroll = std::max((float) 0.0f, std::min((float) 1.0f,
+        mScroll = mScrollTarget = std::max((float) 0.0f, std::min((float) 1.0f,
                      mScroll + rel.y() / (float)(mSize.y() - 8 - scrollh)));
-        mUpdateLayout = true;
         return true;
     } else {
         return Widget::mouseDragEvent(p, rel, button, modifiers);
@@ -69,9 +75,14 @@ bool VScrollPanel::scrollEvent(const Vector2i &p, const Vector2f &rel) {
         float scrollh = height() *
             std::min(1.0f, height() / (float)mChildPreferredHeight);
 
-        mScroll = std::max((float) 0.0f, std::min((float) 1.0f,
-                mScroll - scrollAmount / (float)(mSize.y() - 8 - scrollh)));
-        mUpdateLayout = true;
+        /* Successive wheel ticks accumulate in the target, which draw()
+           approaches gradually */
+        if (mScroll == mScrollTarget)
+            mLastFrame = glfwGetTime();
+        mScrollTarget = std::max((float) 0.0f, std::min((float) 1.0f,
+                mScrollTarget - scrollAmount / (float)(mSize.y() - 8 - scrollh)));
+        if (!mSmoothScrolling)
+            mScroll = mScrollTarget;
         return true;
     } else {
         return Widget::scrollEvent(p, rel);
@@ -82,13 +93,27 @@ void VScrollPanel::draw(NVGcontext *ctx) {
     if (mChildren.empty())
         return;
     Widget *child = mChildren[0];
-    child->setPosition(Vector2i(0, -mScroll*(mChildPreferredHeight - mSize.y())));
-    mChildPreferredHeight = child->preferredSize(ctx).y();
-    float scrollh = height() *
-        std::min(1.0f, height() / (float) mChildPreferredHeight);
 
+    /* Changes of the child are handled by updateLayout() and scrolling
+       merely moves it, so only a freshly loaded panel needs a layout here */
     if (mUpdateLayout)
-        child->performLayout(ctx);
+        layoutChild(ctx);
+
+    if (mScroll != mScrollTarget) {
+        double now = glfwGetTime();
+        float dt = (float) std::min(now - mLastFrame, 0.1);
+        mLastFrame = now;
+        mScroll += (mScrollTarget - mScroll) * (1.0f - std::exp(-dt * 15.0f));
+        if (std::abs(mScrollTarget - mScroll) *
+                (mChildPreferredHeight - mSize.y()) < 0.5f)
+            mScroll = mScrollTarget;
+        else
+            glfwPostEmptyEvent(); /* Request another frame */
+    }
+
+    child->setPosition(Vector2i(0, childOffset()));
+    float scrollh = height() *
+        std::min(1.0f, height() / (float) mChildPreferredHeight);
 
     nvgSave(ctx);
     nvgTranslate(ctx, mPos.x(), mPos.y());
@@ -132,6 +157,8 @@ bool VScrollPanel::load(Serializer &s) {
     if (!Widget::load(s)) return false;
     if (!s.get("childPreferredHeight", mChildPreferredHeight)) return false;
     if (!s.get("scroll", mScroll)) return false;
+    mScrollTarget = mScroll;
+    mUpdateLayout = true;
     return true;
 }
 
@@ -16,20 +16,125 @@
 #include <nanogui/opengl.h>
 #include <nanogui/screen.h>
 #include <nanogui/serializer/core.h>
+#include <nanogui/textmetrics.h>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 NAMESPACE_BEGIN(nanogui)
 
+static std::atomic<int> __nanogui_layout_threads { 1 };
+static std::atomic<int> __nanogui_parallel_layouts { 0 };
+static std::recursive_mutex __nanogui_layout_mutex;
+static thread_local bool __nanogui_layout_worker = false;
+
+/* Threads which help the calling thread in Widget::forEachParallel(). They
+   are started on first use and kept until nanogui::shutdown(). */
+struct LayoutWorkers {
+    std::mutex mutex;
+    std::condition_variable wakeup, finished;
+    std::vector<std::thread> threads;
+    /// Serializes parallel layouts started by different threads
+    std::mutex dispatch;
+    const std::function<void()> *job = nullptr;
+    /// Number of workers that may still join the current job
+    int slots = 0;
+    /// Number of workers that are running the current job
+    int active = 0;
+    bool stop = false;
+
+    ~LayoutWorkers() { join(); }
+
+    /// Run \c func on the calling thread and on up to \c helpers workers
+    void run(const std::function<void()> &func, int helpers) {
+        std::lock_guard<std::mutex> guard(dispatch);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while ((int) threads.size() < helpers)
+                threads.emplace_back([this]() { work(); });
+            job = &func;
+            slots = helpers;
+        }
+        wakeup.notify_all();
+
+        func();
+
+        /* Workers which did not pick up the job yet must not start it */
+        std::unique_lock<std::mutex> lock(mutex);
+        slots = 0;
+        finished.wait(lock, [this]() { return active == 0; });
+        job = nullptr;
+    }
+
+    void work() {
+        __nanogui_layout_worker = true;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wakeup.wait(lock, [this]() { return stop || slots > 0; });
+            if (stop)
+                return;
+            slots--;
+            active++;
+            const std::function<void()> *current = job;
+            lock.unlock();
+            (*current)();
+            lock.lock();
+            if (--active == 0)
+                finished.notify_all();
+        }
+    }
+
+    void join() {
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            stop = true;
+        }
+        wakeup.notify_all();
+        for (auto &thread : threads)
+            thread.join();
+        threads.clear();
+        stop = false;
+    }
+};
+
+static LayoutWorkers &layoutWorkers() {
+    static LayoutWorkers workers;
+    return workers;
+}
+
+void __nanogui_join_layout_workers() {
+    layoutWorkers().join();
+}
+
+LayoutLock::LayoutLock() : mLocked(__nanogui_parallel_layouts > 0) {
+    if (mLocked)
+        __nanogui_layout_mutex.lock();
+}
+
+LayoutLock::~LayoutLock() {
+    if (mLocked)
+        __nanogui_layout_mutex.unlock();
+}
+
 Widget::Widget(Widget *parent)
     : mParent(nullptr), mTheme(nullptr), mLayout(nullptr),
       mPos(Vector2i::Zero()), mSize(Vector2i::Zero()),
       mFixedSize(Vector2i::Zero()), mVisible(true), mEnabled(true),
       mFocused(false), mMouseFocus(false), mTooltip(""), mFontSize(-1.0f),
-      mIconExtraScale(1.0f), mCursor(Cursor::Arrow) {
+      mIconExtraScale(1.0f), mCursor(Cursor::Arrow),
+      mPreferredSize(Vector2i::Zero()), mPreferredSizeValid(false),
+      mPreferredSizeIsSize(false),
+      mLastLayoutSize(-1, -1), mLayoutDirty(false), mSubtreeDirty(false) {
     if (parent)
         parent->addChild(this);
 }
 
 Widget::~Widget() {
+    if (mLayout)
+        mLayout->mOwners.erase(std::remove(mLayout->mOwners.begin(),
+                                           mLayout->mOwners.end(), this),
+                               mLayout->mOwners.end());
     for (auto child : mChildren) {
         if (child)
             child->decRef();
@@ -40,10 +145,22 @@ void Widget::setTheme(Theme *theme) {
     if (mTheme.get() == theme)
         return;
     mTheme = theme;
+    invalidateLayout();
     for (auto child : mChildren)
         child->setTheme(theme);
 }
 
+void Widget::setLayout(Layout *layout) {
+    if (mLayout)
+        mLayout->mOwners.erase(std::remove(mLayout->mOwners.begin(),
+                                           mLayout->mOwners.end(), this),
+                               mLayout->mOwners.end());
+    mLayout = layout;
+    if (mLayout)
+        mLayout->mOwners.push_back(this);
+    invalidateLayout();
+}
+
 int Widget::fontSize() const {
     return (mFontSize < 0 && mTheme) ? mTheme->mStandardFontSize : mFontSize;
 }
@@ -51,16 +168,169 @@ int Widget::fontSize() const {
 Vector2i Widget::preferredSize(NVGcontext *ctx) const {
     if (mLayout)
         return mLayout->preferredSize(ctx, this);
-    else
-        return mSize;
+    /* setSize() does not invalidate the layout, so this is not cached */
+    mPreferredSizeIsSize = true;
+    return mSize;
+}
+
+static std::atomic<size_t> __nanogui_measure_count { 0 };
+
+Vector2i Widget::cachedPreferredSize(NVGcontext *ctx) const {
+    if (!mPreferredSizeValid) {
+        mPreferredSizeIsSize = false;
+        mPreferredSize = preferredSize(ctx);
+        mPreferredSizeValid = !mPreferredSizeIsSize;
+        ++__nanogui_measure_count;
+    }
+    return mPreferredSize;
+}
+
+void Widget::invalidateLayout() {
+    /* The parents may be shared with subtrees on other threads */
+    LayoutLock lock;
+    mLayoutDirty = true;
+    markLayoutDirty();
+}
+
+void Widget::markLayoutDirty() {
+    if (!mSubtreeDirty) {
+        /* Remember the size that the parent's layout is based on */
+        mLastLayoutSize = mPreferredSizeValid
+            ? Vector2i(mFixedSize.x() ? mFixedSize.x() : mPreferredSize.x(),
+                       mFixedSize.y() ? mFixedSize.y() : mPreferredSize.y())
+            : Vector2i(-1, -1);
+        mSubtreeDirty = true;
+    }
+    mPreferredSizeValid = false;
+    if (mParent)
+        mParent->markLayoutDirty();
+}
+
+void Widget::clearLayoutDirty() {
+    mLayoutDirty = mSubtreeDirty = false;
+    for (auto child : mChildren)
+        child->clearLayoutDirty();
+}
+
+Vector2i Widget::layoutSize(NVGcontext *ctx) const {
+    Vector2i pref = cachedPreferredSize(ctx), fix = mFixedSize;
+    return Vector2i(fix.x() ? fix.x() : pref.x(),
+                    fix.y() ? fix.y() : pref.y());
+}
+
+void Widget::updateLayout(NVGcontext *ctx) {
+    if (!mSubtreeDirty)
+        return;
+
+    if (!mParent && !mLayout) {
+        /* The children of the root are placed independently of each other
+           (see performLayout()), so only resize the ones that changed.
+           Windows which were never laid out keep a size set by the
+           application. */
+        mLayoutDirty = mSubtreeDirty = false;
+        std::vector<Widget *> dirty;
+        for (auto c : mChildren)
+            if (c->visible() && c->mSubtreeDirty)
+                dirty.push_back(c);
+        forEachParallel(dirty, [ctx](Widget *c) {
+            Vector2i size = c->layoutSize(ctx);
+            if (size != c->mLastLayoutSize) {
+                if (c->mLastLayoutSize.x() >= 0 || c->mSize == Vector2i::Zero())
+                    c->setSize(size);
+                /* Invalidations raised during the layout carry over to the next pass */
+                c->clearLayoutDirty();
+                c->performLayout(ctx);
+            } else {
+                c->updateLayout(ctx);
+            }
+        });
+        return;
+    }
+
+    /* The arrangement of the children only needs to be recomputed if this
+       widget itself was invalidated or if the size of a child changed */
+    bool relayout = mLayoutDirty;
+    for (auto c : mChildren) {
+        if (relayout)
+            break;
+        if (c->visible() && c->mSubtreeDirty)
+            relayout = c->layoutSize(ctx) != c->mLastLayoutSize;
+    }
+
+    if (relayout) {
+        clearLayoutDirty();
+        performLayout(ctx);
+    } else {
+        mSubtreeDirty = false;
+        for (auto c : mChildren)
+            if (c->visible())
+                c->updateLayout(ctx);
+    }
+}
+
+size_t Widget::measureCount() { return __nanogui_measure_count; }
+
+void Widget::resetMeasureCount() { __nanogui_measure_count = 0; }
+
+void Widget::setLayoutThreads(int threads) {
+    __nanogui_layout_threads = std::max(threads, 0);
+}
+
+int Widget::layoutThreads() { return __nanogui_layout_threads; }
+
+void Widget::forEachParallel(const std::vector<Widget *> &widgets,
+                             const std::function<void(Widget *)> &func) {
+    int threads = __nanogui_layout_threads;
+    if (threads == 0)
+        threads = (int) std::max(std::thread::hardware_concurrency(), 1u);
+    threads = std::min(threads, (int) widgets.size());
+
+    if (threads < 2 || __nanogui_layout_worker) {
+        for (auto w : widgets)
+            func(w);
+        return;
+    }
+
+    std::atomic<size_t> next { 0 };
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    std::function<void()> worker = [&]() {
+        bool nested = __nanogui_layout_worker;
+        __nanogui_layout_worker = true;
+        for (size_t i = next++; i < widgets.size(); i = next++) {
+            try {
+                func(widgets[i]);
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        __nanogui_layout_worker = nested;
+    };
+
+    /* The calling thread takes part in the work */
+    ++__nanogui_parallel_layouts;
+    layoutWorkers().run(worker, threads - 1);
+    --__nanogui_parallel_layouts;
+
+    if (error)
+        std::rethrow_exception(error);
 }
 
 void Widget::performLayout(NVGcontext *ctx) {
     if (mLayout) {
         mLayout->performLayout(ctx, this);
+    } else if (!mParent) {
+        /* The windows of a screen are independent of each other */
+        forEachParallel(mChildren, [ctx](Widget *c) {
+            c->setSize(c->layoutSize(ctx));
+            c->performLayout(ctx);
+        });
     } else {
         for (auto c : mChildren) {
-            Vector2i pref = c->preferredSize(ctx), fix = c->fixedSize();
+            Vector2i pref = c->cachedPreferredSize(ctx), fix = c->fixedSize();
             c->setSize(Vector2i(
                 fix[0] ? fix[0] : pref[0],
                 fix[1] ? fix[1] : pref[1]
@@ -145,6 +415,7 @@ void Widget::addChild(int index, Widget * widget) {
     widget->incRef();
     widget->setParent(this);
     widget->setTheme(mTheme);
+    invalidateLayout();
 }
 
 void Widget::addChild(Widget * widget) {
@@ -154,12 +425,14 @@ void Widget::addChild(Widget * widget) {
 void Widget::removeChild(const Widget *widget) {
     mChildren.erase(std::remove(mChildren.begin(), mChildren.end(), widget), mChildren.end());
     widget->decRef();
+    invalidateLayout();
 }
 
 void Widget::removeChild(int index) {
     Widget *widget = mChildren[index];
     mChildren.erase(mChildren.begin() + index);
     widget->decRef();
+    invalidateLayout();
 }
 
 int Widget::childIndex(Widget *widget) const {
@@ -195,6 +468,15 @@ Screen *Widget::screen() {
     }
 }
 
+float Widget::pixelRatio() const {
+    for (const Widget *widget = this; widget; widget = widget->parent()) {
+        const Screen *screen = dynamic_cast<const Screen *>(widget);
+        if (screen)
+            return screen->pixelRatio();
+    }
+    return TextMetrics::pixelRatio();
+}
+
 void Widget::requestFocus() {
     Widget *widget = this;
     while (widget->parent())
@@ -15,23 +15,63 @@
 #include <nanogui/screen.h>
 #include <nanogui/layout.h>
 #include <nanogui/serializer/core.h>
+#include <nanogui/textmetrics.h>
 
 NAMESPACE_BEGIN(nanogui)
 
+namespace {
+    /// Container of the buttons in the title bar of a window
+    class ButtonPanel : public Widget {
+    public:
+        ButtonPanel(Widget *parent) : Widget(parent) {
+            setLayout(new BoxLayout(Orientation::Horizontal, Alignment::Middle, 0, 4));
+        }
+
+        /// Buttons get the size and font of the title bar once, when they are added
+        virtual void addChild(int index, Widget *widget) override {
+            Widget::addChild(index, widget);
+            widget->setFixedSize(Vector2i(22, 22));
+            widget->setFontSize(15);
+        }
+
+        /// Change the visibility without invalidating the layout of the window
+        void setVisibleQuietly(bool visible) { mVisible = visible; }
+    };
+
+    /// Hides the button panel from the layout of its window while in scope
+    class HiddenButtonPanel {
+    public:
+        HiddenButtonPanel(Widget *panel)
+            : mPanel(static_cast<ButtonPanel *>(panel)),
+              mVisible(panel && panel->visible()) {
+            if (mPanel)
+                mPanel->setVisibleQuietly(false);
+        }
+
+        ~HiddenButtonPanel() {
+            if (mPanel)
+                mPanel->setVisibleQuietly(mVisible);
+        }
+
+    private:
+        ButtonPanel *mPanel;
+        bool mVisible;
+    };
+}
+
 Window::Window(Widget *parent, const std::string &title)
     : Widget(parent), mTitle(title), mButtonPanel(nullptr), mModal(false), mDrag(false) { }
 
 Vector2i Window::preferredSize(NVGcontext *ctx) const {
-    if (mButtonPanel)
-        mButtonPanel->setVisible(false);
-    Vector2i result = Widget::preferredSize(ctx);
-    if (mButtonPanel)
-        mButtonPanel->setVisible(true);
-
-    nvgFontSize(ctx, 18.0f);
-    nvgFontFace(ctx, "sans-bold");
+    Vector2i result;
+    {
+        /* The buttons are placed in the title bar and take no space */
+        HiddenButtonPanel hidden(mButtonPanel);
+        result = Widget::preferredSize(ctx);
+    }
+
     float bounds[4];
-    nvgTextBounds(ctx, 0, 0, mTitle.c_str(), nullptr, bounds);
+    TextMetrics::textBounds(ctx, "sans-bold", 18.0f, mTitle, bounds);
 
     return result.cwiseMax(Vector2i(
         bounds[2]-bounds[0] + 20, bounds[3]-bounds[1]
@@ -39,26 +79,19 @@ Vector2i Window::preferredSize(NVGcontext *ctx) const {
 }
 
 Widget *Window::buttonPanel() {
-    if (!mButtonPanel) {
-        mButtonPanel = new Widget(this);
-        mButtonPanel->setLayout(new BoxLayout(Orientation::Horizontal, Alignment::Middle, 0, 4));
-    }
+    if (!mButtonPanel)
+        mButtonPanel = new ButtonPanel(this);
     return mButtonPanel;
 }
 
 void Window::performLayout(NVGcontext *ctx) {
-    if (!mButtonPanel) {
-        Widget::performLayout(ctx);
-    } else {
-        mButtonPanel->setVisible(false);
+    {
+        HiddenButtonPanel hidden(mButtonPanel);
         Widget::performLayout(ctx);
-        for (auto w : mButtonPanel->children()) {
-            w->setFixedSize(Vector2i(22, 22));
-            w->setFontSize(15);
-        }
-        mButtonPanel->setVisible(true);
+    }
+    if (mButtonPanel && mButtonPanel->visible()) {
         mButtonPanel->setSize(Vector2i(width(), 22));
-        mButtonPanel->setPosition(Vector2i(width() - (mButtonPanel->preferredSize(ctx).x() + 5), 3));
+        mButtonPanel->setPosition(Vector2i(width() - (mButtonPanel->cachedPreferredSize(ctx).x() + 5), 3));
         mButtonPanel->performLayout(ctx);
     }
 }